@@ -34,4 +34,8 @@ option(AX_IMPL_LAYER_WIN32 "Enable Win32 Application Layer Support" OFF)
 option(AX_IMPL_GRAPHICS_GL "Enable OpenGL Graphics Support" OFF)
 option(AX_IMPL_GRAPHICS_DX11 "Enable DirectX11 Graphics Support" OFF)
 option(AX_IMPL_AUDIO_SOFTOPENAL "Enable soft-openal Audio Support" OFF)
-option(AX_BUILD_EXAMPLES "Build Examples, Hello Window, Spinning Cube, etc." OFF)
\ No newline at end of file
+option(AX_IMPL_ZSTD "Enable Zstd block compression (CompressionCodec::Zstd)" OFF)
+option(AX_ENABLE_PROFILER "Compile in AX_PROFILE_SCOPE zones" OFF)
+option(AX_ENABLE_ALLOC_TRACKING "Tagged allocation counters, sampled callstacks and leak report; replaces global new/delete" OFF)
+option(AX_BUILD_EXAMPLES "Build Examples, Hello Window, Spinning Cube, etc." OFF)
+option(AX_BUILD_TOOLS "Build command-line tools (axpak archive packer)" OFF)
\ No newline at end of file
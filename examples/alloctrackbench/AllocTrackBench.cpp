@@ -0,0 +1,133 @@
+// AllocTracker overhead: counter hot path at 1-8 threads vs. the old DebugAllocator (unordered_map per allocation),
+// and new/delete cost — build once with AX_ENABLE_ALLOC_TRACKING and once without to compare. Ends with a tagged leak report.
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+#include "axle/core/alloc/AX_PoolAllocator.hpp"
+#include "axle/core/alloc/AX_TlsfAllocator.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <barrier>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace axle;
+
+static constexpr uint32_t OPS = 2000000;
+
+// The tracker this replaces
+class LegacyDebugAllocator {
+private:
+    struct AllocationInfo {
+        size_t size;
+        const char* file;
+        int line;
+    };
+    std::unordered_map<void*, AllocationInfo> m_allocations{};
+public:
+    void* Allocate(size_t size, const char* file, int line) {
+        void* ptr = std::malloc(size);
+        m_allocations[ptr] = {size, file, line};
+        return ptr;
+    }
+    void Free(void* ptr) {
+        auto it = m_allocations.find(ptr);
+        if (it != m_allocations.end()) m_allocations.erase(it);
+        std::free(ptr);
+    }
+};
+
+template <typename F>
+static double NsPerPair(F&& body) {
+    auto t0 = ChSteadyClock::now();
+    body();
+    return double(std::chrono::duration_cast<ChNanos>(ChSteadyClock::now() - t0).count()) / OPS;
+}
+
+static double CountersNs(uint32_t threads) {
+    std::barrier sync(threads + 1);
+    std::vector<std::thread> workers;
+    for (uint32_t t{0}; t < threads; t++) {
+        workers.emplace_back([&]() {
+            sync.arrive_and_wait();
+            for (uint32_t i{0}; i < OPS; i++) {
+                core::AllocTracker::OnAlloc(core::AllocSource::Pool, core::AllocTag::Scene, 64);
+                core::AllocTracker::OnFree(core::AllocSource::Pool, core::AllocTag::Scene, 64);
+            }
+            sync.arrive_and_wait();
+        });
+    }
+    sync.arrive_and_wait();
+    auto t0 = ChSteadyClock::now();
+    sync.arrive_and_wait();
+    auto t1 = ChSteadyClock::now();
+    for (auto& w : workers) w.join();
+    return double(std::chrono::duration_cast<ChNanos>(t1 - t0).count()) / OPS; // Wall time per pair per thread
+}
+
+int main() {
+#ifdef __AX_ALLOC_TRACKING__
+    std::cout << "build: AX_ENABLE_ALLOC_TRACKING=ON" << std::endl;
+#else
+    std::cout << "build: AX_ENABLE_ALLOC_TRACKING=OFF" << std::endl;
+#endif
+
+    std::vector<void*> batch(256);
+    double mallocNs = NsPerPair([&]() {
+        for (uint32_t i{0}; i < OPS; i += 256) {
+            for (auto& p : batch) p = std::malloc(48);
+            for (auto* p : batch) std::free(p);
+        }
+    });
+    double newNs = NsPerPair([&]() {
+        for (uint32_t i{0}; i < OPS; i += 256) {
+            for (auto& p : batch) p = ::operator new(48);
+            for (auto* p : batch) ::operator delete(p);
+        }
+    });
+    LegacyDebugAllocator legacy;
+    double legacyNs = NsPerPair([&]() {
+        for (uint32_t i{0}; i < OPS; i += 256) {
+            for (auto& p : batch) p = legacy.Allocate(48, __FILE__, __LINE__);
+            for (auto* p : batch) legacy.Free(p);
+        }
+    });
+    std::cout << "malloc/free ns=" << mallocNs << " new/delete ns=" << newNs
+              << " legacy DebugAllocator ns=" << legacyNs << std::endl;
+
+    for (uint32_t threads : {1u, 2u, 4u, 8u}) {
+        std::cout << "threads=" << threads << " OnAlloc+OnFree ns=" << CountersNs(threads) << std::endl;
+    }
+
+    // Tagged usage and a deliberate leak per source
+    core::AllocTracker::SetSampleRate(64);
+    std::vector<int*> leaked;
+    {
+        AX_ALLOC_TAG(Assets);
+        core::TlsfAllocator heap;
+        core::PoolAllocator pool(96, 1024);
+        void* keep = pool.Allocate();
+        (void)keep;
+        for (uint32_t i{0}; i < 200; i++) leaked.push_back(new int[1000]);
+        heap.Free(heap.Allocate(1 << 20));
+        std::cout << "pool+tlsf live in Assets: pool=" << core::AllocTracker::Snapshot().At(core::AllocSource::Pool, core::AllocTag::Assets).liveBytes
+                  << " tlsf peak=" << core::AllocTracker::Snapshot().At(core::AllocSource::Tlsf, core::AllocTag::Assets).peakBytes << std::endl;
+    }
+    {
+        AX_ALLOC_TAG(Text);
+        for (uint32_t i{0}; i < 100; i++) delete[] leaked[i];
+    }
+    core::AllocTracker::SetSampleRate(0);
+
+    auto snapshot = core::AllocTracker::Snapshot();
+    auto heap = snapshot.Total(core::AllocSource::Heap);
+    std::cout << "heap: allocs=" << heap.allocs << " frees=" << heap.frees << " live=" << heap.liveBytes << std::endl;
+
+#ifdef __AX_ALLOC_TRACKING__
+    core::AllocTracker::ReportLeaks(std::cout);
+#endif
+    return 0;
+}
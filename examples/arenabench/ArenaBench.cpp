@@ -0,0 +1,150 @@
+// VirtualArena vs. heap temporaries while "importing" large synthetic meshes: triangle soup expansion,
+// vertex welding through a hash map, normal accumulation, then interleaved vertex/index output.
+// Temporaries go through a memory_resource, the output buffers always live on the heap.
+#include "axle/core/alloc/AX_VirtualArena.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <memory_resource>
+#include <unordered_map>
+#include <vector>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+using namespace axle;
+
+struct Vec3 { float x, y, z; };
+
+struct ImportedMesh {
+    std::vector<float> vertices; // pos3 normal3 uv2
+    std::vector<uint32_t> indices;
+};
+
+static uint64_t MinorFaults() {
+#if defined(__unix__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return uint64_t(usage.ru_minflt);
+#else
+    return 0;
+#endif
+}
+
+static ImportedMesh ImportGrid(uint32_t side, std::pmr::memory_resource* temp) {
+    // Source data as a loader would hand it over: one position per quad corner, no sharing
+    std::pmr::vector<Vec3> soup(temp);
+    soup.reserve(size_t(side) * side * 6);
+    auto at = [side](uint32_t x, uint32_t y) {
+        float fx = float(x) / side, fy = float(y) / side;
+        return Vec3{fx, std::sin(fx * 12.0f) * std::cos(fy * 9.0f) * 0.1f, fy};
+    };
+    for (uint32_t y{0}; y < side; y++) {
+        for (uint32_t x{0}; x < side; x++) {
+            Vec3 a = at(x, y), b = at(x + 1, y), c = at(x, y + 1), d = at(x + 1, y + 1);
+            for (auto& v : {a, c, b, b, c, d}) soup.push_back(v);
+        }
+    }
+
+    // Weld identical corners
+    auto key = [](const Vec3& v) {
+        uint64_t h;
+        uint32_t bits[3];
+        std::memcpy(bits, &v, sizeof(bits));
+        h = (uint64_t(bits[0]) * 0x9E3779B97F4A7C15ull) ^ (uint64_t(bits[1]) * 0xC2B2AE3D27D4EB4Full) ^ bits[2];
+        return h;
+    };
+    std::pmr::unordered_map<uint64_t, uint32_t> welded(temp);
+    std::pmr::vector<Vec3> positions(temp);
+    std::pmr::vector<uint32_t> remap(temp);
+    remap.reserve(soup.size());
+    for (auto& v : soup) {
+        auto [it, inserted] = welded.try_emplace(key(v), uint32_t(positions.size()));
+        if (inserted) positions.push_back(v);
+        remap.push_back(it->second);
+    }
+
+    // Smooth normals
+    std::pmr::vector<Vec3> normals(positions.size(), Vec3{0, 0, 0}, temp);
+    for (size_t i{0}; i + 2 < remap.size(); i += 3) {
+        auto& p0 = positions[remap[i]];
+        auto& p1 = positions[remap[i + 1]];
+        auto& p2 = positions[remap[i + 2]];
+        Vec3 e1{p1.x - p0.x, p1.y - p0.y, p1.z - p0.z}, e2{p2.x - p0.x, p2.y - p0.y, p2.z - p0.z};
+        Vec3 n{e1.y * e2.z - e1.z * e2.y, e1.z * e2.x - e1.x * e2.z, e1.x * e2.y - e1.y * e2.x};
+        for (uint32_t k{0}; k < 3; k++) {
+            auto& acc = normals[remap[i + k]];
+            acc.x += n.x; acc.y += n.y; acc.z += n.z;
+        }
+    }
+
+    ImportedMesh out;
+    out.vertices.reserve(positions.size() * 8);
+    for (size_t i{0}; i < positions.size(); i++) {
+        auto& p = positions[i];
+        auto& n = normals[i];
+        float len = std::sqrt(n.x * n.x + n.y * n.y + n.z * n.z);
+        len = len > 0.0f ? 1.0f / len : 0.0f;
+        out.vertices.insert(out.vertices.end(), {p.x, p.y, p.z, n.x * len, n.y * len, n.z * len, p.x, p.z});
+    }
+    out.indices.assign(remap.begin(), remap.end());
+    return out;
+}
+
+template <typename F>
+static void Run(const char* label, uint32_t meshes, uint32_t side, F&& importOne) {
+    auto faults0 = MinorFaults();
+    auto t0 = ChSteadyClock::now();
+    size_t checksum{0};
+    for (uint32_t i{0}; i < meshes; i++) {
+        auto mesh = importOne(side);
+        checksum += mesh.indices.size() + mesh.vertices.size();
+    }
+    double ms = std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+    std::cout << label << " side=" << side << " ms/mesh=" << ms / meshes
+              << " minor faults/mesh=" << (MinorFaults() - faults0) / meshes
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+int main() {
+    constexpr uint32_t meshes = 8;
+    for (uint32_t side : {128u, 512u, 1024u}) {
+        Run("heap ", meshes, side, [](uint32_t s) {
+            return ImportGrid(s, std::pmr::new_delete_resource());
+        });
+
+        core::VirtualArena arena;
+        Run("arena", meshes, side, [&](uint32_t s) {
+            core::ArenaScope scope(arena);
+            return ImportGrid(s, &arena);
+        });
+        std::cout << "  arena peakMiB=" << arena.GetPeak() / 1048576.0
+                  << " committedMiB=" << arena.GetCommitted() / 1048576.0;
+        arena.Reset();
+        std::cout << " after Reset committedMiB=" << arena.GetCommitted() / 1048576.0 << std::endl;
+    }
+
+    // Growth far past a malloc'd LinearAllocator: 16 GiB reserved, touched in 64 MiB steps
+    core::VirtualArena big({.reserveSize = 16ull << 30, .retainOnReset = 0});
+    size_t total{0};
+    while (void* p = big.Allocate(64ull << 20, 4096)) {
+        std::memset(p, 1, 4096);
+        total += 64ull << 20;
+        if (total >= (2ull << 30)) break;
+    }
+    std::cout << "big arena: allocated GiB=" << total / double(1ull << 30)
+              << " reservedGiB=" << big.GetReserved() / double(1ull << 30)
+              << " committedGiB=" << big.GetCommitted() / double(1ull << 30) << std::endl;
+    {
+        core::ArenaScope scope(big);
+        big.Allocate(1 << 20);
+    }
+    big.Reset();
+    std::cout << "big arena after Reset committed=" << big.GetCommitted() << std::endl;
+    return 0;
+}
@@ -0,0 +1,208 @@
+// Loading thousands of small texture-sized files one FileDataStream at a time against a single AsyncIO
+// ReadFiles() batch (io_uring when available, then the pread thread pool), with the page cache dropped
+// (cold) and populated (warm). Also checks scatter reads and a prefetching FileDataStream over one large file.
+#include "axle/data/AX_AsyncIO.hpp"
+#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace axle;
+
+static constexpr uint32_t FILE_COUNT = 4000;
+static constexpr uint32_t MIN_FILE_SIZE = 16 * 1024;
+static constexpr uint32_t MAX_FILE_SIZE = 256 * 1024;
+static constexpr uint64_t LARGE_FILE_SIZE = 256ull << 20;
+
+template <typename Fn>
+static double TimeMs(Fn&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+static void Fail(const char* what) {
+    std::cout << "FAILED: " << what << std::endl;
+    std::exit(1);
+}
+
+// Evicts the file from the page cache, no privileges needed since the pages are clean after fsync
+static void DropCache(const std::filesystem::path& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    ::fsync(fd);
+#if defined(__linux__)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    ::close(fd);
+#endif
+}
+
+static uint64_t Checksum(const uint8_t* bytes, std::size_t size) {
+    uint64_t sum{size};
+    for (std::size_t i{0}; i < size; i += 4096) sum = sum * 31 + bytes[i];
+    return sum;
+}
+
+static const char* BackendName(data::AsyncIOBackend backend) {
+    switch (backend) {
+        case data::AsyncIOBackend::IOUring: return "io_uring";
+        case data::AsyncIOBackend::ThreadPool: return "thread pool";
+        default: return "auto";
+    }
+}
+
+int main() {
+    auto dir = std::filesystem::temp_directory_path() / "axle_asynciobench";
+    std::filesystem::remove_all(dir);
+    std::filesystem::create_directories(dir);
+
+    std::mt19937 rng(11);
+    std::vector<std::filesystem::path> paths;
+    uint64_t totalBytes{0}, expected{0};
+    {
+        std::vector<uint8_t> bytes(MAX_FILE_SIZE);
+        for (uint32_t i{0}; i < FILE_COUNT; i++) {
+            uint32_t size = MIN_FILE_SIZE + rng() % (MAX_FILE_SIZE - MIN_FILE_SIZE);
+            for (uint32_t j{0}; j < size; j += 4096) bytes[j] = uint8_t(rng());
+            std::memcpy(bytes.data(), "\xABKTX 20\xBB", 8);
+            paths.push_back(dir / ("tex_" + std::to_string(i) + ".ktx2"));
+            data::FileDataStream file(paths.back(), false, true);
+            if (file.Open().IsValid() || !file.Write(bytes.data(), size).has_value()) Fail("write texture");
+            totalBytes += size;
+            expected += Checksum(bytes.data(), size);
+        }
+    }
+
+    auto dropAll = [&]() { for (auto& path : paths) DropCache(path); };
+    auto report = [&](const char* what, double ms) {
+        std::cout << "  " << what << ": " << ms << " ms, " << uint64_t(FILE_COUNT / (ms / 1000.0)) << " files/s, "
+                  << uint64_t(totalBytes / (ms / 1000.0) / (1 << 20)) << " MiB/s" << std::endl;
+    };
+
+    // Both keep every file's bytes until the whole set is loaded, as a level load would
+    auto syncLoad = [&]() {
+        uint64_t sum{0};
+        std::vector<std::vector<uint8_t>> loaded(paths.size());
+        for (std::size_t i{0}; i < paths.size(); i++) {
+            data::FileDataStream file(paths[i], true, false);
+            if (file.Open().IsValid()) Fail("open texture");
+            loaded[i].resize(file.GetLength());
+            if (!file.Read(loaded[i].data(), loaded[i].size()).has_value()) Fail("read texture");
+            sum += Checksum(loaded[i].data(), loaded[i].size());
+        }
+        if (sum != expected) Fail("sync checksum");
+    };
+    auto asyncLoad = [&](data::AsyncIO& io) {
+        auto futures = io.ReadFiles({paths.data(), paths.size()});
+        uint64_t sum{0};
+        for (auto& future : futures) {
+            auto res = future.Get();
+            if (!res.has_value()) Fail(std::string(res.error().GetMessage()).c_str());
+            sum += Checksum(res.value().data(), res.value().size());
+        }
+        if (sum != expected) Fail("async checksum");
+    };
+
+    std::cout << FILE_COUNT << " files, " << (totalBytes >> 20) << " MiB total" << std::endl;
+
+    dropAll();
+    double syncCold = TimeMs(syncLoad);
+    double syncWarm = TimeMs(syncLoad);
+    std::cout << "FileDataStream, one file at a time:" << std::endl;
+    report("cold", syncCold);
+    report("warm", syncWarm);
+
+    data::AsyncIO uring({.backend = data::AsyncIOBackend::Auto});
+    data::AsyncIO pool({.backend = data::AsyncIOBackend::ThreadPool, .workerCount = 8});
+    std::vector<data::AsyncIO*> ios{&pool};
+    if (uring.GetBackend() == data::AsyncIOBackend::IOUring) ios.insert(ios.begin(), &uring);
+    else std::cout << "io_uring unavailable, only the thread pool is measured" << std::endl;
+
+    for (auto* io : ios) {
+        dropAll();
+        double cold = TimeMs([&]() { asyncLoad(*io); });
+        double warm = TimeMs([&]() { asyncLoad(*io); });
+        std::cout << "AsyncIO::ReadFiles, " << BackendName(io->GetBackend()) << ":" << std::endl;
+        report("cold", cold);
+        report("warm", warm);
+    }
+
+    // Scatter reads land in the right slices
+    for (auto* io : ios) {
+        auto fileRes = data::AsyncFile::Open(paths[0]);
+        if (!fileRes.has_value()) Fail("open for scatter");
+        auto file = fileRes.value();
+        std::vector<uint8_t> whole(file->GetSize());
+        {
+            data::FileDataStream ref(paths[0], true, false);
+            if (ref.Open().IsValid() || !ref.Read(whole.data(), whole.size()).has_value()) Fail("scatter reference");
+        }
+        std::vector<uint8_t> a(4096), b(100), c(8192);
+        data::IOSlice slices[] = {
+            {0, {a.data(), a.size()}},
+            {12345, {b.data(), b.size()}},
+            {file->GetSize() - 4096, {c.data(), c.size()}} // Runs past the end, reads 4096
+        };
+        auto bytes = io->ReadScatter(file, {slices, 3}).Get();
+        if (!bytes.has_value() || bytes.value() != a.size() + b.size() + 4096) Fail("scatter size");
+        if (std::memcmp(a.data(), whole.data(), a.size()) != 0 ||
+            std::memcmp(b.data(), whole.data() + 12345, b.size()) != 0 ||
+            std::memcmp(c.data(), whole.data() + whole.size() - 4096, 4096) != 0) Fail("scatter contents");
+    }
+    std::cout << "scatter reads OK" << std::endl;
+
+    // One large blob read sequentially in 1 MiB pieces, plain and prefetching
+    auto largePath = dir / "large.bin";
+    uint64_t largeSum{0};
+    {
+        std::vector<uint8_t> chunk(1 << 20);
+        data::FileDataStream file(largePath, false, true);
+        if (file.Open().IsValid()) Fail("open large");
+        for (uint64_t done{0}; done < LARGE_FILE_SIZE; done += chunk.size()) {
+            for (std::size_t j{0}; j < chunk.size(); j += 4096) chunk[j] = uint8_t(rng());
+            if (!file.Write(chunk.data(), chunk.size()).has_value()) Fail("write large");
+            largeSum += Checksum(chunk.data(), chunk.size());
+        }
+    }
+    auto readLarge = [&](data::FileDataStream& file) {
+        if (file.Open().IsValid()) Fail("open large for read");
+        std::vector<uint8_t> chunk(1 << 20);
+        uint64_t sum{0};
+        while (!file.EndOfStream()) {
+            auto res = file.Read(chunk.data(), chunk.size());
+            if (!res.has_value()) Fail("read large");
+            if (res.value() == 0) break;
+            sum += Checksum(chunk.data(), res.value());
+        }
+        if (sum != largeSum) Fail("large checksum");
+    };
+    DropCache(largePath);
+    double plainLarge = TimeMs([&]() {
+        data::FileDataStream file(largePath, true, false);
+        readLarge(file);
+    });
+    DropCache(largePath);
+    double prefetchLarge = TimeMs([&]() {
+        data::FileDataStream file(largePath, data::FilePrefetchDesc{.io = &pool, .chunkSize = 1 << 20, .depth = 8});
+        readLarge(file);
+    });
+    std::cout << (LARGE_FILE_SIZE >> 20) << " MiB file, cold, sequential 1 MiB reads: FileDataStream " << plainLarge
+              << " ms, prefetching FileDataStream " << prefetchLarge << " ms" << std::endl;
+
+    std::filesystem::remove_all(dir);
+    std::cout << "ALL OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Reading every file of a scene directory (Sponza by default: glTF, buffers and textures), then of 4000 small
+// generated files, as loose files through FileDataStream against one mmapped .axpak, with the page cache dropped
+// (cold) and populated (warm). Both sides hash every byte (XXH64), which checks the pack's contents and makes it
+// fault in its pages.
+#include "axle/assets/AX_AssetPacker.hpp"
+#include "axle/data/AX_DataStreamImplBuffer.hpp"
+#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace axle;
+
+static constexpr uint32_t SMALL_FILES = 4000;
+
+template <typename Fn>
+static double TimeMs(Fn&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+static void Fail(const std::string& what) {
+    std::cout << "FAILED: " << what << std::endl;
+    std::exit(1);
+}
+
+// Evicts the file from the page cache, no privileges needed since the pages are clean after fsync
+static void DropCache(const std::filesystem::path& path) {
+#if defined(__unix__) || defined(__APPLE__)
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    ::fsync(fd);
+#if defined(__linux__)
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+#endif
+    ::close(fd);
+#endif
+}
+
+struct Results {
+    double looseCold, looseWarm, packCold, packWarm;
+};
+
+static Results Measure(const std::filesystem::path& dir) {
+    struct Loose {
+        std::filesystem::path file;
+        std::string packPath;
+        uint64_t checksum;
+    };
+    std::vector<Loose> files;
+    uint64_t totalBytes{0};
+    for (const auto& it : std::filesystem::recursive_directory_iterator(dir)) {
+        if (!it.is_regular_file()) continue;
+        files.push_back({it.path(), std::filesystem::relative(it.path(), dir).generic_string(), 0});
+        totalBytes += it.file_size();
+    }
+
+    // The packer maps every file, it is gone before timing so the page cache can be dropped
+    auto packPath = std::filesystem::temp_directory_path() / "axle_axpakbench.axpak";
+    {
+        assets::AssetPacker packer;
+        double packMs = TimeMs([&]() {
+            if (auto err = packer.AddDirectory(dir); err.IsValid()) Fail(std::string(err.GetMessage()));
+            data::FileDataStream out(packPath, false, true);
+            if (out.Open().IsValid() || packer.Write(out).IsValid()) Fail("write pack");
+        });
+        std::cout << files.size() << " files, " << (totalBytes >> 20) << " MiB from " << dir.string() << ", packed in "
+                  << packMs << " ms" << std::endl;
+
+        // Same pack written to memory must be readable and as large as the file
+        data::BufferDataStream mem(packer.GetPackSize());
+        if (mem.Open().IsValid() || packer.Write(mem).IsValid()) Fail("write pack to memory");
+        auto bytes = mem.PeekContiguous();
+        assets::AssetPack fromMemory(utils::URaw(std::vector<uint8_t>(bytes.begin(), bytes.end())));
+        if (fromMemory.Open().IsValid() || fromMemory.GetEntries().size() != files.size()) Fail("open pack from memory");
+        if (bytes.size() != std::filesystem::file_size(packPath)) Fail("memory and file packs differ in size");
+    }
+
+    auto loadLoose = [&]() {
+        std::vector<uint8_t> bytes;
+        for (auto& loose : files) {
+            data::FileDataStream file(loose.file, true, false);
+            if (file.Open().IsValid()) Fail("open " + loose.file.string());
+            bytes.resize(file.GetLength());
+            if (!file.Read(bytes.data(), bytes.size()).has_value()) Fail("read " + loose.file.string());
+            uint64_t sum = assets::PackChecksum(bytes.data(), bytes.size());
+            if (loose.checksum != 0 && loose.checksum != sum) Fail("loose checksum changed");
+            loose.checksum = sum;
+        }
+    };
+    auto loadPack = [&]() {
+        assets::AssetPack pack(packPath);
+        if (auto err = pack.Open(); err.IsValid()) Fail(std::string(err.GetMessage()));
+        for (const auto& loose : files) {
+            const auto* entry = pack.Find(loose.packPath);
+            if (!entry) Fail("missing from pack: " + loose.packPath);
+            auto view = pack.View(*entry).value();
+            if (assets::PackChecksum(view.handle(), view.size()) != loose.checksum) Fail("pack checksum " + loose.packPath);
+        }
+    };
+
+    Results res;
+    for (const auto& loose : files) DropCache(loose.file);
+    res.looseCold = TimeMs(loadLoose);
+    res.looseWarm = TimeMs(loadLoose);
+    DropCache(packPath);
+    res.packCold = TimeMs(loadPack);
+    res.packWarm = TimeMs(loadPack);
+
+    // Lookup alone, over every path
+    assets::AssetPack pack(packPath);
+    if (pack.Open().IsValid()) Fail("open pack");
+    const uint32_t rounds = 1'000'000 / uint32_t(files.size()) + 1;
+    uint64_t found{0};
+    double lookupMs = TimeMs([&]() {
+        for (uint32_t r{0}; r < rounds; r++) {
+            for (const auto& loose : files) found += pack.Find(loose.packPath) != nullptr;
+        }
+    });
+    if (found != uint64_t(rounds) * files.size()) Fail("lookup");
+
+    std::cout << "  loose files (FileDataStream): cold " << res.looseCold << " ms, warm " << res.looseWarm << " ms" << std::endl;
+    std::cout << "  axpak (mmap, View):           cold " << res.packCold << " ms, warm " << res.packWarm << " ms" << std::endl;
+    std::cout << "  Find(): " << lookupMs * 1e6 / double(found) << " ns per lookup over " << files.size() << " entries" << std::endl;
+
+    std::filesystem::remove(packPath);
+    return res;
+}
+
+int main(int argc, char** argv) {
+    std::filesystem::path scene = argc > 1 ? argv[1] : "sponza";
+    for (const char* guess : {"../sponza", "../../sponza", "../../../sponza"}) {
+        if (argc > 1 || std::filesystem::is_directory(scene)) break;
+        scene = guess;
+    }
+    if (std::filesystem::is_directory(scene)) Measure(scene);
+    else std::cout << "scene directory not found (pass it as the first argument), skipping it" << std::endl;
+
+    // Many small files, where per-file opens dominate
+    auto dir = std::filesystem::temp_directory_path() / "axle_axpakbench_small";
+    std::filesystem::remove_all(dir);
+    std::mt19937 rng(5);
+    std::vector<uint8_t> bytes(64 * 1024);
+    for (uint32_t i{0}; i < SMALL_FILES; i++) {
+        auto sub = dir / ("dir" + std::to_string(i % 16));
+        std::filesystem::create_directories(sub);
+        size_t size = 1024 + rng() % (bytes.size() - 1024);
+        for (size_t j{0}; j < size; j += 256) bytes[j] = uint8_t(rng());
+        data::FileDataStream file(sub / ("asset_" + std::to_string(i) + ".bin"), false, true);
+        if (file.Open().IsValid() || !file.Write(bytes.data(), size).has_value()) Fail("write small file");
+    }
+    Measure(dir);
+    std::filesystem::remove_all(dir);
+
+    std::cout << "ALL OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,297 @@
+// Block-compressed streams over mesh and texture data: compression ratio and speed per codec, decode GB/s for one
+// thread and for parallel block decode, and random 4 KiB reads after seeking. Data sets are the Sponza textures as
+// shipped (JPEG/PNG) and decoded to pixels, the glTF JSON, and generated mesh data (interleaved vertices and
+// indices). LZ4 round trips on edge cases and corrupt stream footers are checked first, and every decode is compared
+// against the input.
+#include "axle/assets/AX_AssetPacker.hpp"
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/data/AX_CompressedStream.hpp"
+#include "axle/data/AX_DataStreamImplBuffer.hpp"
+#include "axle/graphics/image/AX_ImageLoader.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace axle;
+
+static constexpr uint32_t MAX_DECODED_TEXTURES = 24; // Decoded Sponza is several hundred MiB otherwise
+
+template <typename Fn>
+static double TimeMs(Fn&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+static void Fail(const std::string& what) {
+    std::cout << "FAILED: " << what << std::endl;
+    std::exit(1);
+}
+
+static std::vector<uint8_t> ReadFile(const std::filesystem::path& path) {
+    std::ifstream in(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(in), {});
+}
+
+static void RoundTrip(const std::vector<uint8_t>& raw, const std::string& what) {
+    std::vector<uint8_t> packed(data::CompressBound(data::CompressionCodec::LZ4, raw.size()));
+    auto size = data::Compress(data::CompressionCodec::LZ4, raw.data(), raw.size(), packed.data(), packed.size());
+    if (!size.has_value()) Fail("compress " + what);
+    std::vector<uint8_t> back(raw.size());
+    auto err = data::Decompress(data::CompressionCodec::LZ4, packed.data(), size.value(), back.data(), back.size());
+    if (err.IsValid() || back != raw) Fail("LZ4 round trip: " + what);
+
+    // Truncated or wrongly sized input has to fail cleanly
+    if (size.value() > 1) {
+        err = data::Decompress(data::CompressionCodec::LZ4, packed.data(), size.value() - 1, back.data(), back.size());
+        if (!err.IsValid()) Fail("truncated block decoded: " + what);
+    }
+    back.resize(raw.size() + 1);
+    err = data::Decompress(data::CompressionCodec::LZ4, packed.data(), size.value(), back.data(), back.size());
+    if (!err.IsValid()) Fail("oversized output accepted: " + what);
+}
+
+static void CheckLZ4() {
+    std::mt19937 rng(7);
+    for (size_t size : {0, 1, 4, 12, 13, 15, 16, 17, 31, 64, 65, 255, 270, 4096, 65536, 70000, 1 << 20}) {
+        std::vector<uint8_t> random(size), zeros(size, 0), text(size);
+        for (auto& b : random) b = uint8_t(rng());
+        for (size_t i{0}; i < size; i++) text[i] = "the quick brown fox "[i % 20];
+        RoundTrip(random, "random " + std::to_string(size));
+        RoundTrip(zeros, "zeros " + std::to_string(size));
+        RoundTrip(text, "text " + std::to_string(size));
+        for (size_t period : {1, 2, 3, 5, 7, 8, 9, 15, 17}) {
+            std::vector<uint8_t> pattern(size);
+            for (size_t i{0}; i < size; i++) pattern[i] = uint8_t(i % period * 37 + (i / 4096));
+            RoundTrip(pattern, "period " + std::to_string(period) + " size " + std::to_string(size));
+        }
+    }
+    // Matches at the 64 KiB offset limit and beyond it
+    std::vector<uint8_t> far(200000);
+    for (auto& b : far) b = uint8_t(rng());
+    std::memcpy(far.data() + 65535 + 100, far.data() + 100, 5000);
+    std::memcpy(far.data() + 65536 + 80000, far.data() + 80000, 5000);
+    RoundTrip(far, "far matches");
+    std::cout << "LZ4 round trips OK" << std::endl;
+}
+
+// Crafted footers and indices whose fields only add up after wrapping around 2^64 must fail to open
+static void CheckCorruptFooters() {
+    auto opens = [](uint64_t prefix, const std::vector<data::CompressedBlockInfo>& index, uint64_t indexOffset,
+                    uint64_t rawSize, uint32_t blockCount, uint32_t blockSize = 4096) {
+        data::CompressedStreamFooter footer{};
+        footer.indexOffset = indexOffset;
+        footer.rawSize = rawSize;
+        footer.blockSize = blockSize;
+        footer.codec = uint16_t(data::CompressionCodec::LZ4);
+        footer.version = data::COMPRESSED_STREAM_VERSION;
+        footer.blockCount = blockCount;
+        footer.magic = data::COMPRESSED_STREAM_MAGIC;
+
+        std::vector<uint8_t> bytes(prefix, 0);
+        const auto* infos = reinterpret_cast<const uint8_t*>(index.data());
+        bytes.insert(bytes.end(), infos, infos + index.size() * sizeof(data::CompressedBlockInfo));
+        const auto* tail = reinterpret_cast<const uint8_t*>(&footer);
+        bytes.insert(bytes.end(), tail, tail + sizeof(footer));
+
+        data::BufferDataStream inner(utils::URawView(bytes.data(), bytes.size()));
+        if (inner.Open().IsValid()) Fail("open corrupt footer buffer");
+        data::CompressedReadStream stream(inner);
+        return !stream.Open().IsValid();
+    };
+
+    // indexOffset + index + footer wraps to the stored size: index read from before the buffer
+    if (opens(8, {}, uint64_t(40) - 48, 1, 1)) Fail("wrapped index offset accepted");
+    // rawSize + blockSize - 1 wraps to a zero block count over a huge raw size
+    if (opens(0, {}, 0, UINT64_MAX, 0)) Fail("wrapped raw size accepted");
+    // Block offset + size wraps below the index
+    if (opens(16, {{UINT64_MAX - 3, 16, 0}}, 16, 4096, 1)) Fail("wrapped block range accepted");
+    // The same layout with a sane block range still opens
+    if (!opens(16, {{0, 16, 0}}, 16, 4096, 1)) Fail("valid crafted stream rejected");
+    // Block size past the cap would size the decode cache off the file
+    if (opens(16, {{0, 16, 0}}, 16, 1, 1, UINT32_MAX)) Fail("oversized block size accepted");
+    // Compressed block bigger than the codec can ever emit for one block
+    if (opens(8192, {{0, 8192, 0}}, 8192, 4096, 1)) Fail("oversized compressed block accepted");
+    std::cout << "Corrupt compressed footers OK" << std::endl;
+}
+
+// Grid of a displaced sphere: position, normal, uv, tangent per vertex (48 bytes), then 32-bit triangle indices
+static std::vector<uint8_t> GenerateMesh(uint32_t rings, uint32_t segments) {
+    std::vector<float> vertices;
+    vertices.reserve(size_t(rings + 1) * (segments + 1) * 12);
+    for (uint32_t r{0}; r <= rings; r++) {
+        float v = float(r) / float(rings), theta = v * 3.14159265f;
+        for (uint32_t s{0}; s <= segments; s++) {
+            float u = float(s) / float(segments), phi = u * 6.2831853f;
+            float nx = std::sin(theta) * std::cos(phi), ny = std::cos(theta), nz = std::sin(theta) * std::sin(phi);
+            float radius = 1.0f + 0.05f * std::sin(phi * 12.0f) * std::sin(theta * 9.0f);
+            vertices.insert(vertices.end(), {nx * radius, ny * radius, nz * radius, nx, ny, nz, u, v,
+                                             -std::sin(phi), 0.0f, std::cos(phi), 1.0f});
+        }
+    }
+    std::vector<uint32_t> indices;
+    indices.reserve(size_t(rings) * segments * 6);
+    for (uint32_t r{0}; r < rings; r++) {
+        for (uint32_t s{0}; s < segments; s++) {
+            uint32_t a = r * (segments + 1) + s, b = a + segments + 1;
+            indices.insert(indices.end(), {a, b, a + 1, a + 1, b, b + 1});
+        }
+    }
+    std::vector<uint8_t> bytes(vertices.size() * sizeof(float) + indices.size() * sizeof(uint32_t));
+    std::memcpy(bytes.data(), vertices.data(), vertices.size() * sizeof(float));
+    std::memcpy(bytes.data() + vertices.size() * sizeof(float), indices.data(), indices.size() * sizeof(uint32_t));
+    return bytes;
+}
+
+static void Measure(const std::string& name, const std::vector<uint8_t>& raw, data::CompressionCodec codec, int level = 0) {
+    if (raw.empty()) return;
+    const double mib = double(raw.size()) / (1024.0 * 1024.0);
+
+    data::CompressedWriteDesc desc{codec};
+    desc.level = level;
+    uint64_t blocks = (raw.size() + desc.blockSize - 1) / desc.blockSize;
+    data::BufferDataStream stored(raw.size() + blocks * sizeof(data::CompressedBlockInfo) + sizeof(data::CompressedStreamFooter));
+    if (stored.Open().IsValid()) Fail("open buffer");
+
+    uint64_t storedSize{0};
+    double compressMs = TimeMs([&]() {
+        data::CompressedWriteStream writer(stored, desc);
+        if (writer.Open().IsValid() || !writer.Write(raw.data(), raw.size()).has_value() || writer.Finish().IsValid()) {
+            Fail("compress " + name);
+        }
+        storedSize = writer.GetStoredSize();
+    });
+    utils::URawView view(stored.PeekContiguous().handle(), storedSize);
+
+    std::vector<uint8_t> out(raw.size());
+    auto decode = [&](uint32_t parallelBlocks) {
+        data::BufferDataStream in(view);
+        if (in.Open().IsValid()) Fail("open compressed buffer");
+        data::CompressedReadStream reader(in, {nullptr, parallelBlocks});
+        if (reader.Open().IsValid()) Fail("open compressed stream " + name);
+        auto read = reader.Read(out.data(), out.size());
+        if (!read.has_value() || read.value() != raw.size()) Fail("decode " + name);
+    };
+    auto best = [&](uint32_t parallelBlocks) {
+        double ms{1e30};
+        for (int i{0}; i < 5; i++) ms = std::min(ms, TimeMs([&]() { decode(parallelBlocks); }));
+        if (out != raw) Fail("decoded bytes differ: " + name);
+        std::fill(out.begin(), out.end(), 0);
+        return ms;
+    };
+    double serialMs = best(0);
+    double parallelMs = best(2);
+
+    // Random small reads after a seek, each decodes at most two blocks
+    data::BufferDataStream in(view);
+    in.Open();
+    data::CompressedReadStream reader(in);
+    if (reader.Open().IsValid()) Fail("open compressed stream " + name);
+    std::mt19937_64 rng(3);
+    const uint32_t seeks = 2000;
+    uint8_t chunk[4096];
+    double seekMs = TimeMs([&]() {
+        for (uint32_t i{0}; i < seeks; i++) {
+            uint64_t pos = rng() % raw.size();
+            reader.SeekRead(pos);
+            auto read = reader.Read(chunk, sizeof(chunk));
+            if (!read.has_value() || std::memcmp(chunk, raw.data() + pos, read.value()) != 0) Fail("seek read " + name);
+        }
+    });
+
+    std::string codecName = codec == data::CompressionCodec::LZ4 ? "lz4" : "zstd" + std::to_string(level);
+    std::cout << "  " << name << " [" << codecName << "]: " << mib << " MiB, ratio " << double(raw.size()) / double(storedSize)
+              << ", compress " << mib / (compressMs / 1000.0) << " MiB/s, decode "
+              << double(raw.size()) / (serialMs * 1e6) << " GB/s (1 thread), "
+              << double(raw.size()) / (parallelMs * 1e6) << " GB/s (parallel), seek+4KiB read "
+              << seekMs * 1000.0 / seeks << " us" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    CheckLZ4();
+    CheckCorruptFooters();
+
+    std::filesystem::path scene = argc > 1 ? argv[1] : "sponza";
+    for (const char* guess : {"../sponza", "../../sponza", "../../../sponza"}) {
+        if (argc > 1 || std::filesystem::is_directory(scene)) break;
+        scene = guess;
+    }
+
+    struct DataSet {
+        std::string name;
+        std::vector<uint8_t> bytes;
+    };
+    std::vector<DataSet> sets;
+    sets.push_back({"mesh (generated, 48 B vertices + u32 indices)", GenerateMesh(512, 1024)});
+
+    if (std::filesystem::is_directory(scene)) {
+        DataSet shipped{"textures as shipped (jpg/png)", {}}, decoded{"textures decoded (raw pixels)", {}}, gltf{"glTF JSON", {}};
+        uint32_t decodedCount{0};
+        std::vector<std::filesystem::path> files;
+        for (const auto& it : std::filesystem::directory_iterator(scene)) files.push_back(it.path());
+        std::sort(files.begin(), files.end());
+        for (const auto& file : files) {
+            std::string ext = file.extension().string();
+            if (ext == ".gltf") {
+                gltf.bytes = ReadFile(file);
+            } else if (ext == ".jpg" || ext == ".png") {
+                auto bytes = ReadFile(file);
+                shipped.bytes.insert(shipped.bytes.end(), bytes.begin(), bytes.end());
+                if (decodedCount >= MAX_DECODED_TEXTURES) continue;
+                auto image = gfx::Img_Auto_LoadFile(file);
+                if (!image.has_value()) Fail("decode " + file.string());
+                const auto& pixels = image.value().bytes;
+                decoded.bytes.insert(decoded.bytes.end(), pixels.data(), pixels.data() + pixels.size());
+                decodedCount++;
+            }
+        }
+        sets.push_back(std::move(shipped));
+        sets.push_back(std::move(decoded));
+        sets.push_back(std::move(gltf));
+    } else {
+        std::cout << "scene directory not found (pass it as the first argument), only generated data" << std::endl;
+    }
+
+    std::cout << "128 KiB blocks, " << core::JobSystem::Global().GetWorkerCount() << " job workers + caller" << std::endl;
+    for (const auto& set : sets) {
+        Measure(set.name, set.bytes, data::CompressionCodec::LZ4);
+        if (data::IsCodecAvailable(data::CompressionCodec::Zstd)) {
+            Measure(set.name, set.bytes, data::CompressionCodec::Zstd, 3);
+            Measure(set.name, set.bytes, data::CompressionCodec::Zstd, 19);
+        }
+    }
+    if (!data::IsCodecAvailable(data::CompressionCodec::Zstd)) std::cout << "Zstd not compiled in (AX_IMPL_ZSTD)" << std::endl;
+
+    // Compressed pack entries load back to their raw bytes
+    assets::AssetPacker packer;
+    for (const auto& set : sets) {
+        if (packer.Add(set.name, utils::URaw(std::vector<uint8_t>(set.bytes)), assets::PackCompression::LZ4).IsValid()) Fail("pack " + set.name);
+    }
+    data::BufferDataStream mem(packer.GetPackSize());
+    if (mem.Open().IsValid() || packer.Write(mem).IsValid()) Fail("write pack");
+    auto packBytes = mem.PeekContiguous();
+    assets::AssetPack pack(utils::URaw(std::vector<uint8_t>(packBytes.begin(), packBytes.end())));
+    if (pack.Open().IsValid()) Fail("open pack");
+    for (const auto& set : sets) {
+        const auto* entry = pack.Find(set.name);
+        if (!entry || pack.Verify(*entry).IsValid()) Fail("pack entry " + set.name);
+        auto loaded = pack.Load(*entry);
+        if (!loaded.has_value() || loaded.value().size() != set.bytes.size()
+            || std::memcmp(loaded.value().data(), set.bytes.data(), set.bytes.size()) != 0) {
+            Fail("pack load " + set.name);
+        }
+    }
+    std::cout << "LZ4 .axpak: " << packBytes.size() << " bytes for " << pack.GetEntries().size() << " entries, loads OK" << std::endl;
+
+    std::cout << "ALL OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,113 @@
+// Task<T> stress: thousands of concurrent coroutine pipelines hopping between JobSystem workers and two headless cyclers
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/core/concurrency/AX_Task.hpp"
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <latch>
+#include <stdexcept>
+#include <thread>
+
+using namespace axle;
+
+// Stand-ins for the gfx/audio owners, no context behind them
+static SharedPtr<core::ThreadCycler> g_Gfx;
+static SharedPtr<core::ThreadCycler> g_Io;
+
+static std::atomic<uint64_t> g_WrongThread{0};
+
+static Task<uint64_t> Upload(uint64_t value) {
+    co_await g_Gfx->Schedule();
+    if (!g_Gfx->ValidateThread()) g_WrongThread.fetch_add(1);
+    co_return value * 3;
+}
+
+static Task<uint64_t> Pipeline(uint32_t idx) {
+    auto& jobs = core::JobSystem::Global();
+
+    co_await jobs.Schedule();
+    if (!jobs.IsWorkerThread()) g_WrongThread.fetch_add(1);
+    uint64_t value = idx + 1;
+
+    value = co_await Upload(value);
+
+    co_await g_Io->Schedule();
+    if (!g_Io->ValidateThread()) g_WrongThread.fetch_add(1);
+    value += co_await core::ThreadInvocation<uint64_t>(g_Gfx, [value]() { return value; }).Async();
+
+    co_await jobs.Schedule();
+    co_return value;
+}
+
+static Task<void> Throws() {
+    co_await core::JobSystem::Global().Schedule();
+    throw std::runtime_error("pipeline failure");
+}
+
+static Task<void> Track(uint32_t idx, std::atomic<uint64_t>& sum, std::latch& done) {
+    sum.fetch_add(co_await Pipeline(idx), std::memory_order_relaxed);
+    done.count_down();
+}
+
+static bool RunPipelines(uint32_t count) {
+    std::atomic<uint64_t> sum{0};
+    std::latch done(count);
+
+    auto t0 = ChSteadyClock::now();
+    for (uint32_t i{0}; i < count; i++) {
+        core::Spawn(Track(i, sum, done));
+    }
+    done.wait();
+    auto t1 = ChSteadyClock::now();
+
+    uint64_t expected{0};
+    for (uint64_t i{1}; i <= count; i++) {
+        expected += i * 6;
+    }
+
+    double ms = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    bool ok = sum.load() == expected && g_WrongThread.load() == 0;
+    std::cout << "pipelines=" << count
+              << " ms=" << ms
+              << " hops/sec=" << (count * 5.0) / (ms / 1000.0)
+              << (ok ? " OK" : " FAILED") << std::endl;
+    return ok;
+}
+
+int main() {
+    g_Gfx = std::make_shared<core::ThreadCycler>();
+    g_Io = std::make_shared<core::ThreadCycler>();
+    for (auto& cycler : {g_Gfx, g_Io}) {
+        cycler->SetIdleWait(true);
+        cycler->Start();
+        cycler->AwaitStart();
+    }
+
+    bool ok = true;
+    ok &= core::SyncWait(Pipeline(0)) == 6;
+    for (uint32_t count : {1000u, 10000u, 50000u}) {
+        ok &= RunPipelines(count);
+    }
+
+    // One invocation posted and awaited repeatedly, each run sees the same function
+    uint32_t runs{0};
+    core::ThreadInvocation<uint32_t> again(g_Gfx, [&runs]() { return ++runs; });
+    ok &= again.PostCall().get() == 1 && again.PostCall().get() == 2;
+    ok &= core::SyncWait(again.Async()) == 3 && core::SyncWait(again.Async()) == 4;
+
+    try {
+        core::SyncWait(Throws());
+        ok = false;
+    } catch (const std::runtime_error&) {}
+
+    g_Gfx->Stop(true);
+    g_Io->Stop(true);
+
+    std::cout << (ok ? "All pipelines OK" : "Pipeline check FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,262 @@
+// ThreadCycler microbenchmarks: steady-state cycle throughput, allocations per cycle, inbox contention, idle CPU, wake latency and stats overhead
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+#include "axle/utils/AX_Universal.hpp"
+
+#include <algorithm>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__)
+#include <sys/resource.h>
+#endif
+
+using namespace axle;
+
+static std::atomic<uint64_t> g_Allocations{0};
+
+void* operator new(std::size_t size) {
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+static void BenchWorks(uint32_t workCount) {
+    auto cycler = std::make_shared<core::ThreadCycler>();
+    std::atomic<uint64_t> cycles{0};
+
+    cycler->Start();
+    cycler->AwaitStart();
+
+    std::vector<core::WorkHandle> works;
+    works.reserve(workCount);
+    for (uint32_t i{0}; i < workCount; i++) {
+        works.push_back(cycler->CreateWork([](){}));
+    }
+    works.push_back(cycler->CreateWork([&cycles](){ cycles.fetch_add(1, std::memory_order_relaxed); }));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100)); // Let the snapshot settle
+
+    auto c0 = cycles.load();
+    auto a0 = g_Allocations.load();
+    auto t0 = ChSteadyClock::now();
+
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+
+    auto c1 = cycles.load();
+    auto a1 = g_Allocations.load();
+    auto t1 = ChSteadyClock::now();
+
+    cycler->Stop(true);
+
+    double secs = std::chrono::duration<double>(t1 - t0).count();
+    double n = double(c1 - c0);
+    std::cout << "works=" << workCount
+              << " cycles/sec=" << n / secs
+              << " allocs/cycle=" << (n > 0 ? double(a1 - a0) / n : 0.0) << std::endl;
+}
+
+// Mirrors the previous inbox: mutex + deque<std::function> + shared packaged_task per call
+class MutexInbox {
+private:
+    std::mutex m_Mutex{};
+    std::deque<std::function<void()>> m_Tasks{};
+    std::atomic_bool m_Running{true};
+    std::thread m_Thread{};
+public:
+    MutexInbox() {
+        m_Thread = std::thread([this]() {
+            std::deque<std::function<void()>> local;
+            while (m_Running.load(std::memory_order_relaxed)) {
+                {
+                    std::lock_guard<std::mutex> lock(m_Mutex);
+                    local = m_Tasks;
+                    m_Tasks.clear();
+                }
+                for (auto& job : local) job();
+            }
+        });
+    }
+    ~MutexInbox() {
+        m_Running.store(false);
+        m_Thread.join();
+    }
+
+    template <typename F>
+    auto EnqueueFuture(F&& func) {
+        using Ret = decltype(func());
+        auto task = std::make_shared<std::packaged_task<Ret()>>(std::forward<F>(func));
+        auto future = task->get_future();
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_Tasks.push_back([task]() mutable { (*task)(); });
+        return future;
+    }
+};
+
+template <typename T_Inbox>
+static double BenchContention(T_Inbox& inbox, uint32_t producers, uint32_t perProducer) {
+    std::atomic<uint64_t> done{0};
+    std::vector<std::thread> threads;
+
+    auto t0 = ChSteadyClock::now();
+    for (uint32_t p{0}; p < producers; p++) {
+        threads.emplace_back([&]() {
+            for (uint32_t i{0}; i < perProducer; i++) {
+                inbox.EnqueueFuture([&done]() { done.fetch_add(1, std::memory_order_relaxed); });
+            }
+        });
+    }
+    for (auto& t : threads) t.join();
+    while (done.load() < uint64_t(producers) * perProducer) {
+        std::this_thread::yield();
+    }
+    auto secs = std::chrono::duration<double>(ChSteadyClock::now() - t0).count();
+    return double(producers) * perProducer / secs;
+}
+
+static double ProcessCpuSeconds() {
+#if defined(__unix__)
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec + (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+#else
+    return 0.0; // Not reported on this platform
+#endif
+}
+
+static void PrintPercentiles(const char* label, std::vector<ChNanos>& samples) {
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double p) { return samples[std::min(samples.size() - 1, size_t(p * samples.size()))].count() / 1e3; };
+    std::cout << label
+              << " p50=" << at(0.50) << "us"
+              << " p90=" << at(0.90) << "us"
+              << " p99=" << at(0.99) << "us"
+              << " max=" << samples.back().count() / 1e3 << "us" << std::endl;
+}
+
+static void BenchIdle(bool idleWait) {
+    core::ThreadCycler cycler;
+    cycler.SetIdleWait(idleWait);
+    cycler.Start();
+    cycler.AwaitStart();
+
+    auto cpu0 = ProcessCpuSeconds();
+    std::this_thread::sleep_for(std::chrono::seconds(1));
+    auto cpu1 = ProcessCpuSeconds();
+
+    std::vector<ChNanos> latencies;
+    for (uint32_t i{0}; i < 1000; i++) {
+        std::atomic_bool ran{false};
+        ChNanos latency{0};
+        auto t0 = ChSteadyClock::now();
+        cycler.EnqueueTask([&]() {
+            latency = ChSteadyClock::now() - t0;
+            ran.store(true);
+        });
+        while (!ran.load()) std::this_thread::yield();
+        latencies.push_back(latency);
+        std::this_thread::sleep_for(std::chrono::microseconds(500));
+    }
+    cycler.Stop(true);
+
+    std::cout << (idleWait ? "idle-wait" : "spin") << " idle cpu=" << (cpu1 - cpu0) * 100.0 << "%" << std::endl;
+    PrintPercentiles(idleWait ? "idle-wait wake latency" : "spin wake latency", latencies);
+}
+
+static void BenchTimer(ChNanos spinTail) {
+    std::vector<ChNanos> overshoot;
+    for (uint32_t i{0}; i < 500; i++) {
+        auto target = ChSteadyClock::now() + std::chrono::milliseconds(1);
+        utils::Uni_SleepUntil(target, spinTail);
+        overshoot.push_back(ChSteadyClock::now() - target);
+    }
+    std::string label = "timer spinTail=" + std::to_string(spinTail.count() / 1000) + "us overshoot";
+    PrintPercentiles(label.c_str(), overshoot);
+}
+
+// Cost of the per-cycle stats block, and a capped cycler's stats exported as CSV/JSON
+static void BenchStats() {
+    core::CycleStats stats;
+    constexpr uint32_t samples = 10000000;
+    auto t0 = ChSteadyClock::now();
+    for (uint32_t i{0}; i < samples; i++) {
+        stats.RecordCycle(ChNanos(1000 + (i & 0xFFFF)), ChNanos(i & 0xFFF), i & 7, i & 3, (i & 0xFF) == 0);
+    }
+    auto t1 = ChSteadyClock::now();
+    std::cout << "stats RecordCycle ns=" << double(std::chrono::duration_cast<ChNanos>(t1 - t0).count()) / samples << std::endl;
+
+    auto cycler = std::make_shared<core::ThreadCycler>();
+    cycler->SetCycleTimeCap(ChMillis(1));
+    cycler->Start();
+    cycler->AwaitStart();
+    auto work = cycler->CreateWork([]() {
+        static thread_local uint32_t n{0};
+        if (++n % 64 == 0) std::this_thread::sleep_for(ChMillis(2)); // Occasional overrun
+    });
+    std::this_thread::sleep_for(ChMillis(100));
+    auto before = cycler->GetStats();
+    for (uint32_t i{0}; i < 1000; i++) {
+        cycler->EnqueueTask([](){});
+    }
+    std::this_thread::sleep_for(ChMillis(300));
+    auto window = cycler->GetStats() - before;
+
+    // Dropping the work rebuilds the cycle's work snapshot, the cycler has to keep running without it
+    cycler->RemoveWork(work);
+    auto removed = cycler->GetStats();
+    std::this_thread::sleep_for(ChMillis(20));
+    if ((cycler->GetStats() - removed).cycles == 0) std::cout << "FAILED: cycler stalled after RemoveWork" << std::endl;
+    cycler->Stop(true);
+
+    std::cout << core::CycleStatsSnapshot::CsvHeader() << std::endl;
+    std::cout << window.ToCsvRow("capped_1ms") << std::endl;
+    std::cout << window.ToJson() << std::endl;
+}
+
+int main() {
+    for (uint32_t works : {1u, 100u, 10000u}) {
+        BenchWorks(works);
+    }
+
+    constexpr uint32_t perProducer = 100000;
+    for (uint32_t producers : {1u, 2u, 4u, 8u}) {
+        double mutexRate, inboxRate;
+        {
+            MutexInbox inbox;
+            mutexRate = BenchContention(inbox, producers, perProducer);
+        }
+        {
+            core::ThreadCycler cycler;
+            cycler.Start();
+            cycler.AwaitStart();
+            inboxRate = BenchContention(cycler, producers, perProducer);
+            cycler.Stop(true);
+        }
+        std::cout << "producers=" << producers
+                  << " mutex tasks/sec=" << mutexRate
+                  << " mpsc tasks/sec=" << inboxRate << std::endl;
+    }
+
+    BenchIdle(false);
+    BenchIdle(true);
+
+    for (auto tail : {ChNanos(0), ChNanos(50000), ChNanos(200000)}) {
+        BenchTimer(tail);
+    }
+
+    BenchStats();
+    return 0;
+}
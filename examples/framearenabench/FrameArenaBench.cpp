@@ -0,0 +1,134 @@
+// Frame arena benchmark: allocations per frame of RenderBatch::Record's container flow over 10k draw items,
+// std::deque per model (previous) vs. pmr containers on the gfx cycler's frame arena. Headless, no GPU.
+#include "axle/core/alloc/AX_FrameAllocator.hpp"
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <future>
+#include <iostream>
+#include <memory_resource>
+#include <new>
+#include <vector>
+
+using namespace axle;
+
+static std::atomic<uint64_t> g_Allocations{0};
+
+void* operator new(std::size_t size) {
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+// Same footprint as gfx::DrawCallContext (which needs glm to include)
+struct DrawItem {
+    uint32_t meshId, nodeId;
+    uint8_t meshMode;
+    uint32_t pipeline, vertices, indices, resources;
+    uint32_t vertexCount, indexCount, firstVertex, firstIndex;
+    uint32_t sortKey;
+};
+
+static constexpr uint32_t MODELS = 100;
+static constexpr uint32_t MESHES_PER_MODEL = 100;
+
+static bool ItemLess(const DrawItem& a, const DrawItem& b) {
+    if (a.pipeline != b.pipeline) return a.pipeline < b.pipeline;
+    return a.resources < b.resources;
+}
+
+static void Generate(uint32_t model, auto& out) {
+    for (uint32_t mesh{0}; mesh < MESHES_PER_MODEL; mesh++) {
+        out.push_back(DrawItem{mesh, model, 1, (model * 7 + mesh) % 13, mesh, mesh, (mesh * 3) % 17, 36, 36, 0, 0, 0});
+    }
+}
+
+static uint64_t RecordLegacy() {
+    std::vector<std::deque<DrawItem>> perModel(MODELS);
+    core::JobSystem::Global().ParallelFor(MODELS, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i{begin}; i < end; i++) Generate(i, perModel[i]);
+    }, 1);
+
+    std::deque<DrawItem> all;
+    for (auto& items : perModel) {
+        all.insert(all.end(), items.begin(), items.end());
+    }
+    std::sort(all.begin(), all.end(), ItemLess);
+    return all.size();
+}
+
+static uint64_t RecordFrameArena() {
+    auto* frameRes = core::ThreadCycler::CurrentFrameResource();
+
+    std::pmr::vector<std::pmr::vector<DrawItem>> perModel(MODELS, frameRes);
+    core::JobSystem::Global().ParallelFor(MODELS, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i{begin}; i < end; i++) Generate(i, perModel[i]);
+    }, 1);
+
+    size_t count{0};
+    for (auto& items : perModel) count += items.size();
+
+    std::pmr::vector<DrawItem> all(frameRes);
+    all.reserve(count);
+    for (auto& items : perModel) {
+        all.insert(all.end(), items.begin(), items.end());
+    }
+    std::sort(all.begin(), all.end(), ItemLess);
+    return all.size();
+}
+
+template <typename F>
+static void Bench(const char* name, core::ThreadCycler& gfx, F record) {
+    constexpr uint32_t frames = 200;
+    std::promise<void> done;
+    std::atomic<uint32_t> frame{0};
+    uint64_t a0{0}, a1{0}, items{0};
+    ChSteadyTimepoint t0, t1;
+
+    auto work = gfx.CreateWork([&]() {
+        auto f = frame.fetch_add(1);
+        if (f == 10) { a0 = g_Allocations.load(); t0 = ChSteadyClock::now(); } // Warm-up done, arena sized
+        if (f >= 10 && f < 10 + frames) items = record();
+        if (f == 10 + frames) {
+            a1 = g_Allocations.load();
+            t1 = ChSteadyClock::now();
+            done.set_value();
+        }
+        if (f < 10) record();
+    });
+    done.get_future().wait();
+    gfx.RemoveWork(work);
+
+    std::cout << name
+              << " items/frame=" << items
+              << " allocs/frame=" << double(a1 - a0) / frames
+              << " us/frame=" << std::chrono::duration<double, std::micro>(t1 - t0).count() / frames
+              << std::endl;
+}
+
+int main() {
+    core::JobSystem::Global(); // Spin up workers outside the measured window
+
+    auto gfx = std::make_shared<core::ThreadCycler>();
+    gfx->Start();
+    gfx->AwaitStart();
+
+    Bench("deque      ", *gfx, RecordLegacy);
+    Bench("frame arena", *gfx, RecordFrameArena);
+    std::cout << "(remaining allocations are JobSystem entries, one per ParallelFor chunk)" << std::endl;
+    std::cout << "arena overflows (warm-up growth)=" << gfx->GetFrameArena().GetOverflowCount()
+              << " capacity=" << gfx->GetFrameArena().GetCapacity() << std::endl;
+
+    gfx->Stop(true);
+    return 0;
+}
@@ -0,0 +1,178 @@
+// std::function vs. InplaceFunction/FunctionRef on the hot paths they replaced: draw-call sorting (RenderBatch::Record),
+// the per-mesh sort key callback, and enqueueing tasks that capture a handful of pointers (ThreadCycler/JobSystem).
+// DrawItem mirrors gfx::DrawCallContext and its default comparator; the gfx headers need the full backend to build.
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+
+#include "axle/utils/AX_InplaceFunction.hpp"
+#include "axle/utils/AX_MagicPool.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <future>
+#include <iostream>
+#include <new>
+#include <random>
+#include <vector>
+
+using namespace axle;
+
+static std::atomic<uint64_t> g_Allocations{0};
+
+void* operator new(std::size_t size) {
+    g_Allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size ? size : 1)) return ptr;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept { std::free(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { std::free(ptr); }
+
+struct PipelineTag {};
+struct BufferTag {};
+struct ResourceSetTag {};
+
+struct DrawItem {
+    uint32_t meshId, nodeId;
+    uint8_t meshMode;
+    utils::MagicHandleTagged<PipelineTag> pipeline;
+    utils::MagicHandleTagged<BufferTag> vertices, indices;
+    utils::MagicHandleTagged<ResourceSetTag> resources;
+    uint32_t vertexCount, indexCount;
+    uint32_t firstVertex{0}, firstIndex{0};
+    uint32_t sortKey{0};
+};
+
+const inline auto SORT_BY_MINIMAL_STATE = [](const DrawItem& a, const DrawItem& b) {
+    if (!(a.pipeline == b.pipeline)) return a.pipeline < b.pipeline;
+    if (!(a.resources == b.resources)) return a.resources < b.resources;
+    if (!(a.vertices == b.vertices)) return a.vertices < b.vertices;
+    if (!(a.indices == b.indices)) return a.indices < b.indices;
+    if (a.meshMode != b.meshMode) return a.meshMode < b.meshMode;
+    if (a.firstVertex != b.firstVertex) return a.firstVertex < b.firstVertex;
+    if (a.firstIndex != b.firstIndex) return a.firstIndex < b.firstIndex;
+    if (a.vertexCount != b.vertexCount) return a.vertexCount < b.vertexCount;
+    if (a.indexCount != b.indexCount) return a.indexCount < b.indexCount;
+    return a.sortKey < b.sortKey;
+};
+
+template <typename F>
+static double TimeMs(F&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+static void BenchSort(uint32_t count, uint32_t rounds) {
+    std::mt19937 rng(7);
+    std::vector<DrawItem> items(count);
+    for (auto& item : items) {
+        item.pipeline.index = rng() % 16;
+        item.resources.index = rng() % 256;
+        item.vertices.index = rng() % 1024;
+        item.indices.index = item.vertices.index;
+        item.meshMode = 1;
+        item.indexCount = rng() % 4096;
+    }
+
+    std::function<bool(const DrawItem&, const DrawItem&)> stdSort{SORT_BY_MINIMAL_STATE};
+    Predicate<DrawItem> inplaceSort{SORT_BY_MINIMAL_STATE};
+    Predicate<DrawItem> customSort{[](const DrawItem& a, const DrawItem& b) { return SORT_BY_MINIMAL_STATE(a, b); }};
+
+    auto run = [&](const char* label, auto sortOnce) {
+        std::vector<DrawItem> work;
+        double ms{0};
+        uint64_t allocs{0};
+        for (uint32_t r{0}; r < rounds; r++) {
+            work = items;
+            auto a0 = g_Allocations.load();
+            ms += TimeMs([&]() { sortOnce(work); });
+            allocs += g_Allocations.load() - a0;
+        }
+        std::cout << "  " << label << ": " << ms / rounds << " ms/sort, " << double(allocs) / rounds << " allocs/sort" << std::endl;
+    };
+
+    std::cout << "Draw-call sort, " << count << " items" << std::endl;
+    run("std::function (before)       ", [&](std::vector<DrawItem>& v) { std::sort(v.begin(), v.end(), stdSort); });
+    run("InplaceFunction, custom      ", [&](std::vector<DrawItem>& v) { std::sort(v.begin(), v.end(), std::cref(customSort)); });
+    run("InplaceFunction, Target()    ", [&](std::vector<DrawItem>& v) {
+        if (auto* cmp = inplaceSort.Target<std::remove_cvref_t<decltype(SORT_BY_MINIMAL_STATE)>>()) {
+            std::sort(v.begin(), v.end(), *cmp);
+        }
+    });
+}
+
+static void BenchSortKey(uint32_t calls) {
+    struct Params { const void* model; const void* node; uint32_t meshId; };
+    std::function<uint32_t(const Params&)> stdAssigner{[](const Params& p) { return p.meshId & 7u; }};
+    InplaceFunction<uint32_t(const Params&)> inplaceAssigner{[](const Params& p) { return p.meshId & 7u; }};
+
+    uint64_t sink{0};
+    double stdMs = TimeMs([&]() { for (uint32_t i{0}; i < calls; i++) sink += stdAssigner({nullptr, nullptr, i}); });
+    double inplaceMs = TimeMs([&]() { for (uint32_t i{0}; i < calls; i++) sink += inplaceAssigner({nullptr, nullptr, i}); });
+    std::cout << "Sort key callback, " << calls << " calls: std::function " << stdMs << " ms, InplaceFunction "
+              << inplaceMs << " ms (" << sink % 2 << ")" << std::endl;
+}
+
+// Lambda capturing four pointers, e.g. [this, &a, &b, counter]
+static void BenchEnqueue(uint32_t tasks) {
+    uint64_t a{0}, b{0}, c{0}, d{0};
+    uint64_t *pa{&a}, *pb{&b}, *pc{&c}, *pd{&d};
+
+    std::vector<std::function<void()>> stdQueue;
+    std::vector<VoidJob> inplaceQueue;
+    stdQueue.reserve(tasks);
+    inplaceQueue.reserve(tasks);
+
+    auto a0 = g_Allocations.load();
+    double stdMs = TimeMs([&]() {
+        for (uint32_t i{0}; i < tasks; i++) stdQueue.emplace_back([pa, pb, pc, pd]() { (*pa)++; (*pb) += *pc + *pd; });
+        for (auto& task : stdQueue) task();
+        stdQueue.clear();
+    });
+    auto stdAllocs = g_Allocations.load() - a0;
+
+    a0 = g_Allocations.load();
+    double inplaceMs = TimeMs([&]() {
+        for (uint32_t i{0}; i < tasks; i++) inplaceQueue.emplace_back([pa, pb, pc, pd]() { (*pa)++; (*pb) += *pc + *pd; });
+        for (auto& task : inplaceQueue) task();
+        inplaceQueue.clear();
+    });
+    auto inplaceAllocs = g_Allocations.load() - a0;
+
+    std::cout << "Enqueue+run " << tasks << " 4-pointer tasks: std::function " << stdMs << " ms / " << stdAllocs
+              << " allocs, InplaceFunction " << inplaceMs << " ms / " << inplaceAllocs << " allocs" << std::endl;
+}
+
+// ThreadInvocation::SyncCall with a 4-pointer lambda: previously copied its std::function into the inbox
+static void BenchSyncCall(uint32_t calls) {
+    auto cycler = std::make_shared<core::ThreadCycler>();
+    cycler->Start();
+    cycler->AwaitStart();
+
+    uint64_t a{0}, b{0}, c{0}, d{0};
+    uint64_t *pa{&a}, *pb{&b}, *pc{&c}, *pd{&d};
+
+    auto a0 = g_Allocations.load();
+    double ms = TimeMs([&]() {
+        for (uint32_t i{0}; i < calls; i++) {
+            core::ThreadInvocation<uint64_t>(cycler, [pa, pb, pc, pd]() { return ++(*pa) + *pb + *pc + *pd; }).SyncCall();
+        }
+    });
+    auto allocs = g_Allocations.load() - a0;
+    cycler->Stop(true);
+    std::cout << "ThreadInvocation::SyncCall, 4-pointer lambda: " << ms * 1000.0 / calls << " us/call, "
+              << double(allocs) / calls << " allocs/call (promise state included)" << std::endl;
+}
+
+int main() {
+    BenchSort(10000, 50);
+    BenchSort(100000, 10);
+    BenchSortKey(10000000);
+    BenchEnqueue(1000000);
+    BenchSyncCall(20000);
+    return 0;
+}
@@ -0,0 +1,156 @@
+// ConcurrentMagicPool stress: producer threads reserve handles and either release them or hand them to an owner
+// thread that makes them live, uses and destroys them. A small pool forces heavy index reuse; every reservation
+// is checked for a unique (index, generation) and for a generation newer than the last holder of that index.
+#include "axle/utils/AX_ConcurrentMagicPool.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <iostream>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+using namespace axle;
+
+struct ResHandle : public utils::MagicHandle {};
+
+struct ResIntern : public utils::MagicInternal<ResHandle> {
+    uint64_t payload{0};
+};
+
+using Pool = utils::ConcurrentMagicPool<ResIntern, 64, 64>; // 4096 slots
+
+static constexpr uint32_t PRODUCERS = 8;
+static constexpr uint32_t RESERVES_PER_PRODUCER = 200000;
+static constexpr size_t MAX_LIVE = 1024;
+
+static std::atomic<uint64_t> s_Claimed[Pool::CAPACITY]{}; // generation + 1 while held
+static std::atomic<int64_t> s_LastGeneration[Pool::CAPACITY]{};
+static std::atomic<uint64_t> s_Failures{0};
+
+static void Fail(const char* what, const ResHandle& h) {
+    if (s_Failures.fetch_add(1) < 10) {
+        std::cerr << "FAIL: " << what << " index=" << h.index << " generation=" << h.generation << std::endl;
+    }
+}
+
+static void Claim(const ResHandle& h) {
+    uint64_t expected{0};
+    if (!s_Claimed[h.index].compare_exchange_strong(expected, uint64_t(h.generation) + 1)) {
+        Fail("handle handed out twice", h);
+    }
+    if (s_LastGeneration[h.index].exchange(h.generation) >= int64_t(h.generation)) {
+        Fail("generation not advanced on reuse", h);
+    }
+}
+
+// Must run before Delete(), a reuse may be reserved right after it
+static void Unclaim(const ResHandle& h) {
+    s_Claimed[h.index].store(0);
+}
+
+int main() {
+    for (auto& gen : s_LastGeneration) gen.store(-1);
+
+    Pool pool;
+    std::mutex queueMutex;
+    std::deque<ResHandle> queue;
+    std::atomic<uint32_t> producersDone{0};
+    std::atomic<uint64_t> released{0}, exhausted{0};
+
+    auto t0 = ChSteadyClock::now();
+
+    std::vector<std::thread> producers;
+    for (uint32_t p{0}; p < PRODUCERS; p++) {
+        producers.emplace_back([&, p]() {
+            std::mt19937 rng(p + 1);
+            for (uint32_t i{0}; i < RESERVES_PER_PRODUCER; i++) {
+                ResHandle h = pool.ReserveHandle();
+                while (h.index == UINT32_MAX) {
+                    exhausted.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                    h = pool.ReserveHandle();
+                }
+                Claim(h);
+                if (!pool.IsReserved(h) || pool.IsValid(h)) Fail("fresh handle not in reserved state", h);
+
+                if (rng() % 4 == 0) {
+                    // Loader gave up before upload
+                    Unclaim(h);
+                    if (!pool.ReleaseReservation(h)) Fail("release of reserved handle failed", h);
+                    if (pool.IsReserved(h) || pool.ReleaseReservation(h)) Fail("released handle still usable", h);
+                    released.fetch_add(1, std::memory_order_relaxed);
+                } else {
+                    std::lock_guard<std::mutex> lock(queueMutex);
+                    queue.push_back(h);
+                }
+            }
+            producersDone.fetch_add(1);
+        });
+    }
+
+    // Owner thread: make live, check, retire the oldest past MAX_LIVE
+    uint64_t acquired{0}, destroyed{0};
+    std::thread owner([&]() {
+        std::deque<ResHandle> live;
+        std::vector<ResHandle> batch;
+        auto destroy = [&](const ResHandle& h) {
+            auto* res = pool.Get(h);
+            if (!res || res->payload != (uint64_t(h.index) << 32 | h.generation)) Fail("live payload mismatch", h);
+            Unclaim(h);
+            if (!pool.Delete(h)) Fail("delete of live handle failed", h);
+            if (pool.IsValid(h) || pool.Get(h) || pool.Acquire(h) || pool.Delete(h)) Fail("stale handle still resolves", h);
+            destroyed++;
+        };
+        while (true) {
+            bool done = producersDone.load() == PRODUCERS;
+            batch.clear();
+            {
+                std::lock_guard<std::mutex> lock(queueMutex);
+                batch.assign(queue.begin(), queue.end());
+                queue.clear();
+            }
+            if (batch.empty()) {
+                if (done) break;
+                std::this_thread::yield();
+                continue;
+            }
+            for (auto& h : batch) {
+                auto* res = pool.Acquire(h);
+                if (!res || res->index != h.index || res->generation != h.generation || res->payload != 0) {
+                    Fail("acquire of reserved handle failed", h);
+                    continue;
+                }
+                if (pool.Acquire(h) || !pool.IsValid(h)) Fail("double acquire", h);
+                if (pool.ReleaseReservation(h)) Fail("reservation release freed a live handle", h);
+                res->payload = uint64_t(h.index) << 32 | h.generation;
+                res->Sign();
+                live.push_back(h);
+                acquired++;
+                while (live.size() > MAX_LIVE) {
+                    destroy(live.front());
+                    live.pop_front();
+                }
+            }
+        }
+        for (auto& h : live) destroy(h);
+    });
+
+    for (auto& t : producers) t.join();
+    owner.join();
+
+    double ms = std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+    uint64_t total = uint64_t(PRODUCERS) * RESERVES_PER_PRODUCER;
+    std::cout << PRODUCERS << " producers, " << total << " reservations over " << Pool::CAPACITY << " slots in " << ms << "ms ("
+              << (total / ms * 1000.0 / 1e6) << " M/s): released=" << released << " acquired=" << acquired
+              << " destroyed=" << destroyed << " exhausted-retries=" << exhausted << " high-water=" << pool.GetHighWater() << std::endl;
+
+    if (released + acquired != total || acquired != destroyed) Fail("handle accounting mismatch", {});
+    uint64_t failures = s_Failures.load();
+    std::cout << (failures ? "FAILED: " : "OK: ") << failures << " failures" << std::endl;
+    return failures ? 1 : 0;
+}
@@ -751,7 +751,7 @@ void InitRender(RenderData& rdrData) {
         .stage = gfx::RLStage::Normal,
         .sortKey = 0
     };
-    layers->CreateLayer(rlDesc);
+    layers->CreateLayer(std::move(rlDesc));
     layers->RegisterWork(ExpectOrThrow(gbgfx->GetSwapchainFramebuffer(0)), rdrData.gfxThread);
 }
 
@@ -0,0 +1,57 @@
+// CPU-only scaling check for core::JobSystem, runs the same workload on 1..N workers
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#define JS_ITEMS 4096
+#define JS_ITERS 2048
+#define JS_REPEAT 5
+
+using namespace axle;
+
+static float Workload(uint32_t seed) {
+    float acc = static_cast<float>(seed);
+    for (uint32_t i{0}; i < JS_ITERS; i++) {
+        acc = std::sin(acc) * 0.5f + std::sqrt(static_cast<float>(i + seed));
+    }
+    return acc;
+}
+
+int main() {
+    auto hw = std::max(1u, std::thread::hardware_concurrency());
+
+    std::vector<float> out(JS_ITEMS);
+    double baseline{0.0};
+
+    for (uint32_t threads{1}; threads <= hw; threads++) {
+        // The calling thread helps inside ParallelFor, so N threads means N - 1 workers
+        core::JobSystem jobs(threads > 1 ? threads - 1 : 1);
+
+        auto best = ChNanos::max();
+        for (uint32_t r{0}; r < JS_REPEAT; r++) {
+            auto begin = ChSteadyClock::now();
+            if (threads == 1) {
+                for (uint32_t i{0}; i < JS_ITEMS; i++) out[i] = Workload(i);
+            } else {
+                jobs.ParallelFor(JS_ITEMS, [&](uint32_t b, uint32_t e) {
+                    for (uint32_t i{b}; i < e; i++) out[i] = Workload(i);
+                });
+            }
+            best = std::min(best, std::chrono::duration_cast<ChNanos>(ChSteadyClock::now() - begin));
+        }
+
+        double ms = best.count() / 1e6;
+        if (threads == 1) baseline = ms;
+        std::cout << "threads=" << threads
+                  << " time=" << ms << "ms"
+                  << " speedup=" << baseline / ms << "x" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,173 @@
+// Load time and peak memory of large asset files read through FileDataStream (copied into heap buffers, the
+// previous loader path) against MMapDataStream (buffers share the file mapping). Each run happens in a forked
+// child so VmHWM is per-run; files are read once up front so both variants start from a warm page cache.
+// "consume" touches every byte like an upload would.
+#include "axle/audio/data/AX_AudioWAV.hpp"
+#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/data/AX_DataStreamImplMMap.hpp"
+#include "axle/graphics/image/AX_ImageLoader.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+using namespace axle;
+
+static constexpr uint32_t WAV_BYTES = 256u << 20;
+static constexpr uint32_t OGG_BYTES = 128u << 20;
+static constexpr uint32_t ASTC_BYTES = 256u << 20;
+
+static void WriteFile(const std::filesystem::path& path, const void* header, size_t headerSize, size_t payload) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    out.write(static_cast<const char*>(header), std::streamsize(headerSize));
+    std::vector<char> chunk(1u << 20);
+    for (size_t i{0}; i < chunk.size(); i++) chunk[i] = char(i * 31);
+    for (size_t done{0}; done < payload; done += chunk.size()) {
+        out.write(chunk.data(), std::streamsize(std::min(chunk.size(), payload - done)));
+    }
+}
+
+static void GenerateFiles(const std::filesystem::path& dir) {
+    std::filesystem::create_directories(dir);
+
+    uint8_t wav[44]{};
+    uint16_t format = 1, channels = 2, blockAlign = 4, bits = 16;
+    uint32_t fmtSize = 16, rate = 48000, byteRate = rate * blockAlign, dataSize = WAV_BYTES, riffSize = 36 + WAV_BYTES;
+    std::memcpy(wav, "RIFF", 4); std::memcpy(wav + 4, &riffSize, 4); std::memcpy(wav + 8, "WAVE", 4);
+    std::memcpy(wav + 12, "fmt ", 4); std::memcpy(wav + 16, &fmtSize, 4);
+    std::memcpy(wav + 20, &format, 2); std::memcpy(wav + 22, &channels, 2);
+    std::memcpy(wav + 24, &rate, 4); std::memcpy(wav + 28, &byteRate, 4);
+    std::memcpy(wav + 32, &blockAlign, 2); std::memcpy(wav + 34, &bits, 2);
+    std::memcpy(wav + 36, "data", 4); std::memcpy(wav + 40, &dataSize, 4);
+    WriteFile(dir / "big.wav", wav, sizeof(wav), WAV_BYTES);
+
+    const char ogg[4] = {'O', 'g', 'g', 'S'};
+    WriteFile(dir / "big.ogg", ogg, sizeof(ogg), OGG_BYTES);
+
+    // 8192x8192 blocks of 4x4 texels, 16 bytes each (a KTX-sized compressed texture)
+    uint8_t astc[16] = {0x13, 0xAB, 0xA1, 0x5C, 4, 4, 1, 0x00, 0x80, 0x00, 0x00, 0x80, 0x00, 1, 0, 0};
+    WriteFile(dir / "big.astc", astc, sizeof(astc), ASTC_BYTES);
+}
+
+static uint64_t ReadStatusKiB(const char* key) {
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    size_t keyLen = std::strlen(key);
+    while (std::getline(status, line)) {
+        if (line.compare(0, keyLen, key) == 0) return std::stoull(line.substr(keyLen + 1));
+    }
+    return 0;
+}
+
+static uint64_t Consume(const utils::URaw& bytes) {
+    uint64_t sum{0};
+    for (size_t i{0}; i < bytes.size(); i += 64) sum += bytes[i];
+    return sum;
+}
+
+// Loads the asset from `stream` and returns its payload
+using Loader = std::function<utils::URaw(data::IDataStream& stream)>;
+
+static void RunChild(const char* label, const std::function<std::unique_ptr<data::IDataStream>()>& makeStream, const Loader& load) {
+    uint64_t hwmBefore = ReadStatusKiB("VmHWM:");
+
+    auto t0 = ChSteadyClock::now();
+    auto stream = makeStream();
+    if (stream->Open().IsValid()) {
+        std::cout << "  " << label << ": open failed" << std::endl;
+        std::exit(1);
+    }
+    utils::URaw payload = load(*stream);
+    auto t1 = ChSteadyClock::now();
+    uint64_t sum = Consume(payload);
+    auto t2 = ChSteadyClock::now();
+
+    uint64_t anonKiB = ReadStatusKiB("RssAnon:");
+    uint64_t hwmKiB = ReadStatusKiB("VmHWM:");
+    double loadMs = std::chrono::duration<double, std::milli>(t1 - t0).count();
+    double totalMs = std::chrono::duration<double, std::milli>(t2 - t0).count();
+
+    std::cout << "  " << label << ": load " << loadMs << " ms, load+consume " << totalMs << " ms, "
+              << "peak RSS +" << (hwmKiB - hwmBefore) / 1024 << " MiB, anon RSS " << anonKiB / 1024 << " MiB"
+              << (sum == 0 ? " (empty?)" : "") << std::endl;
+}
+
+static void Run(const char* label, const std::function<std::unique_ptr<data::IDataStream>()>& makeStream, const Loader& load) {
+#if defined(__linux__)
+    std::cout.flush();
+    pid_t pid = fork();
+    if (pid == 0) {
+        RunChild(label, makeStream, load);
+        std::cout.flush();
+        _exit(0);
+    }
+    int status{0};
+    waitpid(pid, &status, 0);
+#else
+    RunChild(label, makeStream, load);
+#endif
+}
+
+static void Compare(const char* asset, const std::filesystem::path& path, const Loader& load) {
+    std::cout << asset << " (" << std::filesystem::file_size(path) / (1024 * 1024) << " MiB)" << std::endl;
+    Run("FileDataStream", [&]() { return std::make_unique<data::FileDataStream>(path, true, false); }, load);
+    Run("MMapDataStream", [&]() { return std::make_unique<data::MMapDataStream>(path, data::MMapAdvice::Sequential); }, load);
+}
+
+static utils::URaw Require(utils::ExResult<utils::URaw> res) {
+    if (!res.has_value()) {
+        std::cout << "  load failed: " << res.error().GetMessage() << std::endl;
+        std::exit(1);
+    }
+    return std::move(res.value());
+}
+
+int main() {
+    auto dir = std::filesystem::temp_directory_path() / "axle_mmapbench";
+    GenerateFiles(dir);
+    for (const char* name : {"big.wav", "big.ogg", "big.astc"}) {
+        data::MMapDataStream warm(dir / name);
+        if (warm.Open().IsNoError()) Consume(warm.Share(0, warm.GetLength()));
+    }
+
+    Compare("WAV", dir / "big.wav", [](data::IDataStream& stream) {
+        auto wav = audio::WAV_LoadFileBytes(stream);
+        return Require(wav.has_value() ? utils::ExResult<utils::URaw>(std::move(wav.value().samples)) : wav.error());
+    });
+
+    // The OGG loader keeps the whole container for the streaming decoder
+    Compare("OGG-like", dir / "big.ogg", [](data::IDataStream& stream) {
+        return Require(stream.ReadShared(stream.GetLength()));
+    });
+
+    Compare("ASTC", dir / "big.astc", [](data::IDataStream& stream) {
+        auto img = gfx::Img_ASTC_LoadFileBytes(stream);
+        return Require(img.has_value() ? utils::ExResult<utils::URaw>(std::move(img.value().data)) : img.error());
+    });
+
+    // Buffers shared out of the mapping outlive the stream and are detached on write
+    utils::URaw kept;
+    {
+        data::MMapDataStream stream(dir / "big.ogg");
+        if (stream.Open().IsValid()) return 1;
+        kept = stream.Share(0, 4);
+    }
+    bool ok = kept.size() == 4 && std::memcmp(kept.data(), "OggS", 4) == 0;
+    kept.MakeMutable()[0] = 'X';
+    ok = ok && kept[0] == 'X' && !kept.Buffer().IsExternal();
+
+    std::filesystem::remove_all(dir);
+    std::cout << (ok ? "ALL OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
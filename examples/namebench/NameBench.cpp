@@ -0,0 +1,111 @@
+// String keys vs. interned NameIds on the paths that were switched over: resolving ResourceBinding::bindPoint
+// in a shader's resIdByName, building the GL name of an array element ("name[i]") on a binding cache miss,
+// MetadataMap lookups by literal, and copying node names. Also interning throughput across threads.
+#include "axle/utils/AX_NameId.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+using namespace axle;
+
+template <typename F>
+static double NsPer(uint64_t count, F&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::nano>(ChSteadyClock::now() - t0).count() / count;
+}
+
+int main() {
+    bool ok = true;
+    uint64_t sink{0};
+
+    // A shader with 24 resources, a material binding 8 of them
+    std::vector<std::string> resourceNames;
+    for (int i{0}; i < 24; i++) resourceNames.push_back("_res_materialResource_" + std::to_string(i));
+
+    std::unordered_map<std::string, uint32_t> byString;
+    std::unordered_map<utils::NameId, uint32_t> byName;
+    for (uint32_t i{0}; i < resourceNames.size(); i++) {
+        byString.emplace(resourceNames[i], i);
+        byName.emplace(utils::NameId(resourceNames[i]), i);
+    }
+    std::vector<std::string> bindPointsString;
+    std::vector<utils::NameId> bindPointsName;
+    for (int i{0}; i < 8; i++) {
+        bindPointsString.push_back(resourceNames[i * 3]);
+        bindPointsName.push_back(utils::NameId(resourceNames[i * 3]));
+    }
+
+    constexpr uint32_t ROUNDS = 1000000;
+    const uint64_t lookups = uint64_t(ROUNDS) * bindPointsName.size();
+
+    std::cout << "resIdByName lookup, ns/binding" << std::endl;
+    double strFind = NsPer(lookups, [&]() {
+        for (uint32_t r{0}; r < ROUNDS; r++)
+            for (auto& bp : bindPointsString) sink += byString.find(bp)->second;
+    });
+    double nameFind = NsPer(lookups, [&]() {
+        for (uint32_t r{0}; r < ROUNDS; r++)
+            for (auto& bp : bindPointsName) sink += byName.find(bp)->second;
+    });
+    std::cout << "  std::string=" << strFind << " NameId=" << nameFind << std::endl;
+
+    std::cout << "array element GL name \"bindPoint[i]\", ns/name" << std::endl;
+    constexpr uint32_t ELEMENTS = 200000;
+    double strConcat = NsPer(ELEMENTS, [&]() {
+        for (uint32_t i{0}; i < ELEMENTS; i++) {
+            std::string glName = bindPointsString[i & 7] + "[" + std::to_string(i & 15) + "]";
+            sink += glName.size();
+        }
+    });
+    double nameIndexed = NsPer(ELEMENTS, [&]() {
+        for (uint32_t i{0}; i < ELEMENTS; i++) sink += bindPointsName[i & 7].Indexed(i & 15).View().size();
+    });
+    std::cout << "  concat=" << strConcat << " Indexed (interned after first use)=" << nameIndexed << std::endl;
+    ok &= bindPointsName[0].Indexed(3) == "_res_materialResource_0[3]";
+
+    std::cout << "MetadataMap lookup by literal, ns/lookup" << std::endl;
+    std::unordered_map<std::string, int> metaString{{"author", 1}, {"generator", 2}, {"unitScale", 3}, {"upAxis", 4}};
+    std::unordered_map<utils::NameId, int> metaName{{"author", 1}, {"generator", 2}, {"unitScale", 3}, {"upAxis", 4}};
+    double metaStr = NsPer(ROUNDS, [&]() { for (uint32_t i{0}; i < ROUNDS; i++) sink += metaString.find("unitScale")->second; });
+    double metaNm = NsPer(ROUNDS, [&]() { for (uint32_t i{0}; i < ROUNDS; i++) sink += metaName.find(AX_NAME("unitScale"))->second; });
+    std::cout << "  std::string=" << metaStr << " AX_NAME=" << metaNm << std::endl;
+
+    std::cout << "node name copy, ns/copy" << std::endl;
+    std::string longName = "Armature|mixamorig:LeftHandIndex3_end";
+    utils::NameId longId(longName);
+    double strCopy = NsPer(ROUNDS, [&]() { for (uint32_t i{0}; i < ROUNDS; i++) { std::string c = longName; sink += c.size(); } });
+    double idCopy = NsPer(ROUNDS, [&]() { for (uint32_t i{0}; i < ROUNDS; i++) { utils::NameId c = longId; sink += c.Index(); } });
+    std::cout << "  std::string=" << strCopy << " NameId=" << idCopy << std::endl;
+
+    std::cout << "interning, 4 threads, ns/call" << std::endl;
+    constexpr uint32_t PER_THREAD = 50000;
+    std::vector<std::string> fresh;
+    for (uint32_t i{0}; i < PER_THREAD; i++) fresh.push_back("node_" + std::to_string(i));
+    std::vector<std::vector<utils::NameId>> results(4);
+    auto internAll = [&]() {
+        std::vector<std::thread> threads;
+        for (uint32_t t{0}; t < 4; t++) {
+            threads.emplace_back([&, t]() {
+                results[t].clear();
+                for (auto& text : fresh) results[t].push_back(utils::NameId(text));
+            });
+        }
+        for (auto& th : threads) th.join();
+    };
+    double internNew = NsPer(4 * PER_THREAD, internAll);
+    double internExisting = NsPer(4 * PER_THREAD, internAll);
+    for (uint32_t t{1}; t < 4; t++) ok &= results[t] == results[0];
+    ok &= results[0][123] == "node_123" && utils::NameId::Find("node_123").has_value() && !utils::NameId::Find("node_x").has_value();
+    std::cout << "  new (racing on the same names)=" << internNew << " existing=" << internExisting
+              << ", table names=" << utils::NameId::Count() << std::endl;
+
+    ok &= utils::NameId("") == utils::NameId{} && utils::NameId("ROOT") == AX_NAME("ROOT");
+    std::cout << "(" << sink % 2 << ") " << (ok ? "ALL OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
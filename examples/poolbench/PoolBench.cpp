@@ -0,0 +1,102 @@
+// PoolAllocator throughput at 1-32 threads: malloc/free vs. the previous single-slab pool (behind a mutex,
+// it was not thread-safe) vs. the magazine pool. Each thread allocates a batch of objects, touches them, frees them.
+#include "axle/core/alloc/AX_PoolAllocator.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <barrier>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+using namespace axle;
+
+static constexpr size_t OBJECT_SIZE = 96; // ~ a scene node / draw item
+static constexpr uint32_t BATCH = 512;
+static constexpr uint32_t ROUNDS = 400;
+
+// The pool as it was: one malloc'd slab, std::vector<void*> free list
+class LegacyPool {
+private:
+    void* m_memory;
+    std::vector<void*> m_freeList;
+    std::mutex m_Mutex{};
+public:
+    LegacyPool(size_t objectSize, size_t capacity) {
+        m_memory = std::malloc(objectSize * capacity);
+        for (size_t i = 0; i < capacity; i++) {
+            m_freeList.push_back((char*)m_memory + i * objectSize);
+        }
+    }
+    ~LegacyPool() { std::free(m_memory); }
+
+    void* Allocate() {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        if (m_freeList.empty()) return nullptr;
+        void* ptr = m_freeList.back();
+        m_freeList.pop_back();
+        return ptr;
+    }
+    void Free(void* ptr) {
+        std::lock_guard<std::mutex> lock(m_Mutex);
+        m_freeList.push_back(ptr);
+    }
+};
+
+template <typename Alloc, typename Free>
+static double OpsPerSec(uint32_t threads, Alloc alloc, Free release) {
+    std::barrier sync(threads + 1);
+    std::vector<std::thread> workers;
+    for (uint32_t t{0}; t < threads; t++) {
+        workers.emplace_back([&]() {
+            std::vector<void*> objects(BATCH);
+            sync.arrive_and_wait();
+            for (uint32_t r{0}; r < ROUNDS; r++) {
+                for (auto& obj : objects) {
+                    obj = alloc();
+                    std::memset(obj, 0xAB, 16);
+                }
+                for (auto* obj : objects) release(obj);
+            }
+            sync.arrive_and_wait();
+        });
+    }
+    sync.arrive_and_wait();
+    auto t0 = ChSteadyClock::now();
+    sync.arrive_and_wait();
+    auto t1 = ChSteadyClock::now();
+    for (auto& w : workers) w.join();
+
+    double ops = 2.0 * threads * BATCH * ROUNDS;
+    return ops / std::chrono::duration<double>(t1 - t0).count();
+}
+
+int main() {
+    std::cout << "object=" << OBJECT_SIZE << "B batch=" << BATCH << " Mops/sec" << std::endl;
+    for (uint32_t threads : {1u, 2u, 4u, 8u, 16u, 32u}) {
+        double mallocRate = OpsPerSec(threads,
+            []() { return std::malloc(OBJECT_SIZE); },
+            [](void* p) { std::free(p); });
+
+        LegacyPool legacy(OBJECT_SIZE, size_t(threads) * BATCH);
+        double legacyRate = OpsPerSec(threads,
+            [&]() { return legacy.Allocate(); },
+            [&](void* p) { legacy.Free(p); });
+
+        core::PoolAllocator pool(OBJECT_SIZE, 4096, 16);
+        double poolRate = OpsPerSec(threads,
+            [&]() { return pool.Allocate(); },
+            [&](void* p) { pool.Free(p); });
+
+        std::cout << "threads=" << threads
+                  << " malloc=" << mallocRate / 1e6
+                  << " legacy_pool=" << legacyRate / 1e6
+                  << " pool=" << poolRate / 1e6
+                  << " (pool capacity " << pool.GetCapacity() << ")" << std::endl;
+    }
+    return 0;
+}
@@ -0,0 +1,147 @@
+// Memory peak of importing and uploading a large scene. The import result is cached by the scene, every mesh
+// upload captures its vertex/index AssetBuffers by value into a render-thread job (like AssetGpu::UploadMaterials
+// captures its desc), and a batch of ShaderDescs is copied into a pipeline cache. Deep-copying CowSpans made each
+// of those steps duplicate the bytes; shared buffers only bump refcounts.
+#include "axle/assets/AX_AssetImporter.hpp"
+#include "axle/graphics/AX_GraphicsParams.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <new>
+#include <vector>
+
+using namespace axle;
+
+// Live/peak heap bytes; the size rides in a header in front of each block
+static std::atomic<int64_t> g_Live{0};
+static std::atomic<int64_t> g_Peak{0};
+
+static constexpr size_t HEADER = alignof(std::max_align_t);
+
+void* operator new(std::size_t size) {
+    auto* base = static_cast<unsigned char*>(std::malloc(size + HEADER));
+    if (!base) throw std::bad_alloc();
+    std::memcpy(base, &size, sizeof(size));
+    int64_t live = g_Live.fetch_add(int64_t(size), std::memory_order_relaxed) + int64_t(size);
+    int64_t peak = g_Peak.load(std::memory_order_relaxed);
+    while (live > peak && !g_Peak.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+    return base + HEADER;
+}
+
+void operator delete(void* ptr) noexcept {
+    if (!ptr) return;
+    auto* base = static_cast<unsigned char*>(ptr) - HEADER;
+    std::size_t size;
+    std::memcpy(&size, base, sizeof(size));
+    g_Live.fetch_sub(int64_t(size), std::memory_order_relaxed);
+    std::free(base);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept { operator delete(ptr); }
+
+static double MiB(int64_t bytes) { return double(bytes) / (1024.0 * 1024.0); }
+
+static constexpr uint32_t MESHES = 64;
+static constexpr size_t VERTEX_BYTES = 1u << 20;
+static constexpr size_t INDEX_BYTES = 256u << 10;
+static constexpr uint32_t SHADERS = 16;
+static constexpr size_t SHADER_MODULE_BYTES = 512u << 10;
+
+static assets::AssetImportResult ImportScene() {
+    std::vector<assets::AssetBuffer> buffers;
+    std::vector<assets::AssetMesh> meshes;
+    for (uint32_t i{0}; i < MESHES; i++) {
+        assets::AssetBuffer vertices{};
+        vertices.type = assets::AssetBufferType::Vertex;
+        vertices.stride = 32;
+        vertices.count = VERTEX_BYTES / 32;
+        vertices.raw = {std::vector<uint8_t>(VERTEX_BYTES, uint8_t(i))};
+
+        assets::AssetBuffer indices{};
+        indices.type = assets::AssetBufferType::Index;
+        indices.stride = 4;
+        indices.count = INDEX_BYTES / 4;
+        indices.raw = {std::vector<uint8_t>(INDEX_BYTES, uint8_t(i))};
+
+        assets::AssetMesh mesh{};
+        mesh.vertexBufferIdx = uint32_t(buffers.size());
+        buffers.push_back(std::move(vertices));
+        mesh.indexBufferIdx = uint32_t(buffers.size());
+        buffers.push_back(std::move(indices));
+        mesh.materialIdx = 0;
+        meshes.push_back(std::move(mesh));
+    }
+
+    assets::AssetImportResult result;
+    result.buffers = {std::move(buffers)};
+    result.meshes = {std::move(meshes)};
+    return result;
+}
+
+static gfx::ShaderDesc LoadShader(uint32_t seed) {
+    std::vector<gfx::ShaderModuleDesc> modules;
+    for (const char* name : {"vert", "frag", "shadow"}) {
+        gfx::ShaderModuleDesc module;
+        module.modName = name;
+        module.codeBlob = {std::vector<uint8_t>(SHADER_MODULE_BYTES, uint8_t(seed))};
+        modules.push_back(std::move(module));
+    }
+    gfx::ShaderDesc desc{};
+    desc.modules = {std::move(modules)};
+    return desc;
+}
+
+int main() {
+    auto t0 = ChSteadyClock::now();
+
+    auto imported = ImportScene();
+    std::vector<gfx::ShaderDesc> loadedShaders;
+    for (uint32_t i{0}; i < SHADERS; i++) loadedShaders.push_back(LoadShader(i));
+
+    int64_t sourceBytes = g_Live.load();
+    g_Peak.store(sourceBytes);
+
+    // The scene keeps the import around for node instancing and re-uploads
+    assets::AssetImportResult sceneCache = imported;
+
+    std::vector<VoidJob> renderQueue;
+    uint64_t uploaded{0};
+    for (uint32_t i{0}; i < imported.meshes.size(); i++) {
+        const auto& mesh = imported.meshes[i];
+        assets::AssetBuffer vertices = imported.buffers[mesh.vertexBufferIdx];
+        assets::AssetBuffer indices = imported.buffers[mesh.indexBufferIdx];
+        renderQueue.emplace_back([vertices, indices, &uploaded]() {
+            uploaded += vertices.raw.size() + indices.raw.size();
+        });
+    }
+
+    // Pipeline cache keyed by shader, as RPShaderManager holds on to its descs
+    std::vector<gfx::ShaderDesc> pipelineCache;
+    for (const auto& desc : loadedShaders) pipelineCache.push_back(desc);
+
+    for (auto& job : renderQueue) job();
+    renderQueue.clear();
+
+    double ms = std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+    int64_t overhead = g_Peak.load() - sourceBytes;
+
+    std::cout << "scene: " << MESHES << " meshes, " << SHADERS << " shaders, source data " << MiB(sourceBytes) << " MiB" << std::endl;
+    std::cout << "  upload path peak above source: " << MiB(overhead) << " MiB, uploaded " << MiB(int64_t(uploaded)) << " MiB" << std::endl;
+    std::cout << "  import+upload time: " << ms << " ms" << std::endl;
+
+    // Copy-on-write: detaching one shared vertex buffer copies only that buffer, the cache keeps its bytes
+    int64_t before = g_Live.load();
+    auto edited = sceneCache.buffers[0];
+    edited.raw.MakeMutable()[0] = 0xFF;
+    bool ok = sceneCache.buffers[0].raw[0] == 0 && edited.raw[0] == 0xFF;
+    std::cout << "  MakeMutable on a shared vertex buffer: +" << MiB(g_Live.load() - before) << " MiB, "
+              << "cache untouched=" << (ok ? "yes" : "NO") << std::endl;
+
+    std::cout << (ok ? "ALL OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
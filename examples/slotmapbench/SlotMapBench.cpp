@@ -0,0 +1,144 @@
+// MagicPool vs. MagicSlotMap with 1M handles: insert, lookup, iterate after erasing half, erase the rest;
+// ordered insert-after/erase (MagicPool scans m_Order, so that part uses fewer handles); SoA hot-field iteration.
+#include "axle/utils/AX_MagicSlotMap.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace axle;
+
+struct ItemHandle : public utils::MagicHandle {};
+
+// Typical backend object: a hot value plus cold bookkeeping
+struct Item {
+    float value{0};
+    uint64_t cold[7]{};
+};
+
+struct ItemSlot : public utils::MagicInternal<ItemHandle> {
+    Item item{};
+};
+
+static double Ms(ChSteadyTimepoint t0) {
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+int main() {
+    constexpr uint32_t N = 1000000;
+    std::mt19937 rng(3);
+
+    std::vector<uint32_t> shuffled(N);
+    std::iota(shuffled.begin(), shuffled.end(), 0u);
+    std::shuffle(shuffled.begin(), shuffled.end(), rng);
+
+    // MagicPool
+    {
+        utils::MagicPool<ItemSlot> pool;
+        std::vector<ItemHandle> handles(N);
+        auto t0 = ChSteadyClock::now();
+        for (uint32_t i{0}; i < N; i++) {
+            auto* slot = pool.Reserve();
+            slot->item.value = float(i);
+            slot->Sign();
+            handles[i] = slot->External();
+        }
+        double insertMs = Ms(t0);
+
+        t0 = ChSteadyClock::now();
+        double sum{0};
+        for (uint32_t i : shuffled) sum += pool.Get(handles[i])->item.value;
+        double lookupMs = Ms(t0);
+
+        for (uint32_t i{0}; i < N / 2; i++) pool.Delete(handles[shuffled[i]]);
+        t0 = ChSteadyClock::now();
+        for (auto& slot : pool.GetInternal()) {
+            if (slot.alive) sum += slot.item.value;
+        }
+        double iterMs = Ms(t0);
+
+        t0 = ChSteadyClock::now();
+        for (uint32_t i{N / 2}; i < N; i++) pool.Delete(handles[shuffled[i]]);
+        double eraseMs = Ms(t0);
+
+        std::cout << "MagicPool     insert=" << insertMs << "ms lookup=" << lookupMs << "ms iterate(50% live)="
+                  << iterMs << "ms erase=" << eraseMs << "ms (" << sum << ")" << std::endl;
+    }
+
+    // MagicSlotMap
+    {
+        utils::MagicSlotMap<ItemHandle, Item> map;
+        std::vector<ItemHandle> handles(N);
+        auto t0 = ChSteadyClock::now();
+        for (uint32_t i{0}; i < N; i++) {
+            Item item;
+            item.value = float(i);
+            handles[i] = map.Insert(item);
+        }
+        double insertMs = Ms(t0);
+
+        t0 = ChSteadyClock::now();
+        double sum{0};
+        for (uint32_t i : shuffled) sum += map.Get(handles[i])->value;
+        double lookupMs = Ms(t0);
+
+        for (uint32_t i{0}; i < N / 2; i++) map.Erase(handles[shuffled[i]]);
+        t0 = ChSteadyClock::now();
+        for (auto& item : map.Dense()) sum += item.value;
+        double iterMs = Ms(t0);
+
+        t0 = ChSteadyClock::now();
+        for (uint32_t i{N / 2}; i < N; i++) map.Erase(handles[shuffled[i]]);
+        double eraseMs = Ms(t0);
+
+        std::cout << "MagicSlotMap  insert=" << insertMs << "ms lookup=" << lookupMs << "ms iterate(50% live)="
+                  << iterMs << "ms erase=" << eraseMs << "ms (" << sum << ")" << std::endl;
+    }
+
+    // SoA: hot float iterated apart from the cold payload
+    {
+        utils::MagicSlotMap<ItemHandle, float, std::array<uint64_t, 7>> soa;
+        for (uint32_t i{0}; i < N; i++) soa.Insert(float(i), std::array<uint64_t, 7>{});
+        auto t0 = ChSteadyClock::now();
+        double sum{0};
+        for (float v : soa.Dense<0>()) sum += v;
+        std::cout << "MagicSlotMap SoA iterate hot field (100% live)=" << Ms(t0) << "ms (" << sum << ")" << std::endl;
+    }
+
+    // Ordered: insert after a random live entry, then erase in random order
+    for (uint32_t n : {20000u, 1000000u}) {
+        std::vector<uint32_t> order(n);
+        std::iota(order.begin(), order.end(), 0u);
+        std::shuffle(order.begin(), order.end(), rng);
+
+        if (n <= 20000) {
+            utils::MagicPool<ItemSlot> pool(true);
+            std::vector<ItemHandle> handles(n);
+            auto t0 = ChSteadyClock::now();
+            for (uint32_t i{0}; i < n; i++) {
+                auto* slot = pool.Reserve(i ? handles[rng() % i].index : UINT32_MAX);
+                slot->Sign();
+                handles[i] = slot->External();
+            }
+            for (uint32_t i : order) pool.Delete(handles[i]);
+            std::cout << "ordered MagicPool    n=" << n << " insert-after+erase=" << Ms(t0) << "ms" << std::endl;
+        }
+
+        utils::MagicSlotMap<ItemHandle, Item> map(true);
+        std::vector<ItemHandle> handles(n);
+        auto t0 = ChSteadyClock::now();
+        for (uint32_t i{0}; i < n; i++) {
+            handles[i] = map.InsertAfter(i ? handles[rng() % i].index : UINT32_MAX, Item{});
+        }
+        size_t walked{0};
+        map.ForEachOrdered([&walked](ItemHandle, Item&) { walked++; });
+        for (uint32_t i : order) map.Erase(handles[i]);
+        std::cout << "ordered MagicSlotMap n=" << n << " insert-after+erase=" << Ms(t0) << "ms (walked " << walked << ")" << std::endl;
+    }
+    return 0;
+}
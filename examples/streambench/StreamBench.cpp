@@ -0,0 +1,188 @@
+// Decoding 10M varints and 1M matrices through the per-byte/per-component virtual reads the parsers used
+// (kept below as Legacy*) against StreamReader, over a file stream and an in-memory stream, plus encoding
+// the same data through per-call writes and StreamWriter.
+#include "axle/data/AX_DataEndianness.hpp"
+#include "axle/data/AX_DataStreamImplBuffer.hpp"
+#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/data/AX_DataTemplates.hpp"
+#include "axle/data/AX_StreamReader.hpp"
+#include "axle/data/AX_StreamWriter.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace axle;
+
+static constexpr uint32_t VARINTS = 10'000'000;
+static constexpr uint32_t MATRICES = 1'000'000;
+
+static utils::ExResult<uint64_t> LegacyReadVarUInt(data::IDataStream& buffer) {
+    uint64_t result = 0;
+    int shift = 0;
+    for (int i = 0; i < 10; ++i) {
+        if (buffer.EndOfStream()) return utils::ExError{"Unexpected EOF"};
+        uint8_t byte{0};
+        auto res = buffer.Read(&byte, 1);
+        if (!res.has_value()) return res.error();
+        result |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return result;
+        shift += 7;
+    }
+    return utils::ExError{"VarUInt overflow"};
+}
+
+static utils::ExResult<glm::mat4> LegacyReadMat4(data::IDataStream& buffer) {
+    glm::mat4 mat;
+    for (int i{0}; i < 16; i++)
+        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &mat[i / 4][i % 4]));
+    return mat;
+}
+
+static utils::ExError LegacyWriteVarUInt(data::IDataStream& buffer, uint64_t value) {
+    do {
+        uint8_t byte = static_cast<uint8_t>(value & 0x7F);
+        value >>= 7;
+        if (value != 0) byte |= 0x80;
+        auto res = buffer.Write(&byte, 1);
+        if (!res.has_value()) return res.error();
+    } while (value != 0);
+    return utils::ExError::NoError();
+}
+
+template <typename Fn>
+static double TimeMs(Fn&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(ChSteadyClock::now() - t0).count();
+}
+
+static void Fail(const char* what) {
+    std::cout << "FAILED: " << what << std::endl;
+    std::exit(1);
+}
+
+int main() {
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> values(VARINTS);
+    for (auto& v : values) v = rng() >> (rng() % 64); // Mixed 1..10 byte encodings
+    std::vector<float> floats(MATRICES * 16);
+    for (size_t i{0}; i < floats.size(); i++) floats[i] = float(i) * 0.25f;
+
+    auto dir = std::filesystem::temp_directory_path();
+    auto varPath = dir / "axle_streambench_var.bin";
+    auto matPath = dir / "axle_streambench_mat.bin";
+
+    // Encode
+    double legacyWrite = TimeMs([&]() {
+        data::FileDataStream file(varPath, false, true);
+        if (file.Open().IsValid()) Fail("open for write");
+        for (uint64_t v : values) LegacyWriteVarUInt(file, v);
+    });
+    double bufferedWrite = TimeMs([&]() {
+        data::FileDataStream file(varPath, false, true);
+        if (file.Open().IsValid()) Fail("open for write");
+        data::StreamWriter writer(file);
+        for (uint64_t v : values) writer.WriteVarUInt(v);
+    });
+    {
+        data::FileDataStream file(matPath, false, true);
+        if (file.Open().IsValid()) Fail("open for write");
+        data::StreamWriter writer(file);
+        writer.WriteSpan(floats.data(), floats.size());
+    }
+    std::cout << "write " << VARINTS / 1'000'000 << "M varints to file: per-byte " << legacyWrite
+              << " ms, StreamWriter " << bufferedWrite << " ms" << std::endl;
+
+    // Decode from file
+    uint64_t check{0};
+    double legacyVarFile = TimeMs([&]() {
+        data::FileDataStream file(varPath, true, false);
+        if (file.Open().IsValid()) Fail("open for read");
+        for (uint32_t i{0}; i < VARINTS; i++) check += LegacyReadVarUInt(file).value();
+    });
+    uint64_t sum{0};
+    double bufferedVarFile = TimeMs([&]() {
+        data::FileDataStream file(varPath, true, false);
+        if (file.Open().IsValid()) Fail("open for read");
+        data::StreamReader reader(file);
+        for (uint32_t i{0}; i < VARINTS; i++) sum += reader.ReadVarUInt().value();
+    });
+    if (sum != check) Fail("varint file decode mismatch");
+
+    float fcheck{0}, fsum{0};
+    double legacyMatFile = TimeMs([&]() {
+        data::FileDataStream file(matPath, true, false);
+        if (file.Open().IsValid()) Fail("open for read");
+        for (uint32_t i{0}; i < MATRICES; i++) fcheck += LegacyReadMat4(file).value()[3][3];
+    });
+    double bufferedMatFile = TimeMs([&]() {
+        data::FileDataStream file(matPath, true, false);
+        if (file.Open().IsValid()) Fail("open for read");
+        data::StreamReader reader(file);
+        for (uint32_t i{0}; i < MATRICES; i++) fsum += data::LE_ReadMat4(reader).value()[3][3];
+    });
+    if (fsum != fcheck) Fail("matrix file decode mismatch");
+
+    std::cout << "file stream:" << std::endl;
+    std::cout << "  " << VARINTS / 1'000'000 << "M varints: per-byte " << legacyVarFile << " ms, StreamReader " << bufferedVarFile << " ms" << std::endl;
+    std::cout << "  " << MATRICES / 1'000'000 << "M mat4: per-component " << legacyMatFile << " ms, StreamReader " << bufferedMatFile << " ms" << std::endl;
+
+    // Decode from memory
+    std::vector<uint8_t> varBytes(std::filesystem::file_size(varPath));
+    std::vector<uint8_t> matBytes(std::filesystem::file_size(matPath));
+    {
+        data::FileDataStream file(varPath, true, false);
+        if (file.Open().IsValid() || !file.Read(varBytes.data(), varBytes.size()).has_value()) Fail("load");
+        data::FileDataStream mats(matPath, true, false);
+        if (mats.Open().IsValid() || !mats.Read(matBytes.data(), matBytes.size()).has_value()) Fail("load");
+    }
+
+    check = sum = 0;
+    double legacyVarMem = TimeMs([&]() {
+        data::BufferDataStream mem({varBytes.data(), varBytes.size()});
+        mem.Open();
+        for (uint32_t i{0}; i < VARINTS; i++) check += LegacyReadVarUInt(mem).value();
+    });
+    double bufferedVarMem = TimeMs([&]() {
+        data::BufferDataStream mem({varBytes.data(), varBytes.size()});
+        mem.Open();
+        data::StreamReader reader(mem);
+        for (uint32_t i{0}; i < VARINTS; i++) sum += reader.ReadVarUInt().value();
+    });
+    if (sum != check) Fail("varint memory decode mismatch");
+
+    fcheck = fsum = 0;
+    double legacyMatMem = TimeMs([&]() {
+        data::BufferDataStream mem({matBytes.data(), matBytes.size()});
+        mem.Open();
+        for (uint32_t i{0}; i < MATRICES; i++) fcheck += LegacyReadMat4(mem).value()[3][3];
+    });
+    double bufferedMatMem = TimeMs([&]() {
+        data::BufferDataStream mem({matBytes.data(), matBytes.size()});
+        mem.Open();
+        data::StreamReader reader(mem);
+        for (uint32_t i{0}; i < MATRICES; i++) fsum += data::LE_ReadMat4(reader).value()[3][3];
+    });
+    std::vector<float> bulk;
+    double spanMem = TimeMs([&]() {
+        data::BufferDataStream mem({matBytes.data(), matBytes.size()});
+        mem.Open();
+        data::StreamReader reader(mem);
+        bulk = reader.ReadSpan<float>(MATRICES * 16).value();
+    });
+    if (fsum != fcheck || bulk != floats) Fail("matrix memory decode mismatch");
+
+    std::cout << "memory stream:" << std::endl;
+    std::cout << "  " << VARINTS / 1'000'000 << "M varints: per-byte " << legacyVarMem << " ms, StreamReader " << bufferedVarMem << " ms" << std::endl;
+    std::cout << "  " << MATRICES / 1'000'000 << "M mat4: per-component " << legacyMatMem << " ms, StreamReader " << bufferedMatMem
+              << " ms, one ReadSpan<float> " << spanMem << " ms" << std::endl;
+
+    std::filesystem::remove(varPath);
+    std::filesystem::remove(matPath);
+    std::cout << "ALL OK" << std::endl;
+    return 0;
+}
@@ -0,0 +1,108 @@
+// ThreadSpec benchmark: cycle-time variance of a 1ms-capped cycler under a synthetic loader load,
+// unplaced vs. a pinned/prioritised cycler with the loaders kept off its CPU and niced
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+#include "axle/core/concurrency/AX_ThreadSpec.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace axle;
+
+static volatile uint64_t g_Sink{0};
+
+struct CycleStats {
+    double meanUs{0.0};
+    double stddevUs{0.0};
+    double p99Us{0.0};
+    double maxUs{0.0};
+};
+
+static CycleStats Measure(const core::ThreadSpec& cyclerSpec, const core::ThreadSpec& loaderSpec, uint32_t loaders) {
+    std::atomic_bool loading{true};
+    std::vector<std::thread> loaderThreads;
+    for (uint32_t i{0}; i < loaders; i++) {
+        loaderThreads.emplace_back([&loading, &loaderSpec]() {
+            core::ApplyThreadSpec(loaderSpec);
+            while (loading.load(std::memory_order_relaxed)) {
+                for (uint32_t j{0}; j < 100000; j++) g_Sink = g_Sink + j; // "decompression"
+            }
+        });
+    }
+
+    auto cycler = std::make_shared<core::ThreadCycler>();
+    cycler->SetCycleTimeCap(ChMillis(1));
+    cycler->Start(cyclerSpec);
+    cycler->AwaitStart();
+    if (auto err = cycler->GetSpecError(); err.IsValid()) {
+        std::cout << "  (cycler spec partially applied: " << err.GetMessage() << ")" << std::endl;
+    }
+
+    std::vector<ChSteadyTimepoint> stamps;
+    stamps.reserve(4096);
+    std::atomic_bool done{false};
+    cycler->CreateWork([&stamps, &done]() {
+        if (stamps.size() < stamps.capacity()) {
+            stamps.push_back(ChSteadyClock::now());
+            for (uint32_t j{0}; j < 2000; j++) g_Sink = g_Sink + j; // "frame work"
+        } else {
+            done.store(true);
+        }
+    });
+
+    while (!done.load()) {
+        std::this_thread::sleep_for(ChMillis(10));
+    }
+    cycler->Stop(true);
+    loading.store(false);
+    for (auto& thr : loaderThreads) thr.join();
+
+    std::vector<double> intervals;
+    for (size_t i{1}; i < stamps.size(); i++) {
+        intervals.push_back(std::chrono::duration<double, std::micro>(stamps[i] - stamps[i - 1]).count());
+    }
+    CycleStats stats;
+    for (auto v : intervals) stats.meanUs += v;
+    stats.meanUs /= intervals.size();
+    for (auto v : intervals) stats.stddevUs += (v - stats.meanUs) * (v - stats.meanUs);
+    stats.stddevUs = std::sqrt(stats.stddevUs / intervals.size());
+    std::sort(intervals.begin(), intervals.end());
+    stats.p99Us = intervals[size_t(0.99 * (intervals.size() - 1))];
+    stats.maxUs = intervals.back();
+    return stats;
+}
+
+static void Print(const char* name, const CycleStats& stats) {
+    std::cout << name
+              << " mean_us=" << stats.meanUs
+              << " stddev_us=" << stats.stddevUs
+              << " p99_us=" << stats.p99Us
+              << " max_us=" << stats.maxUs << std::endl;
+}
+
+int main() {
+    uint32_t hw = std::max(1u, std::thread::hardware_concurrency());
+    uint32_t loaders = std::max(1u, hw);
+    std::cout << "cpus=" << hw << " loaders=" << loaders << std::endl;
+
+    Print("idle      ", Measure({.name = "AX Bench"}, {}, 0));
+    Print("unplaced  ", Measure({.name = "AX Bench"}, {.name = "AX Loader"}, loaders));
+
+    core::ThreadSpec cyclerSpec{.name = "AX Bench", .cpus = {0}, .priority = -10};
+    core::ThreadSpec loaderSpec{.name = "AX Loader", .priority = 10};
+    for (uint32_t cpu{1}; cpu < hw; cpu++) {
+        loaderSpec.cpus.push_back(cpu);
+    }
+    Print("placed    ", Measure(cyclerSpec, loaderSpec, loaders));
+
+    cyclerSpec.policy = core::ThreadSchedPolicy::Fifo;
+    cyclerSpec.priority = 10;
+    Print("placed rt ", Measure(cyclerSpec, loaderSpec, loaders));
+    return 0;
+}
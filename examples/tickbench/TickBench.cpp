@@ -0,0 +1,121 @@
+// Headless FixedStepScheduler benchmark: step drift against wall time, step jitter, catch-up after stalls,
+// compared with the previous millisecond sleep_for loop
+#include "axle/tick/AX_FixedStepScheduler.hpp"
+#include "axle/tick/AX_ITickAdapter.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+using namespace axle;
+
+class StepRecorder : public tick::ITickAdapter {
+public:
+    std::vector<ChSteadyTimepoint> stamps{};
+    double simSeconds{0.0};
+
+    StepRecorder() { stamps.reserve(1 << 16); }
+
+    void Tick(float dT) override {
+        stamps.push_back(ChSteadyClock::now());
+        simSeconds += dT;
+    }
+};
+
+static double ToUs(ChNanos ns) {
+    return double(ns.count()) / 1000.0;
+}
+
+static void Report(const char* name, ChNanos step, const StepRecorder& rec, ChNanos wall) {
+    std::vector<double> jitter;
+    jitter.reserve(rec.stamps.size());
+    for (size_t i{1}; i < rec.stamps.size(); i++) {
+        jitter.push_back(std::abs(ToUs(rec.stamps[i] - rec.stamps[i - 1]) - ToUs(step)));
+    }
+    std::sort(jitter.begin(), jitter.end());
+    auto pct = [&](double p) { return jitter.empty() ? 0.0 : jitter[size_t(p * (jitter.size() - 1))]; };
+
+    double wallSec = std::chrono::duration<double>(wall).count();
+    std::cout << name
+              << " step_us=" << ToUs(step)
+              << " steps=" << rec.stamps.size()
+              << " expected=" << uint64_t(wallSec / std::chrono::duration<double>(step).count())
+              << " sim_drift_ms=" << (rec.simSeconds - wallSec) * 1000.0
+              << " jitter_us p50=" << pct(0.5) << " p99=" << pct(0.99) << " max=" << pct(1.0)
+              << std::endl;
+}
+
+static void BenchScheduler(ChNanos step, ChNanos spinTail, ChNanos duration) {
+    tick::FixedStepScheduler scheduler(step);
+    scheduler.SetSpinTail(spinTail);
+    StepRecorder rec;
+    scheduler.Subscribe(&rec);
+
+    auto t0 = ChSteadyClock::now();
+    scheduler.Reset(t0);
+    while (ChSteadyClock::now() - t0 < duration) {
+        scheduler.Advance();
+        scheduler.SleepUntilNextStep();
+    }
+    auto wall = ChSteadyClock::now() - t0;
+
+    std::cout << "spin_tail_us=" << ToUs(spinTail) << " ";
+    Report("fixed", step, rec, wall);
+}
+
+// The loop Application::InitCurrent used to run: ms-truncated delta, sleep_for(step - delta)
+static void BenchLegacy(ChMillis step, ChNanos duration) {
+    StepRecorder rec;
+
+    auto t0 = ChSteadyClock::now();
+    auto lastTime = t0;
+    while (ChSteadyClock::now() - t0 < duration) {
+        auto now = ChSteadyClock::now();
+        auto delta = std::chrono::duration_cast<ChMillis>(now - lastTime);
+        lastTime = now;
+        rec.Tick(float(delta.count() / 1e3)); // Corrected seconds, the original divided by 1e9
+        std::this_thread::sleep_for(ChMillis(std::max(step.count() - delta.count(), (int64_t)0)));
+    }
+    auto wall = ChSteadyClock::now() - t0;
+
+    std::cout << "                 ";
+    Report("legacy", step, rec, wall);
+}
+
+static void BenchStall(ChNanos step, uint32_t maxCatchUp) {
+    tick::FixedStepScheduler scheduler(step, maxCatchUp);
+    StepRecorder rec;
+    scheduler.Subscribe(&rec);
+
+    auto t0 = ChSteadyClock::now();
+    scheduler.Reset(t0);
+
+    // Simulated 250ms hitch (e.g. a blocking load) between two advances
+    uint32_t ran = scheduler.Advance(t0 + ChMillis(250));
+    std::cout << "stall=250ms step_us=" << ToUs(step)
+              << " max_catch_up=" << maxCatchUp
+              << " ran=" << ran
+              << " dropped=" << scheduler.GetDroppedSteps()
+              << " alpha=" << scheduler.GetAlpha() << std::endl;
+}
+
+int main() {
+    auto duration = ChNanos(std::chrono::seconds(2));
+
+    for (auto step : {ChNanos(std::chrono::microseconds(16667)), ChNanos(ChMillis(1))}) {
+        for (auto spinTail : {ChNanos(0), ChNanos(std::chrono::microseconds(100)), ChNanos(std::chrono::microseconds(500))}) {
+            BenchScheduler(step, spinTail, duration);
+        }
+    }
+    BenchLegacy(ChMillis(16), duration);
+    BenchLegacy(ChMillis(1), duration);
+
+    BenchStall(ChMillis(16), 5);
+    BenchStall(ChMillis(1), 5);
+    return 0;
+}
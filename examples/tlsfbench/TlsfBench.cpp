@@ -0,0 +1,147 @@
+// TlsfAllocator fragmentation soak: streams asset-sized buffers in and out for millions of operations, checking contents
+// on free and reporting heap growth and fragmentation over time; then alloc/free throughput against malloc.
+#include "axle/core/alloc/AX_TlsfAllocator.hpp"
+
+#include "axle/utils/AX_Span.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <random>
+#include <vector>
+
+using namespace axle;
+
+struct Live {
+    uint8_t* ptr;
+    size_t size;
+    uint8_t tag;
+};
+
+// Log-uniform 16B..1MiB with occasional over-aligned requests, like glyph bitmaps / metadata / mesh buffers
+static size_t RandomSize(std::mt19937_64& rng) {
+    std::uniform_real_distribution<double> exp(4.0, 20.0);
+    return size_t(std::pow(2.0, exp(rng)));
+}
+
+static bool Soak(core::TlsfAllocator& heap, uint64_t ops, size_t liveTarget) {
+    std::mt19937_64 rng(42);
+    std::vector<Live> live;
+    size_t liveBytes{0};
+    bool ok{true};
+
+    for (uint64_t op{0}; op < ops; op++) {
+        bool alloc = liveBytes < liveTarget ? (rng() % 4 != 0) : (rng() % 4 == 0);
+        if (alloc || live.empty()) {
+            size_t size = RandomSize(rng);
+            size_t align = rng() % 16 == 0 ? 256 : 16;
+            auto* ptr = static_cast<uint8_t*>(heap.Allocate(size, align));
+            if (!ptr) {
+                std::cout << "  allocation failed size=" << size << std::endl;
+                return false;
+            }
+            if (reinterpret_cast<uintptr_t>(ptr) % align) ok = false;
+            auto tag = uint8_t(op);
+            std::memset(ptr, tag, size);
+            live.push_back({ptr, size, tag});
+            liveBytes += size;
+        } else {
+            size_t idx = rng() % live.size();
+            auto entry = live[idx];
+            live[idx] = live.back();
+            live.pop_back();
+            if (entry.ptr[0] != entry.tag || entry.ptr[entry.size - 1] != entry.tag || entry.ptr[entry.size / 2] != entry.tag) ok = false;
+            heap.Free(entry.ptr);
+            liveBytes -= entry.size;
+        }
+
+        if ((op + 1) % (ops / 8) == 0) {
+            auto stats = heap.GetStats();
+            std::cout << "  ops=" << op + 1
+                      << " live=" << live.size()
+                      << " usedMiB=" << stats.usedBytes / 1048576.0
+                      << " peakMiB=" << stats.peakBytes / 1048576.0
+                      << " poolMiB=" << stats.poolBytes / 1048576.0
+                      << " pools=" << stats.pools
+                      << " fragmentation=" << stats.Fragmentation() << std::endl;
+        }
+    }
+
+    for (auto& entry : live) heap.Free(entry.ptr);
+    auto stats = heap.GetStats();
+    if (stats.usedBytes != 0 || stats.allocations != 0) ok = false;
+    std::cout << "  drained: used=" << stats.usedBytes << " fragmentation=" << stats.Fragmentation()
+              << " contents " << (ok ? "OK" : "CORRUPT") << std::endl;
+    return ok;
+}
+
+template <typename Alloc, typename Free>
+static double OpsPerSec(Alloc alloc, Free release) {
+    std::mt19937_64 rng(7);
+    std::vector<size_t> sizes(4096);
+    for (auto& s : sizes) s = 16 + rng() % 4096;
+    std::vector<void*> ptrs(sizes.size());
+
+    constexpr uint32_t rounds = 500;
+    auto t0 = ChSteadyClock::now();
+    for (uint32_t r{0}; r < rounds; r++) {
+        for (size_t i{0}; i < sizes.size(); i++) ptrs[i] = alloc(sizes[i]);
+        for (size_t i{0}; i < sizes.size(); i += 2) release(ptrs[i]); // Interleave to keep holes around
+        for (size_t i{1}; i < sizes.size(); i += 2) release(ptrs[i]);
+    }
+    double secs = std::chrono::duration<double>(ChSteadyClock::now() - t0).count();
+    return 2.0 * rounds * sizes.size() / secs;
+}
+
+int main() {
+    bool ok{true};
+
+    std::cout << "soak malloc-backed, 64MiB live, growable" << std::endl;
+    {
+        core::TlsfAllocator heap({core::TlsfBacking::Malloc, 32ull << 20, 32ull << 20});
+        ok &= Soak(heap, 4000000, 64ull << 20);
+    }
+
+    std::cout << "soak vm-backed, 64MiB live" << std::endl;
+    {
+        core::TlsfAllocator heap({core::TlsfBacking::VirtualMemory, 128ull << 20, 32ull << 20});
+        ok &= Soak(heap, 2000000, 64ull << 20);
+    }
+
+    std::cout << "user buffer, fixed 8MiB" << std::endl;
+    {
+        std::vector<uint8_t> buffer(8ull << 20);
+        core::TlsfAllocator heap({core::TlsfBacking::UserBuffer, buffer.size(), 0, buffer.data()});
+        std::vector<void*> blocks;
+        while (void* p = heap.Allocate(64 * 1024)) blocks.push_back(p);
+        std::cout << "  64KiB blocks until full=" << blocks.size() << std::endl;
+        for (auto* p : blocks) heap.Free(p);
+        ok &= heap.GetStats().Fragmentation() == 0.0;
+    }
+
+    std::cout << "pmr: CowSpan storage on the heap" << std::endl;
+    {
+        core::TlsfAllocator heap;
+        {
+            std::pmr::vector<uint8_t> bytes(1 << 20, 0x5A, &heap);
+            utils::URaw raw{std::move(bytes)};
+            utils::URaw copy = raw;
+            ok &= copy.size() == raw.size() && copy[1000] == 0x5A && copy.data() == raw.data();
+            copy.MakeMutable()[1000] = 0x33; // Detaches into a second block on the same heap
+            ok &= copy.data() != raw.data() && raw[1000] == 0x5A && copy[1000] == 0x33;
+            std::cout << "  live allocations=" << heap.GetStats().allocations << std::endl;
+        }
+        ok &= heap.GetStats().allocations == 0;
+    }
+
+    core::TlsfAllocator heap;
+    double tlsfRate = OpsPerSec([&](size_t s) { return heap.Allocate(s); }, [&](void* p) { heap.Free(p); });
+    double mallocRate = OpsPerSec([](size_t s) { return std::malloc(s); }, [](void* p) { std::free(p); });
+    std::cout << "throughput Mops/sec: malloc=" << mallocRate / 1e6 << " tlsf=" << tlsfRate / 1e6 << std::endl;
+
+    std::cout << (ok ? "ALL OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
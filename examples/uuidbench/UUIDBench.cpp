@@ -0,0 +1,128 @@
+// UUID generate/format/parse/hash against the previous implementation (random_device + mt19937_64 with a
+// uniform_int_distribution per call, ostringstream formatting, shift-xor std::hash), kept below as LegacyUUID.
+#include "axle/utils/AX_UUID.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+using namespace axle;
+
+struct LegacyUUID {
+    std::array<uint8_t, 16> bytes{};
+
+    static LegacyUUID Generate() {
+        LegacyUUID uuid;
+        static thread_local std::random_device rd;
+        static thread_local std::mt19937_64 gen(rd());
+        std::uniform_int_distribution<uint64_t> dist;
+        uint64_t a = dist(gen);
+        uint64_t b = dist(gen);
+        for (int i = 0; i < 8; i++) uuid.bytes[i] = static_cast<uint8_t>((a >> (56 - i * 8)) & 0xFF);
+        for (int i = 0; i < 8; i++) uuid.bytes[8 + i] = static_cast<uint8_t>((b >> (56 - i * 8)) & 0xFF);
+        uuid.bytes[6] = (uuid.bytes[6] & 0x0F) | 0x40;
+        uuid.bytes[8] = (uuid.bytes[8] & 0x3F) | 0x80;
+        return uuid;
+    }
+
+    std::string ToString() const {
+        std::ostringstream ss;
+        for (int i = 0; i < 16; ++i) {
+            if (i == 4 || i == 6 || i == 8 || i == 10) ss << '-';
+            ss << std::hex << std::setw(2) << std::setfill('0') << (int)bytes[i];
+        }
+        return ss.str();
+    }
+
+    bool operator==(const LegacyUUID&) const = default;
+};
+
+struct LegacyHash {
+    size_t operator()(const LegacyUUID& uuid) const noexcept {
+        uint64_t a = 0, b = 0;
+        for (int i = 0; i < 8; ++i) a = (a << 8) | uuid.bytes[i];
+        for (int i = 8; i < 16; ++i) b = (b << 8) | uuid.bytes[i];
+        return std::hash<uint64_t>()(a) ^ (std::hash<uint64_t>()(b) << 1);
+    }
+};
+
+template <typename F>
+static double NsPer(uint32_t count, F&& fn) {
+    auto t0 = ChSteadyClock::now();
+    fn();
+    return std::chrono::duration<double, std::nano>(ChSteadyClock::now() - t0).count() / count;
+}
+
+int main() {
+    constexpr uint32_t N = 1000000;
+    bool ok = true;
+    uint64_t sink{0};
+
+    std::vector<LegacyUUID> legacy(N);
+    std::vector<utils::UUID> v4(N), v7(N);
+
+    std::cout << "generate, ns/id" << std::endl;
+    double legacyGen = NsPer(N, [&]() { for (auto& id : legacy) id = LegacyUUID::Generate(); });
+    double v4Gen = NsPer(N, [&]() { for (auto& id : v4) id = utils::UUID::Generate(); });
+    double v7Gen = NsPer(N, [&]() { for (auto& id : v7) id = utils::UUID::GenerateV7(); });
+    std::cout << "  legacy=" << legacyGen << " v4=" << v4Gen << " v7=" << v7Gen << std::endl;
+
+    ok &= std::is_sorted(v7.begin(), v7.end()) && std::adjacent_find(v7.begin(), v7.end()) == v7.end();
+    ok &= v4[0].Version() == 4 && v7[0].Version() == 7 && (v4[0].Low() >> 62) == 2;
+
+    std::cout << "format, ns/id" << std::endl;
+    double legacyFmt = NsPer(N, [&]() { for (auto& id : legacy) sink += id.ToString().size(); });
+    double newFmt = NsPer(N, [&]() { for (auto& id : v4) sink += id.ToString().size(); });
+    char buf[utils::UUID::STRING_LENGTH];
+    double charsFmt = NsPer(N, [&]() { for (auto& id : v4) { id.ToChars(buf); sink += buf[0]; } });
+    std::cout << "  legacy=" << legacyFmt << " ToString=" << newFmt << " ToChars=" << charsFmt << std::endl;
+
+    std::vector<std::string> texts;
+    texts.reserve(N);
+    for (auto& id : v4) texts.push_back(id.ToString());
+    std::vector<utils::UUID> parsed(N);
+    double parseNs = NsPer(N, [&]() {
+        for (uint32_t i{0}; i < N; i++) parsed[i] = utils::UUID::Parse(texts[i]).value_or(utils::UUID{});
+    });
+    ok &= parsed == v4;
+    ok &= !utils::UUID::Parse("0123456789ab-cdef-0123-456789abcdef0").has_value();
+    ok &= !utils::UUID::Parse("g1234567-89ab-cdef-0123-456789abcdef").has_value();
+    ok &= utils::UUID::Parse("0123456789ABCDEF0123456789abcdef").has_value() == false;
+    ok &= texts[0] == LegacyUUID{[&] { LegacyUUID l; auto d = v4[0].Data(); std::copy(d.begin(), d.end(), l.bytes.begin()); return l; }()}.ToString();
+    std::cout << "parse, ns/id: " << parseNs << std::endl;
+
+    std::cout << "hash, ns/id" << std::endl;
+    double legacyHash = NsPer(N, [&]() { for (auto& id : legacy) sink += LegacyHash{}(id); });
+    double newHash = NsPer(N, [&]() { for (auto& id : v4) sink += std::hash<utils::UUID>{}(id); });
+    std::cout << "  legacy=" << legacyHash << " new=" << newHash << std::endl;
+
+    std::vector<LegacyUUID> legacyV7(v7.size());
+    for (size_t i{0}; i < v7.size(); i++) {
+        auto d = v7[i].Data();
+        std::copy(d.begin(), d.end(), legacyV7[i].bytes.begin());
+    }
+
+    std::cout << "unordered_map insert+find, ns/id" << std::endl;
+    double legacyMap = NsPer(N, [&]() {
+        std::unordered_map<LegacyUUID, uint32_t, LegacyHash> map;
+        for (uint32_t i{0}; i < N; i++) map.emplace(legacyV7[i], i);
+        for (uint32_t i{0}; i < N; i++) sink += map.find(legacyV7[i])->second;
+    });
+    double newMap = NsPer(N, [&]() {
+        std::unordered_map<utils::UUID, uint32_t> map;
+        for (uint32_t i{0}; i < N; i++) map.emplace(v7[i], i);
+        for (uint32_t i{0}; i < N; i++) sink += map.find(v7[i])->second;
+    });
+    std::cout << "  v7 keys: legacy=" << legacyMap << " new=" << newMap << std::endl;
+
+    std::cout << "(" << sink % 2 << ") " << (ok ? "ALL OK" : "FAILED") << std::endl;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,22 @@
+# Distributed under the OSI-approved BSD 3-Clause License.  See accompanying
+# file Copyright.txt or https://cmake.org/licensing for details.
+
+cmake_minimum_required(VERSION 3.5)
+
+file(MAKE_DIRECTORY
+  "/root/repo/external/assimp/src"
+  "/root/repo/external/assimp/linux/build"
+  "/root/repo/external/assimp/linux/install"
+  "/root/repo/external/assimp/tmp"
+  "/root/repo/external/assimp/assimp-stamp"
+  "/root/repo/external/assimp/src"
+  "/root/repo/external/assimp/assimp-stamp"
+)
+
+set(configSubDirs )
+foreach(subDir IN LISTS configSubDirs)
+    file(MAKE_DIRECTORY "/root/repo/external/assimp/assimp-stamp/${subDir}")
+endforeach()
+if(cfgdir)
+  file(MAKE_DIRECTORY "/root/repo/external/assimp/assimp-stamp${cfgdir}") # cfgdir has leading slash
+endif()
@@ -0,0 +1,67 @@
+# Depends on cmake/modules/**
+
+# Automatically downloads and builds Zstandard (static, library only)
+# Works on Windows, Linux, macOS, Android, Emscripten(WASM)
+# Opt-in, AX_IMPL_ZSTD is OFF by default and default builds never run this download/build step.
+# Without it CompressionCodec::Zstd reports unavailable and LZ4 stays the codec.
+
+list(APPEND CMAKE_MODULE_PATH "${CMAKE_SOURCE_DIR}/cmake/Modules")
+
+include(ExternalProject)
+
+set(ZSTD_PREFIX ${CMAKE_SOURCE_DIR}/external/zstd)
+set(ZSTD_SRC_DIR ${ZSTD_PREFIX}/src)
+set(ZSTD_BUILD_DIR ${ZSTD_PREFIX}/${AX_PLATFORM_UNIFIED_NAME}/build)
+set(ZSTD_INSTALL_DIR ${ZSTD_PREFIX}/${AX_PLATFORM_UNIFIED_NAME}/install)
+set(ZSTD_EXTRA_ARGS "")
+
+if (UNIX AND NOT APPLE AND NOT ANDROID)
+    list(APPEND ZSTD_EXTRA_ARGS -DCMAKE_POSITION_INDEPENDENT_CODE=ON)
+endif()
+
+if (ANDROID OR WEB)
+    list(APPEND ZSTD_EXTRA_ARGS
+        -DCMAKE_C_COMPILER=${CMAKE_C_COMPILER}
+    )
+endif()
+
+# ExternalProject Add
+ExternalProject_Add(
+    zstd
+    PREFIX ${ZSTD_PREFIX}
+    STAMP_DIR ${ZSTD_PREFIX}/zstd-stamp
+    GIT_REPOSITORY https://github.com/facebook/zstd.git
+    GIT_TAG v1.5.6
+    SOURCE_DIR ${ZSTD_SRC_DIR}
+    SOURCE_SUBDIR build/cmake
+    BINARY_DIR ${ZSTD_BUILD_DIR}
+    INSTALL_DIR ${ZSTD_INSTALL_DIR}
+    CMAKE_ARGS
+        -DCMAKE_INSTALL_PREFIX=${ZSTD_INSTALL_DIR}
+        -DCMAKE_INSTALL_LIBDIR=lib
+        -DZSTD_BUILD_STATIC=ON
+        -DZSTD_BUILD_SHARED=OFF
+        -DZSTD_BUILD_PROGRAMS=OFF
+        -DZSTD_BUILD_TESTS=OFF
+        -DZSTD_LEGACY_SUPPORT=OFF
+        ${ZSTD_EXTRA_ARGS}
+    BUILD_BYPRODUCTS
+        ${ZSTD_INSTALL_DIR}/lib/libzstd.a
+        ${ZSTD_INSTALL_DIR}/lib/zstd_static.lib
+    UPDATE_DISCONNECTED 1
+    BUILD_ALWAYS 1
+    BUILD_IN_SOURCE 0
+)
+
+add_library(Zstd STATIC IMPORTED GLOBAL)
+add_dependencies(Zstd zstd)
+
+if (MSVC)
+    set_target_properties(Zstd PROPERTIES
+        IMPORTED_LOCATION "${ZSTD_INSTALL_DIR}/lib/zstd_static.lib"
+    )
+else()
+    set_target_properties(Zstd PROPERTIES
+        IMPORTED_LOCATION "${ZSTD_INSTALL_DIR}/lib/libzstd.a"
+    )
+endif()
@@ -8,18 +8,19 @@
 
 #include "axle/utils/AX_Universal.hpp"
 #include "axle/utils/AX_Expected.hpp"
+#include "axle/utils/AX_NameId.hpp"
 #include "axle/utils/AX_Types.hpp"
 
-#define AX_BINDING_KEY_MATERIAL_PROPS "_res_materialProps"
-#define AX_BINDING_KEY_TEXTURE_BASE_COLOR "_res_textureBaseColor"
-#define AX_BINDING_KEY_TEXTURE_SPECULAR "_res_textureSpecular"
-#define AX_BINDING_KEY_TEXTURE_NORMAL "_res_textureNormal"
-#define AX_BINDING_KEY_TEXTURE_HEIGHTMAP "_res_textureHeightMap"
-#define AX_BINDING_KEY_TEXTURE_ROUGHNESS "_res_textureRoughness"
-#define AX_BINDING_KEY_TEXTURE_METALLIC "_res_textureMetallic"
-#define AX_BINDING_KEY_TEXTURE_AO "_res_textureAO"
-#define AX_BINDING_KEY_TEXTURE_DISPLACEMENT "_res_textureDisplacement"
-#define AX_BINDING_KEY_TEXTURE_EMISSIVE "_res_textureEmissive"
+#define AX_BINDING_KEY_MATERIAL_PROPS AX_NAME("_res_materialProps")
+#define AX_BINDING_KEY_TEXTURE_BASE_COLOR AX_NAME("_res_textureBaseColor")
+#define AX_BINDING_KEY_TEXTURE_SPECULAR AX_NAME("_res_textureSpecular")
+#define AX_BINDING_KEY_TEXTURE_NORMAL AX_NAME("_res_textureNormal")
+#define AX_BINDING_KEY_TEXTURE_HEIGHTMAP AX_NAME("_res_textureHeightMap")
+#define AX_BINDING_KEY_TEXTURE_ROUGHNESS AX_NAME("_res_textureRoughness")
+#define AX_BINDING_KEY_TEXTURE_METALLIC AX_NAME("_res_textureMetallic")
+#define AX_BINDING_KEY_TEXTURE_AO AX_NAME("_res_textureAO")
+#define AX_BINDING_KEY_TEXTURE_DISPLACEMENT AX_NAME("_res_textureDisplacement")
+#define AX_BINDING_KEY_TEXTURE_EMISSIVE AX_NAME("_res_textureEmissive")
 
 #define AX_BINDING_SLOT_MATERIAL_PROPS 0
 #define AX_BINDING_SLOT_TEXTURE_BASE_COLOR 1
@@ -37,7 +38,7 @@ namespace axle::assets
 
 gfx::TextureFormat GetTexFormatOfImg(const gfx::ImageFormat& fmt);
 
-const char* GetAssetBindKey(const MaterialTextureType& type);
+utils::NameId GetAssetBindKey(const MaterialTextureType& type);
 uint32_t GetAssetBindSlot(const MaterialTextureType& type);
 
 // TODO: Later on 
@@ -8,10 +8,12 @@
 #include "axle/data/AX_DataTemplates.hpp"
 
 #include "axle/utils/AX_MagicPool.hpp"
+#include "axle/utils/AX_NameId.hpp"
 #include "axle/utils/AX_Coordination.hpp"
 #include "axle/utils/AX_Types.hpp"
 
 #include <cstdint>
+#include <memory_resource>
 #include <vector>
 #include <string>
 #include <unordered_map>
@@ -26,7 +28,7 @@ using MeshId = uint32_t;
 
 struct Node {
     NodeId nodeId{-1};
-    std::string name{"ROOT"};
+    utils::NameId name{AX_NAME("ROOT")};
     utils::Coordination transform{};
 
     std::vector<MeshId> meshIds{};
@@ -136,7 +138,7 @@ private:
     utils::SRaw m_Copy;
 };
 
-using MetadataMap = std::unordered_map<std::string, Metadata>;
+using MetadataMap = std::unordered_map<utils::NameId, Metadata>;
 
 struct AssetBuffer {
     AssetBufferType type;
@@ -370,6 +372,7 @@ enum class AssetImportFlag : uint32_t {
 struct AssetImportDesc {
     uint32_t flags{uint32_t(AssetImportFlag::CalcTangents)};
     float opaquenessThreshold{0.05f};
+    std::pmr::memory_resource* bufferResource{nullptr}; // Heap for imported vertex/index data (e.g. a TlsfAllocator), nullptr: default resource
 };
 
 class IAssetImporter {
@@ -383,6 +386,10 @@ public:
         return m_Desc.flags & static_cast<uint32_t>(flag);
     }
 
+    std::pmr::memory_resource* GetBufferResource() const {
+        return m_Desc.bufferResource ? m_Desc.bufferResource : std::pmr::get_default_resource();
+    }
+
     virtual utils::ExResult<AssetImportResult> Import() = 0;
     virtual std::string GetImporterName() const = 0;
 };
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "axle/data/AX_IDataStream.hpp"
+#include "axle/data/AX_DataStreamImplMMap.hpp"
+
+#include "axle/utils/AX_Expected.hpp"
+#include "axle/utils/AX_Span.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <cstdint>
+#include <filesystem>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+namespace axle::assets
+{
+
+// .axpak layout, all fields little-endian:
+//   AssetPackHeader (64 bytes)
+//   AssetPackEntry[entryCount], sorted by (pathHash, path)
+//   path strings, referenced by entries (not NUL-terminated)
+//   blobs, each starting on a PACK_ALIGNMENT boundary
+// Entries are 64 bytes so the table can be used in place from a mapping. Compressed blobs are whole
+// data::CompressedWriteStream streams, so large ones can also be read block by block.
+
+static constexpr uint8_t PACK_MAGIC[8] = {'A', 'X', 'P', 'A', 'K', '\r', '\n', 0x1A};
+static constexpr uint32_t PACK_VERSION = 1;
+static constexpr uint64_t PACK_ALIGNMENT = 64;
+
+enum class PackCompression : uint32_t {
+    None = 0,
+    LZ4 = 1, // Same values as data::CompressionCodec
+    Zstd = 2
+};
+
+struct AssetPackHeader {
+    uint8_t magic[8];
+    uint32_t version;
+    uint32_t entryCount;
+    uint64_t tocOffset;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+    uint64_t dataOffset;
+    uint64_t tocChecksum; // Over the entry table and the path strings
+    uint64_t reserved;
+};
+
+struct AssetPackEntry {
+    uint64_t pathHash;    // utils::NameHash() of the path
+    uint64_t offset;      // Of the stored bytes, from the start of the pack
+    uint64_t size;        // Stored bytes
+    uint64_t rawSize;     // Bytes after decompression, equals size when uncompressed
+    uint64_t checksum;    // XXH64 of the stored bytes
+    uint32_t pathOffset;  // Into the path strings
+    uint32_t pathLength;
+    uint32_t compression; // PackCompression
+    uint32_t flags;
+    uint64_t reserved;
+};
+
+static_assert(sizeof(AssetPackHeader) == 64);
+static_assert(sizeof(AssetPackEntry) == 64);
+
+// XXH64, seed 0
+uint64_t PackChecksum(const void* data, std::size_t size);
+
+// Pack paths use '/' separators and are relative ("textures/wall.png"), lookups must spell them the same way
+std::string NormalizePackPath(std::string_view path);
+
+// Collects blobs, then writes the whole archive in one sequential pass
+class AssetPacker {
+private:
+    struct Pending {
+        std::string path;
+        utils::URaw bytes;
+        uint64_t rawSize;
+        uint64_t checksum;
+        PackCompression compression;
+    };
+
+    std::vector<Pending> m_Entries{};
+    std::unordered_set<std::string> m_Paths{}; // Duplicate check
+
+    // Write order: by path hash, then path. Fills `hashes` indexed like m_Entries.
+    std::vector<uint32_t> SortEntries(std::vector<uint64_t>& hashes) const;
+public:
+    AssetPacker() = default;
+
+    // `bytes` is kept (shared, not copied) until the packer is destroyed. Compression happens here; blobs it
+    // does not shrink are stored uncompressed.
+    utils::ExError Add(std::string_view path, utils::URaw bytes, PackCompression compression = PackCompression::None);
+
+    // Maps the file, its pages are read when hashing and again on Write()
+    utils::ExError AddFile(std::string_view path, const std::filesystem::path& file, PackCompression compression = PackCompression::None);
+
+    // Every regular file below `dir`, under its relative path prefixed by `prefix`
+    utils::ExError AddDirectory(const std::filesystem::path& dir, std::string_view prefix = {},
+                                PackCompression compression = PackCompression::None);
+
+    std::size_t GetEntryCount() const { return m_Entries.size(); }
+
+    // Exact size Write() produces, to size a BufferDataStream up front
+    uint64_t GetPackSize() const;
+
+    // Writes from the stream's current write index, which should be 0 since offsets are absolute
+    utils::ExError Write(data::IDataStream& out) const;
+};
+
+// Read side of an .axpak. Lookups binary-search the sorted entry table, blobs are handed out as views of the
+// backing bytes (a file mapping or a buffer) without copying.
+class AssetPack {
+private:
+    std::filesystem::path m_Path{};
+    data::MMapAdvice m_Advice{data::MMapAdvice::Normal};
+
+    UniquePtr<data::MMapDataStream> m_Stream{}; // nullptr for packs already in memory
+    utils::URaw m_Bytes{}; // Whole pack, keeps the mapping alive
+    std::vector<AssetPackEntry> m_SwappedEntries{}; // Big-endian hosts only
+    utils::Span<const AssetPackEntry> m_Entries{};
+    const char* m_Names{nullptr};
+    uint64_t m_NamesSize{0};
+
+    bool m_Opened{false};
+
+    utils::ExError Parse();
+public:
+    explicit AssetPack(const std::filesystem::path& path, data::MMapAdvice advice = data::MMapAdvice::Normal);
+    explicit AssetPack(utils::URaw bytes); // Pack already in memory (e.g. written to a BufferDataStream)
+
+    utils::ExError Open();
+
+    utils::Span<const AssetPackEntry> GetEntries() const { return m_Entries; }
+    std::string_view GetPath(const AssetPackEntry& entry) const;
+
+    // nullptr when missing
+    const AssetPackEntry* Find(std::string_view path) const;
+
+    // Starts paging the entry in, View() and Load() do it on their own
+    utils::ExError Prefetch(const AssetPackEntry& entry) const;
+
+    // Stored bytes in place, valid while the pack lives; fails for compressed entries. Not checksummed, call
+    // Verify() first on packs from untrusted sources.
+    utils::ExResult<utils::Span<const uint8_t>> View(const AssetPackEntry& entry) const;
+
+    // Contents as a buffer that keeps the pack's storage alive; compressed entries are verified and then decoded
+    // into a new buffer. Uncompressed entries are handed out as is, like View().
+    utils::ExResult<utils::URaw> Load(const AssetPackEntry& entry) const;
+
+    // Hashes the stored bytes against the entry's checksum
+    utils::ExError Verify(const AssetPackEntry& entry) const;
+};
+
+}
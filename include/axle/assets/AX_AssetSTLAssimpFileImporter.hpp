@@ -10,6 +10,8 @@
 #include <assimp/scene.h>
 
 #include <filesystem>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace axle::assets
@@ -34,16 +36,6 @@ private:
     std::filesystem::path m_Path;
     std::vector<utils::ExError> m_Errors;
 
-    struct AssimpNodeProcessParams {
-        const aiNode* node;
-        const aiScene* scene;
-        Node& outNode;
-        AssetImportResult& result;
-        uint32_t& meshIdx;
-        uint32_t& buffIdx;
-        uint32_t& nodeIdx;
-    };
-
     struct AssimpLightProcessParams {
         const aiScene* scene;
         AssetImportResult& result;
@@ -59,8 +51,19 @@ private:
     struct AssimpMeshProcessParams {
         const aiMesh* mesh;
         AssetImportResult& result;
+        uint32_t meshIdx;
+        uint32_t buffIdx; // vertex buffer, index buffer follows
+    };
+
+    struct AssimpNodeProcessParams {
+        const aiNode* node;
+        const aiScene* scene;
+        Node& outNode;
+        AssetImportResult& result;
         uint32_t& meshIdx;
         uint32_t& buffIdx;
+        uint32_t& nodeIdx;
+        std::vector<AssimpMeshProcessParams>& meshJobs; // processed in parallel after traversal
     };
 
     struct AssimpMaterialProcessParams {
@@ -68,6 +71,7 @@ private:
         AssetImportResult& result;
         const uint32_t& matIdx;
         std::vector<AssetTexture>& asset_texs;
+        const std::unordered_map<std::string, utils::ExResult<gfx::Image>>& prefetched; // External textures by path, decoded
     };
 
     void ProcessNode(const AssimpNodeProcessParams& params);
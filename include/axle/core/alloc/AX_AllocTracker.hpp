@@ -0,0 +1,108 @@
+#pragma once
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+
+namespace axle::core
+{
+
+enum class AllocTag : uint8_t {
+    General,
+    Assets,
+    Gfx,
+    Audio,
+    Text,
+    Scene,
+    Count
+};
+
+enum class AllocSource : uint8_t {
+    Heap,   // Global new/delete
+    Linear, // LinearAllocator (and FrameAllocator arenas)
+    Pool,
+    Tlsf,
+    Arena,  // VirtualArena
+    Count
+};
+
+const char* AllocTagName(AllocTag tag);
+const char* AllocSourceName(AllocSource source);
+
+struct AllocCounters {
+    uint64_t allocs{0};
+    uint64_t frees{0};
+    uint64_t allocatedBytes{0}; // Cumulative
+    int64_t liveBytes{0};
+    int64_t peakBytes{0};
+
+    int64_t LiveCount() const { return int64_t(allocs) - int64_t(frees); }
+};
+
+struct AllocTrackerSnapshot {
+    AllocCounters cells[size_t(AllocSource::Count)][size_t(AllocTag::Count)]{};
+    uint64_t sampleSerial{0}; // Callstack samples recorded so far
+
+    const AllocCounters& At(AllocSource source, AllocTag tag) const { return cells[size_t(source)][size_t(tag)]; }
+    AllocCounters Total(AllocSource source) const;
+};
+
+// Counts allocations by source and subsystem tag. The hot path only touches the calling thread's own counters;
+// byte deltas are folded into shared live/peak totals every FLUSH_BYTES, so peaks are exact to within
+// FLUSH_BYTES per active thread. Counting is compiled in with AX_ENABLE_ALLOC_TRACKING (__AX_ALLOC_TRACKING__),
+// which also routes global new/delete through the tracker; tags and scopes are always available.
+class AllocTracker {
+public:
+    static constexpr int64_t FLUSH_BYTES = 64 * 1024;
+    static constexpr uint32_t MAX_FRAMES = 16;
+    static constexpr uint32_t SAMPLE_SLOTS = 4096;
+
+    static void OnAlloc(AllocSource source, AllocTag tag, size_t bytes, uint64_t count = 1);
+    static void OnFree(AllocSource source, AllocTag tag, size_t bytes, uint64_t count = 1);
+
+    static AllocTag CurrentTag();
+    static void SetCurrentTag(AllocTag tag);
+
+    // Records the callstack of every Nth heap allocation per thread while it stays live, 0 disables
+    static void SetSampleRate(uint32_t everyN);
+    static uint32_t GetSampleRate();
+
+    static AllocTrackerSnapshot Snapshot();
+    static void ReportLeaks(std::ostream& out); // Live bytes per source/tag, then sampled live callstacks
+    // Only what became live after `baseline`, so statics set up before it are not reported
+    static void ReportLeaks(std::ostream& out, const AllocTrackerSnapshot& baseline);
+
+    // Heap hooks for the global operator new/delete replacements
+    static bool ShouldSample();
+    static bool RecordSample(void* ptr, size_t bytes, AllocTag tag); // false when the sample table is full
+    static void EraseSample(void* ptr);
+};
+
+class AllocTagScope {
+private:
+    AllocTag m_Previous;
+public:
+    explicit AllocTagScope(AllocTag tag) : m_Previous(AllocTracker::CurrentTag()) { AllocTracker::SetCurrentTag(tag); }
+    ~AllocTagScope() { AllocTracker::SetCurrentTag(m_Previous); }
+
+    AX_NON_COPYABLE_NON_MOVABLE(AllocTagScope)
+};
+
+}
+
+#define AX_ALLOC_CONCAT_IMPL(a, b) a##b
+#define AX_ALLOC_CONCAT(a, b) AX_ALLOC_CONCAT_IMPL(a, b)
+
+// Heap allocations in this scope are charged to `tag`, as are allocators constructed in it
+#define AX_ALLOC_TAG(tag) ::axle::core::AllocTagScope AX_ALLOC_CONCAT(_axAllocTag, __LINE__){::axle::core::AllocTag::tag}
+
+#ifdef __AX_ALLOC_TRACKING__
+#define AX_TRACK_ALLOC(source, tag, bytes, count) ::axle::core::AllocTracker::OnAlloc(source, tag, bytes, count)
+#define AX_TRACK_FREE(source, tag, bytes, count) ::axle::core::AllocTracker::OnFree(source, tag, bytes, count)
+#else
+#define AX_TRACK_ALLOC(source, tag, bytes, count) ((void)0)
+#define AX_TRACK_FREE(source, tag, bytes, count) ((void)0)
+#endif
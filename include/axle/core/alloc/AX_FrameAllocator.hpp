@@ -2,17 +2,60 @@
 
 #include "axle/core/alloc/AX_LinearAllocator.hpp"
 
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
 namespace axle::core
 {
 
-class FrameAllocator {
+// Double-buffered frame arena: memory handed out during frame N stays valid until BeginFrame() of frame N + 2.
+// Allocate() is safe from any thread (e.g. job workers recording for the owner), BeginFrame() is owner only.
+// When a frame outgrows its arena the excess comes from `upstream` and the arena grows on its next reuse.
+class FrameAllocator : public std::pmr::memory_resource {
 private:
-    LinearAllocator m_arena;
+    struct OverflowBlock {
+        void* ptr;
+        size_t size;
+        size_t align;
+    };
+
+    struct Frame {
+        UniquePtr<LinearAllocator> arena;
+        std::vector<OverflowBlock> overflow{};
+        size_t overflowBytes{0};
+    };
+
+    Frame m_Frames[2];
+    std::atomic<uint32_t> m_Current{0};
+    size_t m_TargetSize;
+
+    std::pmr::memory_resource* m_Upstream;
+    std::mutex m_OverflowMutex{};
+    std::atomic<uint64_t> m_OverflowCount{0};
+
+    void* AllocateOverflow(Frame& frame, size_t size, size_t align);
+    void ReleaseFrame(Frame& frame);
 public:
-    FrameAllocator(size_t size);
+    explicit FrameAllocator(size_t size, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource());
+    ~FrameAllocator() override;
+
+    AX_NON_COPYABLE_NON_MOVABLE(FrameAllocator)
 
     void* Allocate(size_t size, size_t align = 8);
     void BeginFrame();
+
+    size_t GetUsed() const { return m_Frames[m_Current.load(std::memory_order_relaxed)].arena->GetUsed(); }
+    size_t GetCapacity() const { return m_Frames[m_Current.load(std::memory_order_relaxed)].arena->GetSize(); }
+    uint64_t GetOverflowCount() const { return m_OverflowCount.load(std::memory_order_relaxed); }
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {} // Released in bulk by BeginFrame()
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
 };
 
-}
\ No newline at end of file
+}
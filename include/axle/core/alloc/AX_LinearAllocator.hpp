@@ -1,5 +1,10 @@
 #pragma once
 
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
 #include <cstdint>
 #include <cstdlib>
 #include <cassert>
@@ -7,17 +12,32 @@
 namespace axle::core
 {
 
+// Bump allocator, Allocate() is lock-free and safe from any thread; Reset()/Resize() must not race it
 class LinearAllocator {
 private:
     uint8_t* m_memory;
     size_t m_size;
-    size_t m_offset;
+    std::atomic<size_t> m_offset;
+
+    AllocTag m_Tag{AllocTracker::CurrentTag()};
+#ifdef __AX_ALLOC_TRACKING__
+    std::atomic<uint64_t> m_Allocations{0};
+#endif
+    void TrackReset();
 public:
     LinearAllocator(size_t size);
     ~LinearAllocator();
 
-    void* Allocate(size_t size, size_t alignment = 8);
+    AX_NON_COPYABLE_NON_MOVABLE(LinearAllocator)
+
+    void* Allocate(size_t size, size_t alignment = 8); // nullptr when full
     void Reset();
+    void Resize(size_t size); // Drops the contents
+
+    void SetTag(AllocTag tag) { m_Tag = tag; }
+
+    size_t GetUsed() const { return m_offset.load(std::memory_order_relaxed); }
+    size_t GetSize() const { return m_size; }
 };
 
-}
\ No newline at end of file
+}
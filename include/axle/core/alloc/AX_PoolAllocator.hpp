@@ -1,21 +1,91 @@
 #pragma once
 
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <utility>
 #include <vector>
 
 namespace axle::core
 {
 
+// Fixed-size object pool: grows by chunks of `chunkObjects`, keeps an intrusive free list and honors `alignment`.
+// Each thread allocates/frees through its own magazine (up to 2 * magazineSize cached objects), the shared depot
+// is only locked to exchange whole magazines, so loaders and the gfx thread can allocate concurrently.
+// A thread's magazine goes back to the depot when the thread exits. Objects may be freed from any thread.
 class PoolAllocator {
 private:
-    void* m_memory;
-    size_t m_objectSize;
-    std::vector<void*> m_freeList;
+    struct FreeNode {
+        FreeNode* next;      // Next object in the magazine
+        FreeNode* nextBatch; // Next magazine in the depot (head object only)
+    };
+
+    struct ThreadCache {
+        FreeNode* head{nullptr};
+        uint32_t count{0};
+        bool inUse{false}; // m_CachesMutex; reused once its thread has exited
+    };
+
+    friend struct PoolThreadCaches;
+
+    size_t m_ObjectSize;
+    size_t m_Alignment;
+    size_t m_ChunkObjects;
+    uint32_t m_MagazineSize;
+    uint64_t m_PoolId;
+
+    std::mutex m_DepotMutex{};
+    FreeNode* m_Depot{nullptr}; // Full magazines
+    FreeNode* m_Loose{nullptr}; // Objects returned by exited threads, handed out in magazine-sized runs
+    std::vector<void*> m_Chunks{};
+    uint8_t* m_ChunkCursor{nullptr};
+    uint8_t* m_ChunkEnd{nullptr};
+
+    std::mutex m_CachesMutex{};
+    std::vector<UniquePtr<ThreadCache>> m_Caches{};
+
+    std::atomic<size_t> m_Capacity{0};
+    AllocTag m_Tag{AllocTracker::CurrentTag()};
+
+    ThreadCache& GetThreadCache();
+    bool Refill(ThreadCache& cache);
+    void Flush(ThreadCache& cache);
+    void ReleaseThreadCache(ThreadCache& cache); // Owning thread exited
+    bool Grow(); // m_DepotMutex held
 public:
-    PoolAllocator(size_t objectSize, size_t capacity);
+    PoolAllocator(size_t objectSize, size_t chunkObjects, size_t alignment = alignof(std::max_align_t), uint32_t magazineSize = 32);
     ~PoolAllocator();
 
-    void* Allocate();
+    AX_NON_COPYABLE_NON_MOVABLE(PoolAllocator)
+
+    void* Allocate(); // nullptr only when the system is out of memory
     void Free(void* ptr);
+
+    template <typename T, typename... Args>
+    T* New(Args&&... args) {
+        void* ptr = Allocate();
+        if (!ptr) return nullptr;
+        return ::new (ptr) T(std::forward<Args>(args)...);
+    }
+
+    template <typename T>
+    void Delete(T* obj) {
+        if (!obj) return;
+        obj->~T();
+        Free(obj);
+    }
+
+    void SetTag(AllocTag tag) { m_Tag = tag; }
+
+    size_t GetObjectSize() const { return m_ObjectSize; }
+    size_t GetAlignment() const { return m_Alignment; }
+    size_t GetCapacity() const { return m_Capacity.load(std::memory_order_relaxed); } // Objects across all chunks
 };
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <vector>
+
+namespace axle::core
+{
+
+enum class TlsfBacking : uint8_t {
+    Malloc,
+    VirtualMemory, // mmap / VirtualAlloc, pages are returned to the OS on destruction
+    UserBuffer     // Fixed, caller-owned region; never grows
+};
+
+struct TlsfDesc {
+    TlsfBacking backing{TlsfBacking::Malloc};
+    size_t poolSize{16ull << 20};
+    size_t growSize{16ull << 20}; // 0: fail instead of adding pools
+    void* userBuffer{nullptr};    // UserBuffer only
+    AllocTag tag{AllocTracker::CurrentTag()};
+};
+
+struct TlsfStats {
+    size_t usedBytes{0};    // Payload bytes handed out
+    size_t peakBytes{0};
+    size_t freeBytes{0};
+    size_t largestFree{0};
+    size_t poolBytes{0};    // Reserved from the backing
+    uint64_t allocations{0}; // Live
+    uint32_t pools{0};
+
+    double Fragmentation() const { return freeBytes ? 1.0 - double(largestFree) / double(freeBytes) : 0.0; }
+};
+
+// Two-Level Segregated Fit heap: O(1) Allocate/Free with bounded fragmentation, for long-lived variable-size data
+// (asset buffers, glyph bitmaps, metadata). Thread-safe, calls are serialized by a mutex.
+class TlsfAllocator : public std::pmr::memory_resource {
+public:
+    static constexpr size_t ALIGN_LOG2 = 4;
+    static constexpr size_t ALIGN = size_t(1) << ALIGN_LOG2;
+    static constexpr uint32_t SL_LOG2 = 5;
+    static constexpr uint32_t SL_COUNT = 1u << SL_LOG2;
+    static constexpr uint32_t FL_SHIFT = SL_LOG2 + ALIGN_LOG2;
+    static constexpr uint32_t FL_MAX_LOG2 = 40;
+    static constexpr uint32_t FL_COUNT = FL_MAX_LOG2 - FL_SHIFT + 1;
+    static constexpr size_t SMALL_BLOCK = size_t(1) << FL_SHIFT;
+private:
+    struct Block {
+        Block* prevPhys; // Valid only while the previous block is free
+        size_t sizeFlags; // Payload size | FREE | PREV_FREE
+        Block* nextFree; // Free blocks only, overlaps the payload
+        Block* prevFree;
+    };
+
+    struct Pool {
+        void* memory;
+        size_t size;
+    };
+
+    TlsfDesc m_Desc;
+
+    uint32_t m_FlBitmap{0};
+    uint32_t m_SlBitmap[FL_COUNT]{};
+    Block* m_Blocks[FL_COUNT][SL_COUNT]{};
+
+    std::vector<Pool> m_Pools{};
+    TlsfStats m_Stats{};
+    mutable std::mutex m_Mutex{};
+
+    bool AddPool(size_t size);
+    void InsertFree(Block* block);
+    void RemoveFree(Block* block);
+    Block* FindFree(size_t size);
+    Block* Split(Block* block, size_t size);
+    Block* Merge(Block* block);
+    void* Use(Block* block, size_t size);
+public:
+    explicit TlsfAllocator(const TlsfDesc& desc = {});
+    ~TlsfAllocator() override;
+
+    AX_NON_COPYABLE_NON_MOVABLE(TlsfAllocator)
+
+    void* Allocate(size_t size, size_t align = ALIGN); // nullptr when out of memory
+    void Free(void* ptr);
+
+    size_t GetBlockSize(const void* ptr) const; // Usable bytes behind ptr
+    TlsfStats GetStats() const;
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* ptr, size_t, size_t) override { Free(ptr); }
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+
+namespace axle::core
+{
+
+struct VirtualArenaDesc {
+    size_t reserveSize{4ull << 30};     // Address space only, nothing is committed up front
+    size_t commitStep{2ull << 20};      // Commit granularity while growing
+    size_t retainOnReset{64ull << 20};  // Reset() returns committed pages above this high-water mark to the OS
+    bool hugePages{false};              // MADV_HUGEPAGE hint (Linux), commitStep should then be a multiple of 2 MiB
+};
+
+struct ArenaMarker {
+    size_t offset{0};
+    uint64_t allocations{0};
+};
+
+// Reserve-then-commit bump arena: pages are committed as the offset crosses them, so it grows to the
+// reservation without relocating. Allocate() is lock-free unless it has to commit; markers/Rollback() and
+// Reset() must not race allocations. Falls back to a single upfront block where virtual memory is unavailable.
+class VirtualArena : public std::pmr::memory_resource {
+private:
+    VirtualArenaDesc m_Desc;
+
+    uint8_t* m_Base{nullptr};
+    size_t m_Reserved{0};
+    std::atomic<size_t> m_Offset{0};
+    std::atomic<size_t> m_Committed{0};
+    std::atomic<size_t> m_Peak{0};
+    std::atomic<uint64_t> m_Allocations{0};
+
+    std::mutex m_CommitMutex{};
+    AllocTag m_Tag{AllocTracker::CurrentTag()};
+
+    bool Commit(size_t end);
+    void Decommit(size_t from);
+public:
+    explicit VirtualArena(const VirtualArenaDesc& desc = {});
+    ~VirtualArena() override;
+
+    AX_NON_COPYABLE_NON_MOVABLE(VirtualArena)
+
+    void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t)); // nullptr when the reservation is exhausted
+
+    template <typename T>
+    T* AllocateArray(size_t count) { return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T))); }
+
+    ArenaMarker GetMarker() const;
+    void Rollback(const ArenaMarker& marker); // Frees everything allocated after `marker`
+    void Reset(); // Rollback to empty, then decommit above retainOnReset
+
+    void SetTag(AllocTag tag) { m_Tag = tag; }
+
+    size_t GetUsed() const { return m_Offset.load(std::memory_order_relaxed); }
+    size_t GetCommitted() const { return m_Committed.load(std::memory_order_relaxed); }
+    size_t GetReserved() const { return m_Reserved; }
+    size_t GetPeak() const { return m_Peak.load(std::memory_order_relaxed); }
+protected:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void*, size_t, size_t) override {} // Released by Rollback()/Reset()
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Rolls the arena back to where it was on construction
+class ArenaScope {
+private:
+    VirtualArena& m_Arena;
+    ArenaMarker m_Marker;
+public:
+    explicit ArenaScope(VirtualArena& arena) : m_Arena(arena), m_Marker(arena.GetMarker()) {}
+    ~ArenaScope() { m_Arena.Rollback(m_Marker); }
+
+    AX_NON_COPYABLE_NON_MOVABLE(ArenaScope)
+};
+
+}
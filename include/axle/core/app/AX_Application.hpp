@@ -5,6 +5,8 @@
 
 #include "axle/graphics/ctx/AX_IRenderContext.hpp"
 
+#include "axle/tick/AX_FixedStepScheduler.hpp"
+
 #include "axle/utils/AX_Types.hpp"
 
 #include <atomic>
@@ -15,10 +17,13 @@ namespace axle::core
 struct ApplicationSpec {
     WindowSpec wndspec{};
     ChNanos fixedWndRate = ChNanos(0);
-    ChMillis fixedTickRate = ChMillis(50);
+    ChNanos fixedTickRate = ChMillis(50); // 0 => one variable step per loop
+    uint32_t maxCatchUpSteps{5};
     bool enforceGfxType{false};
     gfx::GfxType enforcedGfxType{gfx::GfxType::VK};
     gfx::SurfaceDesc surfaceDesc{};
+    ThreadSpec wndThreadSpec{.name = "AX Window"};
+    ThreadSpec gfxThreadSpec{.name = "AX Gfx", .allocTag = AllocTag::Gfx};
 };
 
 class Application {
@@ -26,6 +31,8 @@ private:
     SharedPtr<ThreadContextWnd> m_WndThread{std::make_shared<ThreadContextWnd>()};
     SharedPtr<ThreadContextGfx> m_GfxThread{std::make_shared<ThreadContextGfx>()};
 
+    tick::FixedStepScheduler m_Scheduler{};
+
     std::atomic_bool m_FirstInit{true};
 public:
     utils::ExError InitCurrent(
@@ -39,6 +46,9 @@ public:
     SharedPtr<ThreadContextWnd> GetWindowThread() const { return m_WndThread; }
     SharedPtr<ThreadContextGfx> GetGraphicsThread() const { return m_GfxThread; };
 
+    tick::FixedStepScheduler& GetScheduler() { return m_Scheduler; }
+    float GetInterpolationAlpha() const { return m_Scheduler.GetAlpha(); } // For the gfx thread
+
     SharedPtr<DiscreteState> GetState() { return m_WndThread->GetContext()->GetDiscreteState(); };
 
     bool IsRunning() {
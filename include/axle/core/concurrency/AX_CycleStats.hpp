@@ -0,0 +1,116 @@
+#pragma once
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace axle::core
+{
+
+// Log-linear buckets (HDR style): exact below 8, then 8 sub-buckets per power of two (<= 12.5% error)
+struct HistogramBuckets {
+    static constexpr uint32_t SUB_BITS = 3;
+    static constexpr uint32_t SUB_COUNT = 1u << SUB_BITS;
+    static constexpr uint32_t COUNT = (64 - SUB_BITS + 1) * SUB_COUNT;
+
+    static constexpr uint32_t IndexOf(uint64_t value) {
+        if (value < SUB_COUNT) return static_cast<uint32_t>(value);
+        uint32_t exp = 63 - std::countl_zero(value);
+        uint32_t sub = static_cast<uint32_t>(value >> (exp - SUB_BITS)) & (SUB_COUNT - 1);
+        return (exp - SUB_BITS + 1) * SUB_COUNT + sub;
+    }
+
+    static constexpr uint64_t LowerBound(uint32_t idx) {
+        if (idx < SUB_COUNT) return idx;
+        uint32_t exp = idx / SUB_COUNT + SUB_BITS - 1;
+        return (uint64_t(SUB_COUNT + idx % SUB_COUNT)) << (exp - SUB_BITS);
+    }
+
+    static constexpr uint64_t UpperBound(uint32_t idx) {
+        if (idx < SUB_COUNT) return idx;
+        uint32_t exp = idx / SUB_COUNT + SUB_BITS - 1;
+        return LowerBound(idx) + (uint64_t(1) << (exp - SUB_BITS)) - 1;
+    }
+};
+
+struct HistogramSnapshot {
+    std::array<uint64_t, HistogramBuckets::COUNT> counts{};
+    uint64_t count{0};
+    uint64_t sum{0};
+    uint64_t max{0};
+
+    double Mean() const { return count ? double(sum) / double(count) : 0.0; }
+    uint64_t Percentile(double p) const; // Upper bound of the bucket holding the p-th (0..1) sample
+
+    HistogramSnapshot operator-(const HistogramSnapshot& older) const; // max stays the newer one's
+};
+
+// Single writer (the owning thread), any number of readers; relaxed counters, no locks
+class AtomicHistogram {
+private:
+    std::array<std::atomic<uint64_t>, HistogramBuckets::COUNT> m_Counts{};
+    std::atomic<uint64_t> m_Count{0};
+    std::atomic<uint64_t> m_Sum{0};
+    std::atomic<uint64_t> m_Max{0};
+
+    static void Bump(std::atomic<uint64_t>& counter, uint64_t by) {
+        counter.store(counter.load(std::memory_order_relaxed) + by, std::memory_order_relaxed);
+    }
+public:
+    void Record(uint64_t value) {
+        Bump(m_Counts[HistogramBuckets::IndexOf(value)], 1);
+        Bump(m_Count, 1);
+        Bump(m_Sum, value);
+        if (value > m_Max.load(std::memory_order_relaxed))
+            m_Max.store(value, std::memory_order_relaxed);
+    }
+
+    HistogramSnapshot Snapshot() const;
+};
+
+struct CycleStatsSnapshot {
+    HistogramSnapshot cycleTime{};     // ns spent running tasks + works
+    HistogramSnapshot waitTime{};      // ns spent sleeping / idling after the cycle
+    HistogramSnapshot tasksPerCycle{}; // tasks drained from the inbox
+    HistogramSnapshot queueDepth{};    // tasks already waiting once the task phase finished
+    uint64_t cycles{0};
+    uint64_t deadlineMisses{0};        // cycles whose cycleTime exceeded the cycle time cap
+
+    CycleStatsSnapshot operator-(const CycleStatsSnapshot& older) const;
+
+    static std::string CsvHeader();
+    std::string ToCsvRow(std::string_view name) const;
+    std::string ToJson() const;
+};
+
+class CycleStats {
+private:
+    AtomicHistogram m_CycleTime{};
+    AtomicHistogram m_WaitTime{};
+    AtomicHistogram m_TasksPerCycle{};
+    AtomicHistogram m_QueueDepth{};
+    std::atomic<uint64_t> m_Cycles{0};
+    std::atomic<uint64_t> m_DeadlineMisses{0};
+public:
+    // Owner thread only
+    void RecordCycle(ChNanos cycleTime, ChNanos waitTime, uint32_t tasks, uint32_t queueDepth, bool deadlineMiss) {
+        m_CycleTime.Record(static_cast<uint64_t>(std::max<int64_t>(cycleTime.count(), 0)));
+        m_WaitTime.Record(static_cast<uint64_t>(std::max<int64_t>(waitTime.count(), 0)));
+        m_TasksPerCycle.Record(tasks);
+        m_QueueDepth.Record(queueDepth);
+        m_Cycles.store(m_Cycles.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if (deadlineMiss)
+            m_DeadlineMisses.store(m_DeadlineMisses.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    }
+
+    // Any thread, counters are read individually so a snapshot may straddle one cycle
+    CycleStatsSnapshot Snapshot() const;
+};
+
+}
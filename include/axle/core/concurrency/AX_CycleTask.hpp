@@ -0,0 +1,11 @@
+#pragma once
+
+#include "axle/utils/AX_InplaceFunction.hpp"
+
+namespace axle::core
+{
+
+// Move-only void() callable, stored inline when it fits, heap otherwise
+using CycleTask = InplaceFunction<void(), 64>;
+
+}
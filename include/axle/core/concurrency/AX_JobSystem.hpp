@@ -0,0 +1,133 @@
+#pragma once
+
+#include "axle/core/concurrency/AX_ThreadSpec.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace axle::core
+{
+
+struct JobEntry;
+
+// Counts outstanding jobs, jobs queued via RunAfter() are released once it reaches zero. Dropping to zero is the
+// last access of the releasing thread, so the counter may be destroyed as soon as IsDone() or Wait() says so.
+class JobCounter {
+private:
+    std::atomic<uint32_t> m_Pending{0};
+
+    std::mutex m_ContinuationMutex{};
+    std::vector<JobEntry*> m_Continuations{};
+    bool m_Sealed{false}; // Continuations taken by the last job, guarded by m_ContinuationMutex
+
+    friend class JobSystem;
+public:
+    JobCounter() = default;
+
+    AX_NON_COPYABLE_NON_MOVABLE(JobCounter)
+
+    bool IsDone() const { return m_Pending.load(std::memory_order_acquire) == 0; }
+    uint32_t GetPending() const { return m_Pending.load(std::memory_order_relaxed); }
+};
+
+struct JobEntry {
+    VoidJob job{};
+    JobCounter* counter{nullptr};
+};
+
+// Chase-Lev deque: owner pushes/pops at the bottom, thieves steal from the top
+class WorkStealingDeque {
+private:
+    std::atomic<int64_t> m_Top{0};
+    std::atomic<int64_t> m_Bottom{0};
+
+    std::unique_ptr<std::atomic<JobEntry*>[]> m_Buffer;
+    int64_t m_Mask;
+public:
+    explicit WorkStealingDeque(uint32_t capacity = 4096); // rounded up to pow2
+
+    AX_NON_COPYABLE_NON_MOVABLE(WorkStealingDeque)
+
+    bool Push(JobEntry* entry); // owner only, false when full
+    JobEntry* Pop();            // owner only
+    JobEntry* Steal();          // any thread
+};
+
+class JobSystem;
+
+// co_await jobs.Schedule() resumes the coroutine on a worker, never on a thread helping in Wait()
+struct JobScheduleAwaiter {
+    JobSystem& jobs;
+
+    bool await_ready() const;
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
+};
+
+using ParallelForFunc = FunctionRef<void(uint32_t begin, uint32_t end)>;
+
+class JobSystem {
+private:
+    std::vector<UniquePtr<WorkStealingDeque>> m_Deques{};
+    std::vector<std::thread> m_Workers{};
+
+    std::deque<JobEntry*> m_Injected{}; // submissions from non-worker threads
+    std::mutex m_InjectMutex{};
+
+    std::atomic<uint32_t> m_Queued{0};
+    std::atomic<uint32_t> m_Sleeping{0};
+    std::atomic_bool m_Running{true};
+
+    std::mutex m_WakeMutex{};
+    std::condition_variable m_WakeCV{};
+
+    std::mutex m_SpecMutex{};
+    utils::ExError m_SpecError{utils::ExError::NoError()};
+
+    void WorkerLoop(uint32_t workerIdx, ThreadSpec spec);
+
+    void Submit(JobEntry* entry);
+    JobEntry* FindJob();
+    JobEntry* FindJobFor(JobCounter& counter); // Injected jobs of `counter` only
+    void Execute(JobEntry* entry);
+    void AddPending(JobCounter* counter);
+    void Release(JobCounter* counter);
+public:
+    // Workers are named "<name> <idx>", pinned one per CPU when spec.cpus covers every worker, else share the set
+    explicit JobSystem(uint32_t workerCount = 0, const ThreadSpec& spec = {}); // 0 => hardware_concurrency - 1
+    ~JobSystem();
+
+    AX_NON_COPYABLE_NON_MOVABLE(JobSystem)
+
+    static JobSystem& Global();
+    static void SetGlobalSpec(ThreadSpec spec); // Only effective before the first Global() call
+
+    utils::ExError GetSpecError();
+
+    JobScheduleAwaiter Schedule() { return {*this}; }
+
+    void Run(VoidJob job, JobCounter* counter = nullptr);
+    void RunAfter(JobCounter& dependency, VoidJob job, JobCounter* counter = nullptr);
+
+    // Blocks until the counter drains. Workers execute any pending job meanwhile; other threads only run the
+    // counter's own jobs they submitted, so unrelated work (and Schedule() resumptions) never lands on them.
+    // Sleeps when there is nothing to help with.
+    void Wait(JobCounter& counter);
+
+    // Splits [0, count) into chunks of `grain` (0 => auto), blocks (helping) until done
+    void ParallelFor(uint32_t count, ParallelForFunc func, uint32_t grain = 0);
+
+    uint32_t GetWorkerCount() const { return static_cast<uint32_t>(m_Workers.size()); }
+    bool IsWorkerThread() const;
+};
+
+}
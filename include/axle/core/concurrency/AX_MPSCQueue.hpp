@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace axle::core
+{
+
+// Multi-producer single-consumer queue: a bounded lock-free ring (Vyukov),
+// with a mutex-guarded overflow taking over while the ring is full.
+template <typename T>
+class MPSCQueue {
+private:
+    struct Cell {
+        std::atomic<std::size_t> sequence;
+        T data;
+    };
+
+    std::unique_ptr<Cell[]> m_Cells;
+    std::size_t m_Mask;
+
+    alignas(64) std::atomic<std::size_t> m_EnqueuePos{0};
+    alignas(64) std::size_t m_DequeuePos{0}; // Consumer only
+
+    std::atomic_bool m_Overflowed{false};
+    std::mutex m_OverflowMutex{};
+    std::vector<T> m_Overflow{};
+public:
+    explicit MPSCQueue(std::size_t capacity = 1024) {
+        auto cap = std::bit_ceil(capacity < 2 ? std::size_t(2) : capacity);
+        m_Cells = std::make_unique<Cell[]>(cap);
+        m_Mask = cap - 1;
+        for (std::size_t i{0}; i < cap; i++) {
+            m_Cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    MPSCQueue(const MPSCQueue&) = delete;
+    MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+    // Bounded, fails when the ring is full
+    bool TryPush(T&& value) {
+        Cell* cell;
+        std::size_t pos = m_EnqueuePos.load(std::memory_order_relaxed);
+        while (true) {
+            cell = &m_Cells[pos & m_Mask];
+            std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+            auto dif = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (dif == 0) {
+                if (m_EnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    break;
+            } else if (dif < 0) {
+                return false;
+            } else {
+                pos = m_EnqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+        cell->data = std::move(value);
+        cell->sequence.store(pos + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Unbounded, spills into the overflow and keeps spilling until the consumer drains it (preserves FIFO per producer)
+    void Push(T&& value) {
+        if (!m_Overflowed.load(std::memory_order_acquire) && TryPush(std::move(value)))
+            return;
+        std::lock_guard<std::mutex> lock(m_OverflowMutex);
+        m_Overflow.push_back(std::move(value));
+        m_Overflowed.store(true, std::memory_order_release);
+    }
+
+    bool TryPop(T& out) {
+        Cell* cell = &m_Cells[m_DequeuePos & m_Mask];
+        std::size_t seq = cell->sequence.load(std::memory_order_acquire);
+        if (static_cast<intptr_t>(seq) - static_cast<intptr_t>(m_DequeuePos + 1) < 0)
+            return false;
+
+        out = std::move(cell->data);
+        cell->data = T{};
+        cell->sequence.store(m_DequeuePos + m_Mask + 1, std::memory_order_release);
+        m_DequeuePos++;
+        return true;
+    }
+
+    // Consumer only, ring occupancy (items spilled to the overflow are not counted)
+    std::size_t ApproxSize() const {
+        return m_EnqueuePos.load(std::memory_order_relaxed) - m_DequeuePos;
+    }
+
+    // Consumer only, appends everything currently queued to `out`. The overflow is only taken once every claimed ring
+    // slot has been consumed: a slot reserved but not yet published may hold an item its producer pushed before its
+    // overflowed ones, so until it lands the overflow waits for a later Drain().
+    void Drain(std::vector<T>& out) {
+        T value;
+        while (TryPop(value)) {
+            out.push_back(std::move(value));
+        }
+        if (m_Overflowed.load(std::memory_order_acquire)) {
+            std::lock_guard<std::mutex> lock(m_OverflowMutex);
+            while (TryPop(value)) { // Ring items that raced ahead of the overflow flag
+                out.push_back(std::move(value));
+            }
+            if (m_EnqueuePos.load(std::memory_order_acquire) != m_DequeuePos)
+                return; // Producers keep spilling while the flag stays set
+            for (auto& item : m_Overflow) {
+                out.push_back(std::move(item));
+            }
+            m_Overflow.clear();
+            m_Overflowed.store(false, std::memory_order_release);
+        }
+    }
+};
+
+}
@@ -0,0 +1,183 @@
+#pragma once
+
+#include <cassert>
+#include <coroutine>
+#include <exception>
+#include <future>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace axle::core
+{
+
+template <typename T = void>
+class Task;
+
+namespace detail
+{
+
+struct TaskPromiseBase {
+    std::coroutine_handle<> continuation{std::noop_coroutine()};
+    std::exception_ptr exception{nullptr};
+
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename P>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<P> handle) noexcept {
+            return handle.promise().continuation; // Symmetric transfer back to the awaiter
+        }
+
+        void await_resume() const noexcept {}
+    };
+
+    std::suspend_always initial_suspend() const noexcept { return {}; } // Lazy, starts on co_await
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    void unhandled_exception() noexcept { exception = std::current_exception(); }
+};
+
+template <typename T>
+struct TaskPromise : TaskPromiseBase {
+    std::optional<T> value{};
+
+    Task<T> get_return_object() noexcept;
+
+    template <typename U>
+    requires std::convertible_to<U, T>
+    void return_value(U&& v) { value.emplace(std::forward<U>(v)); }
+
+    T Result() {
+        if (exception) std::rethrow_exception(exception);
+        return std::move(*value);
+    }
+};
+
+template <>
+struct TaskPromise<void> : TaskPromiseBase {
+    Task<void> get_return_object() noexcept;
+
+    void return_void() const noexcept {}
+
+    void Result() {
+        if (exception) std::rethrow_exception(exception);
+    }
+};
+
+// Eager, self-destroying coroutine used to drive a Task from non-coroutine code
+struct DetachedTask {
+    struct promise_type {
+        DetachedTask get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        void unhandled_exception() const noexcept { std::terminate(); }
+    };
+};
+
+}
+
+// Lazy coroutine, runs when awaited and resumes the awaiter on whichever thread it finished on
+template <typename T>
+class [[nodiscard]] Task {
+public:
+    using promise_type = detail::TaskPromise<T>;
+private:
+    std::coroutine_handle<promise_type> m_Handle{nullptr};
+public:
+    Task() = default;
+    explicit Task(std::coroutine_handle<promise_type> handle) : m_Handle(handle) {}
+
+    Task(Task&& other) noexcept : m_Handle(std::exchange(other.m_Handle, nullptr)) {}
+    Task& operator=(Task&& other) noexcept {
+        if (this != &other) {
+            if (m_Handle) m_Handle.destroy();
+            m_Handle = std::exchange(other.m_Handle, nullptr);
+        }
+        return *this;
+    }
+
+    Task(const Task&) = delete;
+    Task& operator=(const Task&) = delete;
+
+    ~Task() {
+        if (m_Handle) m_Handle.destroy();
+    }
+
+    bool IsValid() const { return static_cast<bool>(m_Handle); }
+    bool IsDone() const { return !m_Handle || m_Handle.done(); }
+
+    // Awaiting an empty (default-constructed or moved-from) task is a bug
+    bool await_ready() const noexcept {
+        assert(m_Handle && "Task: awaiting an empty task");
+        return m_Handle.done();
+    }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+        m_Handle.promise().continuation = awaiting;
+        return m_Handle;
+    }
+
+    T await_resume() {
+        assert(m_Handle && "Task: awaiting an empty task");
+        return m_Handle.promise().Result();
+    }
+};
+
+namespace detail
+{
+
+template <typename T>
+inline Task<T> TaskPromise<T>::get_return_object() noexcept {
+    return Task<T>{std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline Task<void> TaskPromise<void>::get_return_object() noexcept {
+    return Task<void>{std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+// Promise is shared, set_value() may still be unwinding when the waiter returns
+template <typename T>
+DetachedTask SyncWaitImpl(Task<T> task, std::shared_ptr<std::promise<T>> result) {
+    try {
+        if constexpr (std::is_void_v<T>) {
+            co_await task;
+            result->set_value();
+        } else {
+            result->set_value(co_await task);
+        }
+    } catch (...) {
+        result->set_exception(std::current_exception());
+    }
+}
+
+template <typename T>
+DetachedTask SpawnImpl(Task<T> task) {
+    co_await task;
+}
+
+}
+
+// Blocks the calling thread until the task completes, meant for main()/tools; never call from the thread the task hops to
+template <typename T>
+T SyncWait(Task<T> task) {
+    auto result = std::make_shared<std::promise<T>>();
+    auto future = result->get_future();
+    detail::SyncWaitImpl(std::move(task), result);
+    return future.get();
+}
+
+// Starts the task without waiting, its frame is freed on completion; exceptions terminate
+template <typename T>
+void Spawn(Task<T> task) {
+    detail::SpawnImpl(std::move(task));
+}
+
+}
+
+namespace axle {
+    template <typename T = void>
+    using Task = axle::core::Task<T>;
+}
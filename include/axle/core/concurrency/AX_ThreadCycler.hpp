@@ -1,14 +1,25 @@
 #pragma once
 
-#include "axle/utils/AX_MagicPool.hpp"
+#include "axle/core/alloc/AX_FrameAllocator.hpp"
+#include "axle/core/concurrency/AX_CycleStats.hpp"
+#include "axle/core/concurrency/AX_CycleTask.hpp"
+#include "axle/core/concurrency/AX_MPSCQueue.hpp"
+#include "axle/core/concurrency/AX_ThreadSpec.hpp"
+#include "axle/core/concurrency/AX_Task.hpp"
+
+#include "axle/utils/AX_MagicSlotMap.hpp"
 #include "axle/utils/AX_Expected.hpp"
 #include "axle/utils/AX_Types.hpp"
+#include "axle/utils/AX_Universal.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <coroutine>
 #include <cstdint>
 #include <iostream>
+#include <memory_resource>
 #include <mutex>
-#include <deque>
+#include <vector>
 
 #define AX_THR_RENDER_OWNED public core::ThreadOwned<core::ThreadContextGfx>
 #define AX_THR_WINDOW_OWNED public core::ThreadOwned<core::ThreadContextWnd>
@@ -22,9 +33,15 @@ using WorkId = utils::MagicId;
 
 struct WorkHandle : public utils::MagicHandle {};
 
-struct WorkSlot : public utils::MagicInternal<WorkHandle> {
-    VoidJob job{};
-    bool alive{false};
+class ThreadCycler;
+
+// co_await thread->Schedule() resumes the coroutine on that cycler, inline if already there
+struct CycleScheduleAwaiter {
+    ThreadCycler& thread;
+
+    bool await_ready() const;
+    void await_suspend(std::coroutine_handle<> handle) const;
+    void await_resume() const noexcept {}
 };
 
 class ThreadCycler {
@@ -33,8 +50,15 @@ protected:
     bool m_Stopped{false};
     bool m_Started{false};
 
-    std::deque<VoidJob> m_CycleTasks{};
-    utils::MagicPool<WorkSlot> m_CycleWorks{utils::MagicPool<WorkSlot>(true)};
+    ThreadSpec m_Spec{};
+    utils::ExError m_SpecError{utils::ExError::NoError()}; // guarded by m_StateMutex
+
+    MPSCQueue<CycleTask> m_Inbox{1024}; // lock-free for producers, spills to a locked overflow when full
+    utils::MagicSlotMap<WorkHandle, SharedPtr<const VoidJob>> m_CycleWorks{true}; // Ordered
+
+    // Ordered view of the works, rebuilt only when they change
+    SharedPtr<const std::vector<SharedPtr<const VoidJob>>> m_WorkSnapshot{std::make_shared<const std::vector<SharedPtr<const VoidJob>>>()};
+    uint64_t m_WorkVersion{0};
 
     std::thread m_Thread{};
     std::condition_variable m_StateCV{};
@@ -43,40 +67,92 @@ protected:
     std::mutex m_CycleMutex{}, m_CycleTimeMutex{};
 
     ChNanos m_CycleTimeCap{ChNanos(0)};
+    ChNanos m_SpinTail{utils::UNI_DEFAULT_SPIN_TAIL};
+
+    // Idle mode: between cycles, block until woken (task, work change, Stop) or the cycle deadline
+    bool m_IdleWait{false};
+    ChNanos m_IdleTimeout{ChNanos(0)}; // 0 => no deadline when there is no cycle cap
+
+    std::mutex m_WakeMutex{};
+    std::condition_variable m_WakeCV{};
+    std::atomic_bool m_WakePending{false};
+    std::atomic_bool m_Idling{false};
 
     ChSteadyTimepoint m_LastCycleTimeBegin{ChSteadyClock::now()};
     ChSteadyTimepoint m_LastCycleTimeEnd{ChSteadyClock::now()};
+
+    CycleStats m_Stats{};
+
+    // One frame == one cycle, flipped at the top of every cycle
+    UniquePtr<FrameAllocator> m_FrameArena{std::make_unique<FrameAllocator>(DEFAULT_FRAME_ARENA_SIZE)};
 public:
+    static constexpr size_t DEFAULT_FRAME_ARENA_SIZE = 256 * 1024;
+
     virtual ~ThreadCycler();
 
     bool ValidateThread();
 
-    void Start();
+    void Start(ThreadSpec spec = {});
     void Stop(bool join = true);
 
     ThreadId GetThreadId();
 
+    // Result of applying the ThreadSpec on the cycler thread, settings are best-effort and never stop it
+    utils::ExError GetSpecError() {
+        std::lock_guard<std::mutex> lock(m_StateMutex);
+        return m_SpecError;
+    }
+
     ChNanos GetLastCycleTimeBegin();
     ChNanos GetLastCycleTimeEnd();
     ChNanos GetLastCycleTime(); // delta time
 
+    // Owner-thread frame scratch, valid until the end of the next cycle
+    FrameAllocator& GetFrameArena() { return *m_FrameArena; }
+
+    // Frame arena of the cycler running the calling thread, the default PMR resource elsewhere
+    static std::pmr::memory_resource* CurrentFrameResource();
+
+    // Lock-free, callable from any thread; diff two snapshots for a rolling window
+    CycleStatsSnapshot GetStats() const { return m_Stats.Snapshot(); }
+
     ChNanos GetCycleTimeCap();
     void SetCycleTimeCap(ChNanos nano_seconds);
 
-    void EnqueueTask(std::function<void()> func);
+    ChNanos GetSpinTail();
+    void SetSpinTail(ChNanos spinTail);
+
+    bool IsIdleWait();
+    void SetIdleWait(bool idleWait, ChNanos idleTimeout = ChNanos(0));
+
+    void Wake();
+
+    void EnqueueTask(CycleTask task);
     template <typename F>
     auto EnqueueFuture(F&& func) {
-        std::lock_guard<std::mutex> lock(m_CycleMutex);
-
         using Ret = decltype(func());
 
-        auto task = std::make_shared<std::packaged_task<Ret()>>(std::forward<F>(func));
-        auto future = task->get_future();
- 
-        m_CycleTasks.push_back([task]() mutable { (*task)(); });
+        std::promise<Ret> promise;
+        auto future = promise.get_future();
+
+        m_Inbox.Push([promise = std::move(promise), func = std::forward<F>(func)]() mutable {
+            try {
+                if constexpr (std::is_void_v<Ret>) {
+                    func();
+                    promise.set_value();
+                } else {
+                    promise.set_value(func());
+                }
+            } catch (...) {
+                promise.set_exception(std::current_exception());
+            }
+        });
+        Wake();
         return future;
     }
 
+    CycleScheduleAwaiter Schedule() { return {*this}; }
+
     WorkHandle CreateWork(VoidJob task, WorkId after = UINT32_MAX);
     void RemoveWork(WorkHandle wh);
     void MoveWorkToEnd(WorkHandle wh);
@@ -94,25 +170,29 @@ public:
     bool IsRunning() const { return m_Running.load(std::memory_order_relaxed); }
 protected:
     void DoCycle();
+    void IdleWait(ChSteadyTimepoint deadline, ChNanos spinTail);
+    void RebuildWorkSnapshot(); // m_CycleMutex must be held
 };
 
+// Can be run any number of times; PostCall() and Async() share the function with the queued job, so it may
+// outlive the invocation
 template<typename TResult>
 class ThreadInvocation {
-    using Function = std::function<TResult()>;
+    using Function = InplaceFunction<TResult()>;
 private:
     SharedPtr<ThreadCycler> m_Thread;
-    Function m_Function;
+    SharedPtr<Function> m_Function;
 public:
     template<typename F>
     requires std::invocable<F> &&
              std::same_as<std::invoke_result_t<F>, TResult>
     ThreadInvocation(SharedPtr<ThreadCycler> thread, F&& func)
         : m_Thread(std::move(thread)),
-          m_Function(std::forward<F>(func)) {}
+          m_Function(std::make_shared<Function>(std::forward<F>(func))) {}
 
     utils::ExResult<TResult> Call() {
         if (m_Thread->ValidateThread()) {
-            return m_Function();
+            return (*m_Function)();
         } else {
             return utils::ExError("Invalid caller thread. Call() executes only on the owner thread.");
         }
@@ -120,7 +200,7 @@ public:
 
     TResult Immediate() {
         if (m_Thread->ValidateThread()) {
-            return m_Function();
+            return (*m_Function)();
         } else {
             throw std::runtime_error("Invalid caller thread. Immediate() executes only on the owner thread.");
         }
@@ -128,21 +208,32 @@ public:
 
     TResult SyncCall() {
         if (m_Thread->ValidateThread()) {
-            return m_Function();
+            return (*m_Function)();
         } else {
-            return thr->EnqueueFuture(m_Function).get();
+            // Blocking, the cycler can run our function in place
+            return m_Thread->EnqueueFuture([this]() -> TResult { return (*m_Function)(); }).get();
         }
     }
 
+    // Hops onto the owner thread, the awaiting coroutine continues there
+    Task<TResult> Async() {
+        return AsyncImpl(m_Thread, m_Function);
+    }
+
     Future<TResult> PostCall() {
         if (m_Thread->ValidateThread()) {
-            auto task = std::packaged_task<TResult()>(std::forward<Function>(func));
+            auto task = std::packaged_task<TResult()>([func = m_Function]() -> TResult { return (*func)(); });
             task();
-            return task->get_future();
+            return task.get_future();
         } else {
-            return m_Thread->EnqueueFuture(m_Function);
+            return m_Thread->EnqueueFuture([func = m_Function]() -> TResult { return (*func)(); });
         }
     }
+private:
+    static Task<TResult> AsyncImpl(SharedPtr<ThreadCycler> thread, SharedPtr<Function> func) {
+        co_await thread->Schedule();
+        co_return (*func)();
+    }
 };
 
 template<typename F>
@@ -181,9 +272,10 @@ public:
 
     utils::ExError StartSyncd(
         CtxCreatorFunc creator,
-        std::function<void()> constWork = [](){}
+        std::function<void()> constWork = [](){},
+        ThreadSpec spec = {}
     ) {
-        ThreadCycler::Start();
+        ThreadCycler::Start(std::move(spec));
         ThreadCycler::AwaitStart();
 
         CtxCreatorFunc wrapped = [this, &creator]() {
@@ -245,14 +337,15 @@ protected:
 public:
     utils::ExError StartCycle(
         std::function<SharedPtr<EmptyStruct>()> initFunc,
-        std::function<void(EmptyStruct& gctx)> subCycle
+        std::function<void(EmptyStruct& gctx)> subCycle,
+        ThreadSpec spec = {}
     );
 };
 // TODO: Create an "ALAudioContext" Class which holds streams, music, sources by respect to audio thread ownership
 
 class ThreadContextWnd : public ThreadContext<core::IWindow> {
 public:
-    utils::ExError StartApp(CtxCreatorFunc initFunc);
+    utils::ExError StartApp(CtxCreatorFunc initFunc, ThreadSpec spec = {});
     void SignalWindow();
 };
 
@@ -264,7 +357,7 @@ private:
     std::atomic<float> m_FrameTime{0.0f};
     std::atomic<float> m_FrameCap{0.0f};
 public:
-    utils::ExError StartGfx(CtxCreatorFunc initFunc, float frameCap = 0.0f, bool autoPresent = false);
+    utils::ExError StartGfx(CtxCreatorFunc initFunc, float frameCap = 0.0f, bool autoPresent = false, ThreadSpec spec = {});
 
     bool IsAutoPresent() const { return m_IsAutoPresent.load(); };
     float GetFrameTime() const { return m_FrameTime.load(std::memory_order_relaxed); }
@@ -0,0 +1,45 @@
+#pragma once
+
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/utils/AX_Expected.hpp"
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+namespace axle::core
+{
+
+enum class ThreadSchedPolicy {
+    Normal, // priority => nice value (-20..19), negative values usually need CAP_SYS_NICE
+    Fifo    // priority => SCHED_FIFO priority (1..99), needs CAP_SYS_NICE / rtprio limits
+};
+
+// Placement for an engine thread, default-constructed spec leaves the thread untouched
+struct ThreadSpec {
+    std::string name{};           // Truncated to 15 chars on Linux
+    std::vector<uint32_t> cpus{}; // Empty => inherit, with numaNode => all CPUs of the node
+    int32_t numaNode{-1};         // -1 => none, otherwise restricts cpus and prefers node-local memory
+    ThreadSchedPolicy policy{ThreadSchedPolicy::Normal};
+    int32_t priority{0};
+    AllocTag allocTag{AllocTag::General}; // Heap allocations of the thread are charged to it
+
+    bool IsDefault() const {
+        return name.empty() && cpus.empty() && numaNode < 0 &&
+            policy == ThreadSchedPolicy::Normal && priority == 0 && allocTag == AllocTag::General;
+    }
+};
+
+// Applies `spec` to the calling thread, best-effort: every setting is attempted, the first failure is returned
+utils::ExError ApplyThreadSpec(const ThreadSpec& spec);
+
+// Linux cpulist format ("0-15,32-47"), an error on malformed input
+utils::ExResult<std::vector<uint32_t>> ParseCpuList(std::string_view list);
+
+// Empty when the node does not exist or NUMA info is unavailable, an error when its cpulist is malformed
+utils::ExResult<std::vector<uint32_t>> GetNumaNodeCpus(int32_t node);
+
+}
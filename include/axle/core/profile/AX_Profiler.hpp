@@ -0,0 +1,131 @@
+#pragma once
+
+#include "axle/utils/AX_Expected.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+namespace axle::core
+{
+
+// `name` must outlive the profiler (string literals, __func__)
+struct ProfileZone {
+    const char* name{nullptr};
+    uint64_t begin{0};
+    uint64_t end{0};
+};
+
+// Single-writer ring owned by one thread, overwrites the oldest zones once full
+class ProfileRing {
+private:
+    std::unique_ptr<ProfileZone[]> m_Zones;
+    uint64_t m_Mask;
+
+    alignas(64) std::atomic<uint64_t> m_Head{0};
+
+    uint32_t m_ThreadIdx;
+    std::string m_ThreadName;
+
+    friend class Profiler;
+public:
+    ProfileRing(uint32_t threadIdx, uint32_t capacity);
+
+    AX_NON_COPYABLE_NON_MOVABLE(ProfileRing)
+
+    void Push(const char* name, uint64_t begin, uint64_t end) {
+        auto head = m_Head.load(std::memory_order_relaxed);
+        m_Zones[head & m_Mask] = {name, begin, end};
+        m_Head.store(head + 1, std::memory_order_release);
+    }
+
+    // Any thread, zones overwritten while copying are discarded
+    void Snapshot(std::vector<ProfileZone>& out) const;
+
+    uint32_t GetThreadIdx() const { return m_ThreadIdx; }
+};
+
+class Profiler {
+private:
+    std::atomic_bool m_Enabled{true};
+    std::mutex m_RingsMutex{};
+    uint32_t m_RingCapacity{1 << 16}; // Guarded by m_RingsMutex
+    std::vector<UniquePtr<ProfileRing>> m_Rings{}; // Never freed, zones survive their thread
+
+    uint64_t m_EpochTicks{0};
+    ChSteadyTimepoint m_EpochTime{};
+
+    Profiler();
+
+    ProfileRing* RegisterThread();
+    double TicksPerNano() const;
+public:
+    AX_NON_COPYABLE_NON_MOVABLE(Profiler)
+
+    static Profiler& Get();
+
+    // Raw timestamp, TSC on x86 (converted at export), steady clock ns elsewhere
+    static uint64_t Now() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(ChSteadyClock::now().time_since_epoch().count());
+#endif
+    }
+
+    bool IsEnabled() const { return m_Enabled.load(std::memory_order_relaxed); }
+    void SetEnabled(bool enabled) { m_Enabled.store(enabled, std::memory_order_relaxed); }
+
+    // Applies to threads registering afterwards, rings already handed out keep their size
+    void SetRingCapacity(uint32_t zones);
+
+    ProfileRing& GetThreadRing();
+    void SetThreadName(std::string_view name);
+
+    // Writes every ring as Chrome trace_event JSON (chrome://tracing, Perfetto, Tracy import)
+    utils::ExError WriteChromeTrace(const std::filesystem::path& path);
+    void Clear();
+};
+
+class ProfileScope {
+private:
+    const char* m_Name;
+    uint64_t m_Begin;
+public:
+    explicit ProfileScope(const char* name)
+        : m_Name(Profiler::Get().IsEnabled() ? name : nullptr),
+          m_Begin(m_Name ? Profiler::Now() : 0) {}
+
+    ~ProfileScope() {
+        if (m_Name) Profiler::Get().GetThreadRing().Push(m_Name, m_Begin, Profiler::Now());
+    }
+
+    AX_NON_COPYABLE_NON_MOVABLE(ProfileScope)
+};
+
+}
+
+#define AX_PROFILE_CONCAT_IMPL(a, b) a##b
+#define AX_PROFILE_CONCAT(a, b) AX_PROFILE_CONCAT_IMPL(a, b)
+
+#ifdef __AX_PROFILER__
+#define AX_PROFILE_SCOPE(name) ::axle::core::ProfileScope AX_PROFILE_CONCAT(_axProfileScope, __LINE__){name}
+#define AX_PROFILE_FUNCTION() AX_PROFILE_SCOPE(__func__)
+#define AX_PROFILE_THREAD(name) ::axle::core::Profiler::Get().SetThreadName(name)
+#else
+#define AX_PROFILE_SCOPE(name) ((void)0)
+#define AX_PROFILE_FUNCTION() ((void)0)
+#define AX_PROFILE_THREAD(name) ((void)0)
+#endif
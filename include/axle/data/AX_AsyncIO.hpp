@@ -0,0 +1,211 @@
+#pragma once
+
+#include "axle/utils/AX_Expected.hpp"
+#include "axle/utils/AX_Span.hpp"
+#include "axle/utils/AX_Types.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+namespace axle::data
+{
+
+enum class AsyncIOBackend {
+    Auto,      // io_uring when the kernel allows it, else ThreadPool
+    IOUring,   // Linux only, batches every submission into one io_uring_enter
+    ThreadPool // pread (ReadFile on Windows) on worker threads
+};
+
+struct AsyncIODesc {
+    AsyncIOBackend backend{AsyncIOBackend::Auto};
+    uint32_t queueDepth{256};              // io_uring entries, requests beyond it wait for completions
+    uint32_t workerCount{4};               // ThreadPool workers
+    uint64_t directThreshold{4ull << 20};  // ReadFile() bypasses the page cache (O_DIRECT) from this size, 0 => never
+};
+
+// Open file shared by the requests reading it, closed with the last reference
+class AsyncFile {
+private:
+#if defined(_WIN32)
+    void* m_Handle{nullptr};
+#else
+    int m_Fd{-1};
+#endif
+    uint64_t m_Size{0};
+    bool m_Direct{false};
+
+    AsyncFile() = default;
+public:
+    // O_DIRECT reads need offsets, sizes and buffers aligned to DIRECT_ALIGNMENT. Falls back to buffered
+    // I/O when the filesystem refuses direct access.
+    static utils::ExResult<SharedPtr<AsyncFile>> Open(const std::filesystem::path& path, bool direct = false);
+    ~AsyncFile();
+
+    AX_NON_COPYABLE_NON_MOVABLE(AsyncFile)
+
+    static constexpr uint64_t DIRECT_ALIGNMENT = 4096;
+
+    uint64_t GetSize() const { return m_Size; }
+    bool IsDirect() const { return m_Direct; }
+
+#if defined(_WIN32)
+    void* GetHandle() const { return m_Handle; }
+#else
+    int GetHandle() const { return m_Fd; }
+#endif
+};
+
+// One destination range of a scatter read
+struct IOSlice {
+    uint64_t offset{0};
+    utils::URawView dst{};
+};
+
+namespace detail
+{
+
+// Completion state of one submission (which may span several reads)
+struct IOState {
+    std::atomic<uint32_t> pending{0};
+    std::atomic<uint64_t> bytes{0};
+
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    bool done{false};
+    utils::ExError error{utils::ExError::NoError()}; // First failure
+    std::vector<std::coroutine_handle<>> waiters{};
+
+    utils::URaw data{}; // ReadFile() result
+
+    void Fail(const utils::ExError& err);
+    // One read done, completes the state with the last one. Waiters resume inline, or on core::JobSystem::Global()
+    // with `deferResume` for completion threads that must not run (and possibly block in) caller code.
+    void Finish(uint64_t read, bool deferResume = false);
+};
+
+struct IOBackend; // io_uring or thread pool, see AX_AsyncIO.cpp
+
+}
+
+// Result of an async read: Get() blocks, co_await resumes the coroutine on the ThreadPool worker that completed it
+// (hop with co_await jobs.Schedule() before heavy work), or on a JobSystem worker with io_uring. Any number of
+// coroutines may await the same future. T is uint64_t (bytes read) or utils::URaw (file contents).
+template <typename T>
+class IOFuture {
+    static_assert(std::is_same_v<T, uint64_t> || std::is_same_v<T, utils::URaw>);
+private:
+    SharedPtr<detail::IOState> m_State{};
+public:
+    IOFuture() = default;
+    explicit IOFuture(SharedPtr<detail::IOState> state) : m_State(std::move(state)) {}
+
+    bool IsValid() const { return static_cast<bool>(m_State); }
+
+    bool IsDone() const {
+        std::lock_guard<std::mutex> lock(m_State->mutex);
+        return m_State->done;
+    }
+
+    utils::ExResult<T> Get() const {
+        {
+            std::unique_lock<std::mutex> lock(m_State->mutex);
+            m_State->cv.wait(lock, [this]() { return m_State->done; });
+            if (m_State->error.IsValid()) return m_State->error;
+        }
+        if constexpr (std::is_same_v<T, uint64_t>) {
+            return m_State->bytes.load(std::memory_order_relaxed);
+        } else {
+            return m_State->data;
+        }
+    }
+
+    bool await_ready() const { return IsDone(); }
+
+    bool await_suspend(std::coroutine_handle<> handle) const {
+        std::lock_guard<std::mutex> lock(m_State->mutex);
+        if (m_State->done) return false;
+        m_State->waiters.push_back(handle);
+        return true;
+    }
+
+    utils::ExResult<T> await_resume() const { return Get(); }
+};
+
+class AsyncIO {
+private:
+    AsyncIODesc m_Desc;
+    UniquePtr<detail::IOBackend> m_Backend;
+public:
+    explicit AsyncIO(const AsyncIODesc& desc = {});
+    ~AsyncIO(); // Waits for in-flight reads
+
+    AX_NON_COPYABLE_NON_MOVABLE(AsyncIO)
+
+    static AsyncIO& Global();
+
+    // The backend actually in use, never Auto
+    AsyncIOBackend GetBackend() const;
+
+    // `dst` must stay alive until the future completes; short reads only happen at end of file
+    IOFuture<uint64_t> Read(const SharedPtr<AsyncFile>& file, uint64_t offset, utils::URawView dst);
+
+    // All slices are submitted together and complete as one future
+    IOFuture<uint64_t> ReadScatter(const SharedPtr<AsyncFile>& file, utils::Span<const IOSlice> slices);
+
+    // Whole file into a new buffer (external to SharedBuffer: MakeMutable() copies it)
+    IOFuture<utils::URaw> ReadFile(const std::filesystem::path& path);
+
+    // One batch for every file; opens happen on the workers with ThreadPool, on the caller with io_uring
+    std::vector<IOFuture<utils::URaw>> ReadFiles(utils::Span<const std::filesystem::path> paths);
+};
+
+// Sequential read-ahead over AsyncIO: keeps `depth` chunks in flight past the read position
+struct FilePrefetchDesc {
+    AsyncIO* io{nullptr}; // nullptr => AsyncIO::Global()
+    uint32_t chunkSize{256 * 1024};
+    uint32_t depth{4};
+};
+
+class FilePrefetcher {
+private:
+    struct Chunk {
+        uint64_t offset{0};
+        std::vector<uint8_t> bytes{};
+        IOFuture<uint64_t> future{};
+        uint64_t size{UINT64_MAX}; // Valid bytes, UINT64_MAX until waited on
+    };
+
+    FilePrefetchDesc m_Desc;
+    SharedPtr<AsyncFile> m_File{};
+    std::deque<Chunk> m_Chunks{};
+    std::vector<std::vector<uint8_t>> m_FreeBuffers{};
+    uint64_t m_Pos{0};
+    uint64_t m_NextOffset{0};
+
+    void Drop(Chunk& chunk);
+    void Restart(uint64_t pos);
+    void TopUp();
+public:
+    explicit FilePrefetcher(const FilePrefetchDesc& desc);
+    ~FilePrefetcher();
+
+    AX_NON_COPYABLE_NON_MOVABLE(FilePrefetcher)
+
+    utils::ExError Open(const std::filesystem::path& path);
+
+    utils::ExResult<std::size_t> Read(void* out, std::size_t size);
+    utils::ExError Seek(uint64_t pos);
+
+    uint64_t GetPosition() const { return m_Pos; }
+    uint64_t GetLength() const { return m_File ? m_File->GetSize() : 0; }
+    bool EndOfStream() const { return !m_File || m_Pos >= m_File->GetSize(); }
+};
+
+}
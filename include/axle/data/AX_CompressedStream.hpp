@@ -0,0 +1,160 @@
+#pragma once
+
+#include "axle/data/AX_Compression.hpp"
+#include "axle/data/AX_IDataStream.hpp"
+
+#include "axle/utils/AX_Expected.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace axle::core { class JobSystem; }
+
+namespace axle::data
+{
+
+// Block-compressed stream layout, all fields little-endian:
+//   blocks, each compressed on its own (or stored raw when that is not smaller)
+//   index: blockCount x CompressedBlockInfo
+//   footer: CompressedStreamFooter
+// Every block but the last holds blockSize raw bytes, so the block of any raw position is pos / blockSize.
+
+static constexpr uint32_t COMPRESSED_STREAM_MAGIC = 0x5A435841; // "AXCZ"
+static constexpr uint16_t COMPRESSED_STREAM_VERSION = 1;
+static constexpr uint32_t COMPRESSED_STREAM_MAX_BLOCK_SIZE = 64 * 1024 * 1024; // Readers size buffers off the footer
+
+struct CompressedBlockInfo {
+    uint64_t offset;   // From the start of the compressed stream
+    uint32_t size;     // Stored bytes
+    uint32_t flags;    // BLOCK_FLAG_*
+};
+
+static constexpr uint32_t BLOCK_FLAG_STORED = 1 << 0; // Raw bytes, the codec did not help
+
+struct CompressedStreamFooter {
+    uint64_t indexOffset;
+    uint64_t rawSize;
+    uint32_t blockSize;
+    uint16_t codec;     // CompressionCodec
+    uint16_t version;
+    uint32_t blockCount;
+    uint32_t magic;
+};
+
+static_assert(sizeof(CompressedBlockInfo) == 16);
+static_assert(sizeof(CompressedStreamFooter) == 32);
+
+struct CompressedWriteDesc {
+    CompressionCodec codec{CompressionCodec::LZ4};
+    uint32_t blockSize{128 * 1024}; // 1..COMPRESSED_STREAM_MAX_BLOCK_SIZE
+    int level{0}; // Zstd only, 0 => library default
+};
+
+// Compresses everything written into `inner` block by block. Writes are sequential only; Finish() (also
+// run on destruction) compresses the last partial block and appends the index and footer.
+class CompressedWriteStream : public IDataStream {
+private:
+    IDataStream* m_Inner;
+    CompressedWriteDesc m_Desc;
+
+    std::vector<uint8_t> m_Block{};      // Raw bytes of the block being filled
+    std::vector<uint8_t> m_Compressed{}; // Scratch for one compressed block
+    std::vector<CompressedBlockInfo> m_Index{};
+    uint64_t m_RawSize{0};
+    uint64_t m_StoredSize{0};
+
+    bool m_Opened{false};
+    bool m_Finished{false};
+
+    utils::ExError FlushBlock();
+public:
+    // `inner` must be open for writing and outlive this stream
+    CompressedWriteStream(IDataStream& inner, const CompressedWriteDesc& desc = {});
+    ~CompressedWriteStream() override;
+
+    CompressedWriteStream(const CompressedWriteStream&) = delete;
+    CompressedWriteStream& operator=(const CompressedWriteStream&) = delete;
+
+    utils::ExError Open() override;
+    utils::ExError Finish();
+
+    bool EndOfStream() const override;
+
+    uint64_t GetReadIndex() override;
+    uint64_t GetWriteIndex() override;
+
+    utils::ExError SeekRead(uint64_t pos) override;
+    utils::ExError SkipRead(int64_t offset) override;
+    utils::ExError SeekWrite(uint64_t pos) override;
+    utils::ExError SkipWrite(int64_t offset) override;
+
+    utils::ExResult<std::size_t> Read(void* out, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(const void* in, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(uint8_t byte, std::size_t repeat) override;
+
+    uint64_t GetLength() override { return m_RawSize; }
+
+    // Bytes handed to `inner` so far (blocks only until Finish())
+    uint64_t GetStoredSize() const { return m_StoredSize; }
+};
+
+struct CompressedReadDesc {
+    core::JobSystem* jobs{nullptr}; // Parallel block decode, nullptr => core::JobSystem::Global()
+    uint32_t parallelBlocks{4};     // Reads spanning at least this many whole blocks decode in parallel, 0 => never
+};
+
+// Random-access reads over a stream written by CompressedWriteStream. Seeking only moves the position; the block
+// holding it is decoded on the next read and cached. Large reads decode straight into the caller's buffer, in
+// parallel across blocks. Memory-backed inner streams (PeekContiguous()) are decoded in place without staging.
+class CompressedReadStream : public IDataStream {
+private:
+    IDataStream* m_Inner;
+    CompressedReadDesc m_Desc;
+
+    CompressionCodec m_Codec{CompressionCodec::None};
+    uint32_t m_BlockSize{0};
+    uint64_t m_RawSize{0};
+    uint64_t m_Base{0}; // Inner position of the first block
+    std::vector<CompressedBlockInfo> m_Index{};
+    const uint8_t* m_Contiguous{nullptr}; // Whole compressed stream when the inner stream is memory-backed
+
+    std::vector<uint8_t> m_Cache{};
+    uint64_t m_CachedBlock{UINT64_MAX};
+    std::vector<uint8_t> m_Staging{};
+
+    uint64_t m_Pos{0};
+    bool m_Opened{false};
+
+    uint64_t RawBlockSize(uint64_t block) const;
+    utils::ExError LoadBlocks(uint64_t first, uint64_t count, uint8_t* out);
+public:
+    // `inner` must be open for reading, end where the compressed stream ends, and outlive this stream
+    CompressedReadStream(IDataStream& inner, const CompressedReadDesc& desc = {});
+    ~CompressedReadStream() override = default;
+
+    CompressedReadStream(const CompressedReadStream&) = delete;
+    CompressedReadStream& operator=(const CompressedReadStream&) = delete;
+
+    utils::ExError Open() override;
+    bool EndOfStream() const override;
+
+    uint64_t GetReadIndex() override;
+    uint64_t GetWriteIndex() override;
+
+    utils::ExError SeekRead(uint64_t pos) override;
+    utils::ExError SkipRead(int64_t offset) override;
+    utils::ExError SeekWrite(uint64_t pos) override;
+    utils::ExError SkipWrite(int64_t offset) override;
+
+    utils::ExResult<std::size_t> Read(void* out, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(const void* in, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(uint8_t byte, std::size_t repeat) override;
+
+    uint64_t GetLength() override { return m_RawSize; }
+
+    CompressionCodec GetCodec() const { return m_Codec; }
+    uint32_t GetBlockSize() const { return m_BlockSize; }
+    uint64_t GetBlockCount() const { return m_Index.size(); }
+};
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "axle/utils/AX_Expected.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace axle::data
+{
+
+enum class CompressionCodec : uint16_t {
+    None = 0,
+    LZ4 = 1,  // LZ4 block format, built in; fast to decode
+    Zstd = 2  // Needs AX_IMPL_ZSTD; smaller output
+};
+
+// False for Zstd when the library is not compiled in
+bool IsCodecAvailable(CompressionCodec codec);
+
+// Largest output Compress() can produce for `size` input bytes
+std::size_t CompressBound(CompressionCodec codec, std::size_t size);
+
+// One independent block. `level` only matters for Zstd (1..22, 0 => library default).
+utils::ExResult<std::size_t> Compress(CompressionCodec codec, const void* src, std::size_t srcSize,
+                                      void* dst, std::size_t dstCapacity, int level = 0);
+
+// Fails unless exactly `rawSize` bytes come out
+utils::ExError Decompress(CompressionCodec codec, const void* src, std::size_t srcSize, void* dst, std::size_t rawSize);
+
+}
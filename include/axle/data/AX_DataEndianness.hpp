@@ -14,6 +14,32 @@
 
 namespace axle::data {
 
+// Reverses the bytes of an integer or float; the shift loop compiles down to a single bswap
+template<typename T>
+constexpr T ByteSwap(T value) {
+    static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>);
+    if constexpr (sizeof(T) == 1) {
+        return value;
+    } else {
+        using U = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+        U bits = std::bit_cast<U>(value);
+        U swapped = 0;
+        for (std::size_t i{0}; i < sizeof(U); i++) {
+            swapped = U(swapped << 8) | U(bits & 0xFF);
+            bits = U(bits >> 8);
+        }
+        return std::bit_cast<T>(swapped);
+    }
+}
+
+// Converts little-endian values in place; a no-op on little-endian hosts, an auto-vectorized swap on big-endian ones
+template<typename T>
+inline void LE_SwapInPlace(T* values, std::size_t count) {
+    if constexpr (std::endian::native == std::endian::big && sizeof(T) > 1) {
+        for (std::size_t i{0}; i < count; i++) values[i] = ByteSwap(values[i]);
+    }
+}
+
 template<typename T>
 inline utils::ExResult<std::size_t> LE_Write(IDataStream& buff, T* valueAddr) {
     static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>);
@@ -49,6 +49,8 @@ public:
 
     uint64_t GetLength() override;
 
+    utils::URawView PeekContiguous() override;
+
     utils::ExError WriteToFile(uint64_t pos, uint64_t size, const std::filesystem::path& path, uint64_t chunkSize = 4096);
     utils::ExError WriteToFile(uint64_t size, const std::filesystem::path& path, uint64_t chunkSize = 4096);
     utils::ExError WriteToFile(const std::filesystem::path& path, uint64_t chunkSize = 4096);
@@ -1,9 +1,11 @@
 #pragma once
 
 #include "AX_IDataStream.hpp"
+#include "AX_AsyncIO.hpp"
 
 #include <filesystem>
 #include <fstream>
+#include <optional>
 
 namespace axle::data {
 
@@ -16,8 +18,13 @@ private:
     bool m_Writable{false};
 
     bool m_Opened{false};
+
+    std::optional<FilePrefetchDesc> m_PrefetchDesc{};
+    UniquePtr<FilePrefetcher> m_Prefetch{}; // Serves all reads when prefetching
 public:
     FileDataStream(const std::filesystem::path& path, bool read, bool write);
+    // Read-only, reads come from chunks fetched ahead through AsyncIO instead of the fstream
+    FileDataStream(const std::filesystem::path& path, const FilePrefetchDesc& prefetch);
     ~FileDataStream() override;
 
     FileDataStream(const FileDataStream&) = delete;
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "AX_IDataStream.hpp"
+
+#include "axle/utils/AX_Span.hpp"
+#include "axle/utils/AX_Expected.hpp"
+
+#include <filesystem>
+#include <memory>
+
+namespace axle::data {
+
+// Access pattern hint passed to the kernel (madvise / PrefetchVirtualMemory)
+enum class MMapAdvice {
+    Normal,
+    Sequential, // Aggressive read-ahead, pages behind the cursor can be dropped early
+    Random,     // No read-ahead
+    WillNeed    // Start paging the range in now
+};
+
+// Read-only stream over a memory-mapped file. Reads are plain memcpys out of the page cache, and
+// Borrow()/Share()/ReadShared() hand out the mapped bytes themselves so parsers can decode in place.
+// Buffers from Share() keep the mapping alive after the stream is gone.
+class MMapDataStream : public IDataStream {
+private:
+    struct Mapping;
+
+    std::filesystem::path m_Path;
+    MMapAdvice m_Advice;
+
+    std::shared_ptr<const Mapping> m_Mapping;
+    utils::URawView m_View{};
+
+    uint64_t m_ReadIndex{0};
+
+    bool m_Opened{false};
+public:
+    MMapDataStream(const std::filesystem::path& path, MMapAdvice advice = MMapAdvice::Sequential);
+    ~MMapDataStream() override = default;
+
+    MMapDataStream(const MMapDataStream&) = delete;
+    MMapDataStream& operator=(const MMapDataStream&) = delete;
+
+    MMapDataStream(MMapDataStream&&) = default;
+    MMapDataStream& operator=(MMapDataStream&&) = default;
+
+    utils::ExError Open() override;
+    bool EndOfStream() const override;
+
+    uint64_t GetReadIndex() override;
+    uint64_t GetWriteIndex() override;
+
+    utils::ExError SeekRead(uint64_t pos) override;
+    utils::ExError SkipRead(int64_t offset) override;
+    utils::ExError SeekWrite(uint64_t pos) override;
+    utils::ExError SkipWrite(int64_t offset) override;
+
+    utils::ExResult<std::size_t> Read(void* out, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(const void* in, std::size_t size) override;
+    utils::ExResult<std::size_t> Write(uint8_t byte, std::size_t repeat) override;
+
+    uint64_t GetLength() override;
+
+    utils::URawView PeekContiguous() override;
+    utils::ExResult<utils::URaw> ReadShared(std::size_t size) override;
+
+    // Whole file, valid while the stream (or any buffer from Share()) lives. Never write through it.
+    utils::URawView View() const { return m_View; }
+
+    // Next `size` bytes in place, advancing the read index; fails instead of returning a short view
+    utils::ExResult<utils::URawView> Borrow(std::size_t size);
+
+    // Bytes [offset, offset + size) as a buffer sharing the mapping, size is clamped to the file
+    utils::URaw Share(uint64_t offset, std::size_t size) const;
+
+    utils::ExError Advise(MMapAdvice advice, uint64_t offset = 0, uint64_t size = UINT64_MAX);
+};
+
+}
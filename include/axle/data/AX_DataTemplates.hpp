@@ -1,6 +1,8 @@
 #pragma once
 
 #include "axle/data/AX_IDataStream.hpp"
+#include "axle/data/AX_StreamReader.hpp"
+#include "axle/data/AX_StreamWriter.hpp"
 
 #include "axle/utils/AX_Expected.hpp"
 
@@ -46,4 +48,19 @@ utils::ExError WriteVarInt(IDataStream& buffer, int64_t value);
 utils::ExError WriteVarUInt(IDataStream& buffer, uint64_t value);
 utils::ExError WriteString(IDataStream& buffer, const std::string& value, uint32_t maxLength = 1024);
 
+// Buffered variants, components are read/written as one span
+utils::ExResult<glm::mat4> LE_ReadMat4(StreamReader& reader);
+utils::ExResult<glm::mat3> LE_ReadMat3(StreamReader& reader);
+
+utils::ExResult<glm::vec4> LE_ReadVec4(StreamReader& reader);
+utils::ExResult<glm::vec3> LE_ReadVec3(StreamReader& reader);
+utils::ExResult<glm::vec2> LE_ReadVec2(StreamReader& reader);
+
+utils::ExError LE_WriteMat4(StreamWriter& writer, const glm::mat4& value);
+utils::ExError LE_WriteMat3(StreamWriter& writer, const glm::mat3& value);
+
+utils::ExError LE_WriteVec4(StreamWriter& writer, const glm::vec4& value);
+utils::ExError LE_WriteVec3(StreamWriter& writer, const glm::vec3& value);
+utils::ExError LE_WriteVec2(StreamWriter& writer, const glm::vec2& value);
+
 }
\ No newline at end of file
@@ -2,8 +2,10 @@
 
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 #include "axle/utils/AX_Expected.hpp"
+#include "axle/utils/AX_Span.hpp"
 
 namespace axle::data {
 
@@ -27,6 +29,17 @@ public:
     virtual utils::ExResult<std::size_t> Write(uint8_t byte, std::size_t repeat) = 0;
 
     virtual uint64_t GetLength() { return 0; }
+
+    // Unread bytes of a memory-backed stream, valid while the stream lives; empty for other streams
+    virtual utils::URawView PeekContiguous() { return {}; }
+
+    // Reads up to `size` bytes into a buffer; copies by default, memory-backed streams may share their storage
+    virtual utils::ExResult<utils::URaw> ReadShared(std::size_t size) {
+        std::vector<uint8_t> bytes(size);
+        AX_DECL_OR_PROPAGATE(read, Read(bytes.data(), size));
+        bytes.resize(read);
+        return utils::URaw(std::move(bytes));
+    }
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,117 @@
+#pragma once
+
+#include "axle/data/AX_IDataStream.hpp"
+#include "axle/data/AX_DataEndianness.hpp"
+
+#include "axle/utils/AX_Expected.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace axle::data
+{
+
+// Non-virtual reading front-end for an IDataStream. Fixed-size, varint and span reads are served from a
+// window: the stream's own memory when it is memory-backed (PeekContiguous), otherwise an internal buffer
+// refilled with large Read() calls. The stream's read index runs ahead of the reader while buffering;
+// Sync() (also called on destruction) moves it back to the reader's position.
+class StreamReader {
+private:
+    IDataStream* m_Stream;
+    std::vector<uint8_t> m_Buffer;
+
+    const uint8_t* m_Begin{nullptr}; // Window start, at stream position m_WindowPos
+    const uint8_t* m_Cur{nullptr};
+    const uint8_t* m_End{nullptr};
+    uint64_t m_WindowPos{0};
+
+    bool m_Borrowed{false}; // Window is the stream's memory, nothing to refill
+
+    // Makes at least `need` bytes available, fails on EOF
+    utils::ExError Fill(std::size_t need);
+    utils::ExResult<uint64_t> ReadVarUIntSlow();
+public:
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+    static constexpr std::size_t MAX_VARINT_BYTES = 10;
+
+    explicit StreamReader(IDataStream& stream, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    ~StreamReader();
+
+    StreamReader(const StreamReader&) = delete;
+    StreamReader& operator=(const StreamReader&) = delete;
+
+    uint64_t GetPosition() const { return m_WindowPos + uint64_t(m_Cur - m_Begin); }
+    std::size_t GetAvailable() const { return std::size_t(m_End - m_Cur); }
+
+    utils::ExError Seek(uint64_t pos);
+    utils::ExError Skip(uint64_t size);
+
+    // Seeks the stream to the reader's position, e.g. before handing the stream to other code
+    utils::ExError Sync();
+
+    // Exactly `size` bytes or an EOF error; large reads bypass the buffer
+    utils::ExError ReadBytes(void* out, std::size_t size);
+
+    template<typename T>
+    utils::ExResult<T> ReadLE() {
+        static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>);
+        if (GetAvailable() < sizeof(T)) [[unlikely]] {
+            AX_PROPAGATE_ERROR(Fill(sizeof(T)));
+        }
+        T value;
+        std::memcpy(&value, m_Cur, sizeof(T));
+        m_Cur += sizeof(T);
+        LE_SwapInPlace(&value, 1);
+        return value;
+    }
+
+    // LEB128, at most 10 bytes
+    utils::ExResult<uint64_t> ReadVarUInt() {
+        if (GetAvailable() < MAX_VARINT_BYTES) [[unlikely]] {
+            return ReadVarUIntSlow();
+        }
+        const uint8_t* p = m_Cur;
+        uint64_t result{0};
+        for (uint32_t shift{0}; shift < 70; shift += 7) {
+            uint8_t byte = *p++;
+            result |= uint64_t(byte & 0x7F) << shift;
+            if ((byte & 0x80) == 0) {
+                m_Cur = p;
+                return result;
+            }
+        }
+        return utils::ExError{"VarUInt overflow"};
+    }
+
+    // Zigzag-encoded
+    utils::ExResult<int64_t> ReadVarInt() {
+        AX_DECL_OR_PROPAGATE(ux, ReadVarUInt());
+        return int64_t(ux >> 1) ^ -int64_t(ux & 1);
+    }
+
+    // VarUInt length followed by the bytes
+    utils::ExResult<std::string> ReadString(uint32_t maxLength = 1024);
+
+    // `count` little-endian values in one copy, swapped only on big-endian hosts
+    template<typename T>
+    utils::ExError ReadSpan(T* out, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        AX_PROPAGATE_ERROR(ReadBytes(out, count * sizeof(T)));
+        if constexpr (std::is_integral_v<T> || std::is_floating_point_v<T>) {
+            LE_SwapInPlace(out, count);
+        }
+        return utils::ExError::NoError();
+    }
+
+    template<typename T>
+    utils::ExResult<std::vector<T>> ReadSpan(std::size_t count) {
+        std::vector<T> values(count);
+        AX_PROPAGATE_ERROR(ReadSpan(values.data(), count));
+        return values;
+    }
+};
+
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include "axle/data/AX_IDataStream.hpp"
+#include "axle/data/AX_DataEndianness.hpp"
+
+#include "axle/utils/AX_Expected.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace axle::data
+{
+
+// Non-virtual writing front-end for an IDataStream: small writes land in an internal buffer that reaches
+// the stream in large Write() calls. Flush() (also called on destruction) pushes out what is pending.
+class StreamWriter {
+private:
+    IDataStream* m_Stream;
+    std::vector<uint8_t> m_Buffer;
+    std::size_t m_Used{0};
+
+    utils::ExError WriteBytesSlow(const void* in, std::size_t size);
+public:
+    static constexpr std::size_t DEFAULT_BUFFER_SIZE = 64 * 1024;
+    static constexpr std::size_t MAX_VARINT_BYTES = 10;
+
+    explicit StreamWriter(IDataStream& stream, std::size_t bufferSize = DEFAULT_BUFFER_SIZE);
+    ~StreamWriter();
+
+    StreamWriter(const StreamWriter&) = delete;
+    StreamWriter& operator=(const StreamWriter&) = delete;
+
+    utils::ExError Flush();
+
+    utils::ExError WriteBytes(const void* in, std::size_t size) {
+        if (m_Buffer.size() - m_Used < size) [[unlikely]] {
+            return WriteBytesSlow(in, size);
+        }
+        std::memcpy(m_Buffer.data() + m_Used, in, size);
+        m_Used += size;
+        return utils::ExError::NoError();
+    }
+
+    template<typename T>
+    utils::ExError WriteLE(T value) {
+        static_assert(std::is_integral_v<T> || std::is_floating_point_v<T>);
+        LE_SwapInPlace(&value, 1);
+        return WriteBytes(&value, sizeof(T));
+    }
+
+    // LEB128, at most 10 bytes
+    utils::ExError WriteVarUInt(uint64_t value) {
+        uint8_t bytes[MAX_VARINT_BYTES];
+        std::size_t count{0};
+        while (value >= 0x80) {
+            bytes[count++] = uint8_t(value) | 0x80;
+            value >>= 7;
+        }
+        bytes[count++] = uint8_t(value);
+        return WriteBytes(bytes, count);
+    }
+
+    // Zigzag-encoded
+    utils::ExError WriteVarInt(int64_t value) {
+        return WriteVarUInt((uint64_t(value) << 1) ^ uint64_t(value >> 63));
+    }
+
+    // VarUInt length followed by the bytes
+    utils::ExError WriteString(std::string_view value, uint32_t maxLength = 1024) {
+        if (value.size() > maxLength) return {"String length exceeds maximum"};
+        AX_PROPAGATE_ERROR(WriteVarUInt(value.size()));
+        return WriteBytes(value.data(), value.size());
+    }
+
+    // `count` values as little-endian; on big-endian hosts they are swapped through the buffer in chunks
+    template<typename T>
+    utils::ExError WriteSpan(const T* values, std::size_t count) {
+        static_assert(std::is_trivially_copyable_v<T>);
+        if constexpr (std::endian::native == std::endian::big && (std::is_integral_v<T> || std::is_floating_point_v<T>) && sizeof(T) > 1) {
+            T chunk[256];
+            for (std::size_t done{0}; done < count; done += 256) {
+                std::size_t n = std::min<std::size_t>(256, count - done);
+                std::memcpy(chunk, values + done, n * sizeof(T));
+                LE_SwapInPlace(chunk, n);
+                AX_PROPAGATE_ERROR(WriteBytes(chunk, n * sizeof(T)));
+            }
+            return utils::ExError::NoError();
+        } else {
+            return WriteBytes(values, count * sizeof(T));
+        }
+    }
+};
+
+}
@@ -2,6 +2,7 @@
 
 #include "axle/utils/AX_Span.hpp"
 #include "axle/utils/AX_MagicPool.hpp"
+#include "axle/utils/AX_NameId.hpp"
 
 #include "slang.h"
 
@@ -244,6 +245,13 @@ enum class CompareOp {
     Always
 };
 
+struct TextureBorderColor {
+    float r{0.0f};
+    float g{0.0f};
+    float b{0.0f};
+    float a{0.0f};
+};
+
 struct SamplerDesc {
     float maxAnisotropy{0.0f}; // anisotropic filtering, 0.0 means disabled
 
@@ -265,13 +273,6 @@ struct SamplerTag {};
 
 using SamplerHandle = ExternalHandle<SamplerTag>;
 
-struct TextureBorderColor {
-    float r{0.0f};
-    float g{0.0f};
-    float b{0.0f};
-    float a{0.0f};
-};
-
 enum class TextureCubemapFace {
     NegativeX,
     NegativeY,
@@ -418,7 +419,7 @@ struct ShaderVertexInput {
 };
 
 struct ShaderResource {
-    std::string name;
+    utils::NameId name;
     ResourceType type;
     uint32_t bindingIndex{0};
     uint32_t bindingSpace{0};
@@ -429,7 +430,7 @@ struct ShaderResource {
 struct ShaderInputState {
     std::vector<ShaderVertexInput> inputs{};
     std::vector<ShaderResource> resources{};
-    std::unordered_map<std::string, uint32_t> resIdByName{};
+    std::unordered_map<utils::NameId, uint32_t> resIdByName{};
 };
 
 struct ShaderTag {};
@@ -728,7 +729,7 @@ using ComputePipelineHandle = ExternalHandle<ComputePipelineTag>;
 struct ResourceBinding {
     // Used only when the binding is created or updated.
     // Backend resolves this to a __shader_res_id.
-    std::string bindPoint;
+    utils::NameId bindPoint;
 
     ResourceHandle resourceHandle;
 
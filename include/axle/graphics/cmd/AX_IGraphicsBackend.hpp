@@ -34,11 +34,17 @@ public:
     virtual utils::ExResult<SwapchainDesc> DescribeSwapchain(const SwapchainHandle& handle) = 0;
 
     virtual utils::ExResult<BufferHandle> CreateBuffer(const BufferDesc& desc) = 0;
+    virtual BufferHandle ReserveBuffer() = 0; // Any thread; filled in later by CreateReservedBuffer, or released by DestroyBuffer
+    virtual utils::ExError CreateReservedBuffer(const BufferHandle& reserved, const BufferDesc& desc) = 0; // Releases the reservation on failure
+    virtual utils::ExError ReleaseReservedBuffer(const BufferHandle& reserved) = 0; // Any thread; fails once the handle went live
     virtual utils::ExError UpdateBuffer(const BufferHandle& handle, size_t offset, size_t size, const void* data) = 0;
     virtual utils::ExError DestroyBuffer(const BufferHandle& handle) = 0;
     virtual utils::ExResult<BufferDesc> DescribeBuffer(const BufferHandle& handle) = 0;
 
     virtual utils::ExResult<TextureHandle> CreateTexture(const TextureDesc& desc) = 0;
+    virtual TextureHandle ReserveTexture() = 0; // Any thread; filled in later by CreateReservedTexture, or released by DestroyTexture
+    virtual utils::ExError CreateReservedTexture(const TextureHandle& reserved, const TextureDesc& desc) = 0; // Releases the reservation on failure
+    virtual utils::ExError ReleaseReservedTexture(const TextureHandle& reserved) = 0; // Any thread; fails once the handle went live
     virtual utils::ExError GenerateMipMaps(const TextureHandle& handle) = 0;
     virtual utils::ExError UpdateTexture(const TextureHandle& handle, const void* data) = 0;
     virtual utils::ExError DestroyTexture(const TextureHandle& handle) = 0;
@@ -9,6 +9,7 @@
 
 #include "axle/data/AX_DataStreamImplBuffer.hpp"
 
+#include "axle/utils/AX_ConcurrentMagicPool.hpp"
 #include "axle/utils/AX_Expected.hpp"
 #include "axle/utils/AX_MagicPool.hpp"
 
@@ -247,11 +248,17 @@ public:
     utils::ExResult<SwapchainDesc> DescribeSwapchain(const SwapchainHandle& handle) override;
 
     utils::ExResult<BufferHandle> CreateBuffer(const BufferDesc& desc) override;
+    BufferHandle ReserveBuffer() override;
+    utils::ExError CreateReservedBuffer(const BufferHandle& reserved, const BufferDesc& desc) override;
+    utils::ExError ReleaseReservedBuffer(const BufferHandle& reserved) override;
     utils::ExError UpdateBuffer(const BufferHandle& handle, size_t offset, size_t size, const void* data) override;
     utils::ExError DestroyBuffer(const BufferHandle& handle) override;
     utils::ExResult<BufferDesc> DescribeBuffer(const BufferHandle& handle) override;
 
     utils::ExResult<TextureHandle> CreateTexture(const TextureDesc& desc) override;
+    TextureHandle ReserveTexture() override;
+    utils::ExError CreateReservedTexture(const TextureHandle& reserved, const TextureDesc& desc) override;
+    utils::ExError ReleaseReservedTexture(const TextureHandle& reserved) override;
     utils::ExError GenerateMipMaps(const TextureHandle& handle) override;
     utils::ExError UpdateTexture(const TextureHandle& handle, const void* data) override;
     utils::ExError DestroyTexture(const TextureHandle& handle) override;
@@ -296,8 +303,8 @@ public:
     utils::ExResult<FramebufferHandle> GetSwapchainFramebuffer(uint32_t imageIndex) override;
     utils::ExError Present(uint32_t imageIndex) override;
 private:
-    utils::MagicPool<GLBuffer>           m_Buffers{};
-    utils::MagicPool<GLTexture>          m_Textures{};
+    utils::ConcurrentMagicPool<GLBuffer>    m_Buffers{}; // Loader threads reserve handles ahead of upload
+    utils::ConcurrentMagicPool<GLTexture>   m_Textures{};
     utils::MagicPool<GLSampler>          m_Samplers{};
     utils::MagicPool<GLProgram>          m_Programs{};
     utils::MagicPool<GLRenderPipeline>   m_RenderPipelines{};
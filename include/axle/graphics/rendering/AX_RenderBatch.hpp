@@ -9,6 +9,7 @@
 
 #include <glm/glm.hpp>
 
+#include <memory_resource>
 #include <vector>
 #include <type_traits>
 #include <unordered_set>
@@ -44,7 +45,7 @@ struct DrawCallContext {
     uint32_t sortKey{0}; // User-defined sortKey (Optional)
 };
 
-const inline Predicate<DrawCallContext> RBATCH_SORT_BY_MINIMAL_STATE = [](const DrawCallContext& a, const DrawCallContext& b) {
+const inline auto RBATCH_SORT_BY_MINIMAL_STATE = [](const DrawCallContext& a, const DrawCallContext& b) {
     if (a.pipeline != b.pipeline) return a.pipeline < b.pipeline;
     if (a.resources != b.resources) return a.resources < b.resources;
     if (a.vertices != b.vertices) return a.vertices < b.vertices;
@@ -60,9 +61,9 @@ const inline Predicate<DrawCallContext> RBATCH_SORT_BY_MINIMAL_STATE = [](const
     return a.sortKey < b.sortKey;
 };
 
-using BatchErrorPredicate = std::function<bool(const utils::ExError&)>;
+using BatchErrorPredicate = InplaceFunction<bool(const utils::ExError&)>;
 
-const inline BatchErrorPredicate RBATCH_DEFAULT_ERROR_HANDLER = [](const utils::ExError& error) {
+const inline auto RBATCH_DEFAULT_ERROR_HANDLER = [](const utils::ExError& error) {
     if (error.IsValid()) {
         std::cerr << "Frame handler Error: " << error.GetMessage() << std::endl;
         return false;
@@ -88,9 +89,10 @@ struct UserSortKeyParams {
     uint32_t meshId;
 };
 
-using UserSortKeyAssigner = std::function<uint32_t(const UserSortKeyParams&)>;
+// Invoked from JobSystem workers during Record(), must be thread-safe
+using UserSortKeyAssigner = InplaceFunction<uint32_t(const UserSortKeyParams&)>;
 
-const inline UserSortKeyAssigner RBATCH_DEFAULT_USER_SORTKEY_ZERO = [](const UserSortKeyParams&) {
+const inline auto RBATCH_DEFAULT_USER_SORTKEY_ZERO = [](const UserSortKeyParams&) {
     return 0u;
 };
 
@@ -107,7 +109,7 @@ struct RenderBatchDesc {
 struct NodeTraversalParams {
     scene::ModelInstance& modelInstance;
     scene::NodeInstance& nodeInstance;
-    std::deque<DrawCallContext>& results;
+    std::pmr::vector<DrawCallContext>& results;
 };
 
 class RenderProcedure;
@@ -121,9 +123,9 @@ private:
     void AddInstance0(SharedPtr<scene::ModelInstance> modelInstance);
     void RemoveInstance0(SharedPtr<scene::ModelInstance> modelInstance);
 
-    void GenerateDrawCalls(SharedPtr<scene::ModelInstance> modelInstance, std::deque<DrawCallContext>& out);
+    void GenerateDrawCalls(scene::ModelInstance& modelInstance, scene::NodeInstance& rootNode, std::pmr::vector<DrawCallContext>& out);
 public:
-    RenderBatch(ThreadGfxScope gfxThread, const RenderBatchDesc& desc);
+    RenderBatch(ThreadGfxScope gfxThread, RenderBatchDesc desc);
 
     AX_NON_COPYABLE_NON_MOVABLE(RenderBatch);
 
@@ -135,8 +137,8 @@ public:
     ThreadInvocationVoid RemoveInstance(SharedPtr<scene::ModelInstance> modelInstance);
     ThreadInvocationVoid RemoveInstances(utils::Span<SharedPtr<scene::ModelInstance>> modelInstances);
 
-    ThreadInvocationVoid SetItemSort(const Predicate<DrawCallContext>& pred);
-    ThreadInvocationVoid SetUserSortKeyAssigner(const UserSortKeyAssigner& assigner);
+    ThreadInvocationVoid SetItemSort(Predicate<DrawCallContext> pred);
+    ThreadInvocationVoid SetUserSortKeyAssigner(UserSortKeyAssigner assigner);
 protected:
     friend class RenderProcedure;
 
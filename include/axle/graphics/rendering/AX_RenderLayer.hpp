@@ -19,7 +19,7 @@ enum class RLStage : uint8_t {
     Late,     // overlays, UI, debug
 };
 
-using RLFunc = std::function<void(SharedPtr<core::ThreadContextGfx> thrCtx, float dT, void* userPtr)>;
+using RLFunc = InplaceFunction<void(const SharedPtr<core::ThreadContextGfx>& thrCtx, float dT, void* userPtr)>;
 using RLOrderKey = utils::MagicId;
 
 struct RLHandle : public utils::MagicHandle {};
@@ -44,7 +44,7 @@ struct RLRegistry {
     bool active{false};
 };
 
-const inline Predicate<RLIntern> RL_SORT_BY_WEIGHT = [](const RLIntern& a, const RLIntern& b){
+const inline auto RL_SORT_BY_WEIGHT = [](const RLIntern& a, const RLIntern& b){
     return a.sortKey > b.sortKey;
 };
 
@@ -66,10 +66,10 @@ public:
 
     AX_NON_COPYABLE_NON_MOVABLE(RenderLayer);
 
-    ThreadInvocation<RLHandle> CreateLayer(const RLDesc& desc);
+    ThreadInvocation<RLHandle> CreateLayer(RLDesc desc);
     ThreadInvocation<utils::ExError> RemoveLayer(const RLHandle& handle);
 
-    ThreadInvocationVoid SortLayers(const Predicate<RLIntern>& pred = RL_SORT_BY_WEIGHT);
+    ThreadInvocationVoid SortLayers(Predicate<RLIntern> pred = RL_SORT_BY_WEIGHT);
 
     ThreadInvocation<utils::ExResult<RLRegistry>> GetCurrentRegistry();
 
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "axle/tick/AX_ITickAdapter.hpp"
+
+#include "axle/utils/AX_Types.hpp"
+#include "axle/utils/AX_Universal.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace axle::tick
+{
+
+// Fixed-step simulation clock: accumulates real time and runs whole steps of `step`,
+// at most `maxCatchUpSteps` per Advance(), the remainder becomes the interpolation alpha.
+// A step of 0 runs one variable step per Advance() with the measured delta.
+class FixedStepScheduler {
+private:
+    ChNanos m_Step{ChMillis(50)};
+    uint32_t m_MaxCatchUpSteps{5};
+    ChNanos m_SpinTail{utils::UNI_DEFAULT_SPIN_TAIL};
+
+    ChNanos m_Accumulator{0};
+    ChSteadyTimepoint m_LastTime{};
+
+    TickJob m_StepCallback{};
+
+    std::mutex m_SubscriberMutex{};
+    std::vector<ITickAdapter*> m_Subscribers{};
+    std::vector<ITickAdapter*> m_TickList{}; // Owner only, reused snapshot of m_Subscribers
+    bool m_SubscribersDirty{false};
+
+    std::atomic<float> m_Alpha{0.0f};
+    std::atomic<uint64_t> m_StepIndex{0};
+    std::atomic<uint64_t> m_DroppedSteps{0};
+
+    void RunStep(float dT);
+public:
+    FixedStepScheduler() = default;
+    FixedStepScheduler(ChNanos step, uint32_t maxCatchUpSteps = 5);
+
+    AX_NON_COPYABLE_NON_MOVABLE(FixedStepScheduler)
+
+    void Configure(ChNanos step, uint32_t maxCatchUpSteps = 5);
+    void SetStepCallback(TickJob callback) { m_StepCallback = std::move(callback); }
+
+    // Non-owning, subscribers must unsubscribe before they are destroyed
+    void Subscribe(ITickAdapter* adapter);
+    void Unsubscribe(ITickAdapter* adapter);
+
+    // Restarts the clock at `now`, drops any accumulated time
+    void Reset(ChSteadyTimepoint now = ChSteadyClock::now());
+
+    // Runs every step due by `now`, returns how many ran
+    uint32_t Advance(ChSteadyTimepoint now = ChSteadyClock::now());
+
+    ChSteadyTimepoint GetNextStepTime() const;
+    void SleepUntilNextStep() const;
+
+    ChNanos GetStep() const { return m_Step; }
+    float GetStepSeconds() const { return std::chrono::duration<float>(m_Step).count(); }
+    uint32_t GetMaxCatchUpSteps() const { return m_MaxCatchUpSteps; }
+
+    ChNanos GetSpinTail() const { return m_SpinTail; }
+    void SetSpinTail(ChNanos spinTail) { m_SpinTail = spinTail; }
+
+    // Safe from any thread (e.g. gfx), blend factor between the previous and current step state
+    float GetAlpha() const { return m_Alpha.load(std::memory_order_acquire); }
+    uint64_t GetStepIndex() const { return m_StepIndex.load(std::memory_order_acquire); }
+    uint64_t GetDroppedSteps() const { return m_DroppedSteps.load(std::memory_order_relaxed); }
+};
+
+}
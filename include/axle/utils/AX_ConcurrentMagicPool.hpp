@@ -0,0 +1,205 @@
+#pragma once
+
+#include "axle/utils/AX_MagicPool.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+
+namespace axle::utils
+{
+
+// MagicPool whose handles can be reserved from any thread: index/generation reservation is lock-free
+// (tagged free-list + bump cursor over fixed chunk table, so slots never move). A reserved handle is
+// not valid yet; the owner thread turns it live with Acquire() and fills the internal in. Get(), Delete() and
+// the internals themselves stay owner-thread only, ReleaseReservation() frees a still-reserved handle from anywhere.
+template <typename T_Intern, size_t T_ChunkSize = 256, size_t T_MaxChunks = 4096>
+requires (std::is_base_of_v<MagicInternal<typename T_Intern::handle_type>, T_Intern> && T_ChunkSize > 0)
+class ConcurrentMagicPool {
+public:
+    using T_Extern = typename T_Intern::handle_type;
+
+    static constexpr MagicId CAPACITY = static_cast<MagicId>(T_ChunkSize * T_MaxChunks);
+private:
+    static constexpr MagicId NIL = UINT32_MAX;
+    static_assert(T_ChunkSize * T_MaxChunks < NIL, "Pool capacity must fit in MagicId");
+
+    enum : uint32_t {
+        STATE_FREE = 0,
+        STATE_RESERVED = 1,
+        STATE_LIVE = 2
+    };
+
+    struct Slot {
+        std::atomic<uint64_t> state{0}; // generation << 32 | STATE_*
+        std::atomic<MagicId> nextFree{NIL};
+        T_Intern value{};
+    };
+
+    static constexpr uint64_t Pack(MagicId generation, uint32_t state) {
+        return (uint64_t(generation) << 32) | state;
+    }
+
+    std::unique_ptr<std::atomic<Slot*>[]> m_Chunks{new std::atomic<Slot*>[T_MaxChunks]{}};
+    std::atomic<MagicId> m_Next{0};
+    std::atomic<uint64_t> m_FreeHead{NIL}; // ABA tag << 32 | index
+
+    Slot* SlotAt(MagicId index) const {
+        if (index >= m_Next.load(std::memory_order_acquire)) return nullptr;
+        Slot* chunk = m_Chunks[index / T_ChunkSize].load(std::memory_order_acquire);
+        return chunk ? &chunk[index % T_ChunkSize] : nullptr;
+    }
+
+    Slot& EnsureSlot(MagicId index) {
+        auto& entry = m_Chunks[index / T_ChunkSize];
+        Slot* chunk = entry.load(std::memory_order_acquire);
+        if (!chunk) {
+            // Racing reservers may both allocate, the loser frees its copy
+            Slot* fresh = new Slot[T_ChunkSize];
+            if (entry.compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                chunk = fresh;
+            } else {
+                delete[] fresh;
+            }
+        }
+        return chunk[index % T_ChunkSize];
+    }
+
+    MagicId PopFree() {
+        uint64_t head = m_FreeHead.load(std::memory_order_acquire);
+        while (static_cast<MagicId>(head) != NIL) {
+            MagicId index = static_cast<MagicId>(head);
+            MagicId next = m_Chunks[index / T_ChunkSize].load(std::memory_order_acquire)[index % T_ChunkSize]
+                .nextFree.load(std::memory_order_relaxed);
+            uint64_t desired = (((head >> 32) + 1) << 32) | next;
+            if (m_FreeHead.compare_exchange_weak(head, desired, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                return index;
+            }
+        }
+        return NIL;
+    }
+
+    void PushFree(MagicId index, Slot& slot) {
+        uint64_t head = m_FreeHead.load(std::memory_order_relaxed);
+        uint64_t desired;
+        do {
+            slot.nextFree.store(static_cast<MagicId>(head), std::memory_order_relaxed);
+            desired = (((head >> 32) + 1) << 32) | index;
+        } while (!m_FreeHead.compare_exchange_weak(head, desired, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    bool Free(const T_Extern& handle, bool live) {
+        if (handle.index == NIL)
+            return false;
+        Slot* slot = SlotAt(handle.index);
+        if (!slot)
+            return false;
+
+        uint64_t state = slot->state.load(std::memory_order_acquire);
+        while (state == Pack(handle.generation, STATE_RESERVED) || (live && state == Pack(handle.generation, STATE_LIVE))) {
+            bool wasLive = state == Pack(handle.generation, STATE_LIVE);
+            if (slot->state.compare_exchange_weak(state, Pack(handle.generation + 1, STATE_FREE), std::memory_order_acq_rel)) {
+                if (wasLive) slot->value.UnSign(); // Reserved slots were never signed
+                PushFree(handle.index, *slot);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool HasState(const T_Extern& handle, uint32_t state) const {
+        if (handle.index == NIL)
+            return false;
+        const Slot* slot = SlotAt(handle.index);
+        return slot && slot->state.load(std::memory_order_acquire) == Pack(handle.generation, state);
+    }
+public:
+    ConcurrentMagicPool() = default;
+    ~ConcurrentMagicPool() {
+        for (size_t i{0}; i < T_MaxChunks; i++) {
+            delete[] m_Chunks[i].load(std::memory_order_relaxed);
+        }
+    }
+
+    AX_NON_COPYABLE_NON_MOVABLE(ConcurrentMagicPool)
+
+    // Thread-safe, lock-free; index == UINT32_MAX once CAPACITY is exhausted
+    T_Extern ReserveHandle() {
+        MagicId index = PopFree();
+        if (index == NIL) {
+            index = m_Next.load(std::memory_order_relaxed);
+            do {
+                if (index >= CAPACITY) {
+                    T_Extern res;
+                    res.index = NIL;
+                    return res;
+                }
+            } while (!m_Next.compare_exchange_weak(index, index + 1, std::memory_order_acq_rel, std::memory_order_relaxed));
+        }
+        Slot& slot = EnsureSlot(index);
+        MagicId generation = static_cast<MagicId>(slot.state.load(std::memory_order_acquire) >> 32);
+        slot.state.store(Pack(generation, STATE_RESERVED), std::memory_order_release);
+
+        T_Extern res;
+        res.index = index;
+        res.generation = generation;
+        return res;
+    }
+
+    // Owner thread: makes a reserved handle valid and hands out its reset internal, nullptr if it is not reserved
+    T_Intern* Acquire(const T_Extern& reserved) {
+        if (reserved.index == NIL)
+            return nullptr;
+        Slot* slot = SlotAt(reserved.index);
+        if (!slot)
+            return nullptr;
+
+        uint64_t expected = Pack(reserved.generation, STATE_RESERVED);
+        if (!slot->state.compare_exchange_strong(expected, Pack(reserved.generation, STATE_LIVE), std::memory_order_acq_rel))
+            return nullptr;
+
+        slot->value = T_Intern{};
+        slot->value.index = reserved.index;
+        slot->value.generation = reserved.generation;
+        return &slot->value;
+    }
+
+    // Owner thread: ReserveHandle() + Acquire(), same contract as MagicPool::Reserve()
+    T_Intern* Reserve() {
+        return Acquire(ReserveHandle());
+    }
+
+    bool IsValid(const T_Extern& handle) const {
+        return HasState(handle, STATE_LIVE);
+    }
+
+    bool IsReserved(const T_Extern& handle) const {
+        return HasState(handle, STATE_RESERVED);
+    }
+
+    bool IsEqual(const T_Extern& a, const T_Extern& b) const {
+        return a.index == b.index && a.generation == b.generation;
+    }
+
+    T_Intern* Get(const T_Extern& handle) {
+        if (!IsValid(handle))
+            return nullptr;
+        return &SlotAt(handle.index)->value;
+    }
+
+    // Owner thread: frees a live or a still-reserved handle
+    bool Delete(const T_Extern& handle) {
+        return Free(handle, true);
+    }
+
+    // Any thread: frees a handle that is only reserved, false once the owner made it live
+    bool ReleaseReservation(const T_Extern& handle) {
+        return Free(handle, false);
+    }
+
+    MagicId GetHighWater() const { return m_Next.load(std::memory_order_relaxed); }
+};
+
+}
@@ -0,0 +1,206 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace axle
+{
+
+template <typename Sig, std::size_t N = 64>
+class InplaceFunction;
+
+template <typename Sig>
+class FunctionRef;
+
+namespace detail
+{
+
+template <typename T>
+struct IsStdFunction : std::false_type {};
+template <typename Sig>
+struct IsStdFunction<std::function<Sig>> : std::true_type {};
+
+// Callables that can be "empty": constructing from a null one yields an empty function
+template <typename F>
+constexpr bool IsNullable = std::is_pointer_v<F> || std::is_member_pointer_v<F> || IsStdFunction<F>::value;
+
+}
+
+// Move-only type-erased callable, stored inline when it fits N bytes (heap otherwise); one indirect call per invoke
+template <typename R, typename... Args, std::size_t N>
+class InplaceFunction<R(Args...), N> {
+public:
+    static constexpr std::size_t INPLACE_SIZE = N;
+    static_assert(N >= sizeof(void*), "InplaceFunction needs room for at least a pointer");
+private:
+    struct VTable {
+        R (*invoke)(void* storage, Args&&... args);
+        void (*move)(void* dst, void* src);
+        void (*destroy)(void* storage);
+    };
+
+    template <typename F>
+    static constexpr bool FitsInplace =
+        sizeof(F) <= N &&
+        alignof(F) <= alignof(std::max_align_t) &&
+        std::is_nothrow_move_constructible_v<F>;
+
+    template <typename F>
+    static const VTable* InplaceVTable() {
+        static constexpr VTable vt{
+            [](void* s, Args&&... args) -> R {
+                return std::invoke(*std::launder(reinterpret_cast<F*>(s)), std::forward<Args>(args)...);
+            },
+            [](void* d, void* s) {
+                auto* src = std::launder(reinterpret_cast<F*>(s));
+                ::new (d) F(std::move(*src));
+                src->~F();
+            },
+            [](void* s) { std::launder(reinterpret_cast<F*>(s))->~F(); }
+        };
+        return &vt;
+    }
+
+    template <typename F>
+    static const VTable* HeapVTable() {
+        static constexpr VTable vt{
+            [](void* s, Args&&... args) -> R {
+                return std::invoke(**reinterpret_cast<F**>(s), std::forward<Args>(args)...);
+            },
+            [](void* d, void* s) { *reinterpret_cast<F**>(d) = *reinterpret_cast<F**>(s); },
+            [](void* s) { delete *reinterpret_cast<F**>(s); }
+        };
+        return &vt;
+    }
+
+    template <typename F>
+    static const VTable* VTableOf() {
+        if constexpr (FitsInplace<F>) {
+            return InplaceVTable<F>();
+        } else {
+            return HeapVTable<F>();
+        }
+    }
+
+    // Invoking through a const function still calls the stored object's non-const operator(), like std::function
+    alignas(std::max_align_t) mutable unsigned char m_Storage[N];
+    const VTable* m_VTable{nullptr};
+
+    void Reset() {
+        if (m_VTable) {
+            m_VTable->destroy(m_Storage);
+            m_VTable = nullptr;
+        }
+    }
+
+    void MoveFrom(InplaceFunction& other) noexcept {
+        if (other.m_VTable) {
+            other.m_VTable->move(m_Storage, other.m_Storage);
+            m_VTable = other.m_VTable;
+            other.m_VTable = nullptr;
+        }
+    }
+public:
+    InplaceFunction() = default;
+    InplaceFunction(std::nullptr_t) {}
+
+    template <typename F>
+    requires (!std::same_as<std::remove_cvref_t<F>, InplaceFunction>) &&
+             std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    InplaceFunction(F&& func) {
+        using Fn = std::decay_t<F>;
+        if constexpr (detail::IsNullable<Fn>) {
+            if (!func) return;
+        }
+        if constexpr (FitsInplace<Fn>) {
+            ::new (static_cast<void*>(m_Storage)) Fn(std::forward<F>(func));
+        } else {
+            *reinterpret_cast<Fn**>(m_Storage) = new Fn(std::forward<F>(func));
+        }
+        m_VTable = VTableOf<Fn>();
+    }
+
+    InplaceFunction(InplaceFunction&& other) noexcept { MoveFrom(other); }
+
+    InplaceFunction& operator=(InplaceFunction&& other) noexcept {
+        if (this != &other) {
+            Reset();
+            MoveFrom(other);
+        }
+        return *this;
+    }
+
+    InplaceFunction& operator=(std::nullptr_t) noexcept {
+        Reset();
+        return *this;
+    }
+
+    template <typename F>
+    requires (!std::same_as<std::remove_cvref_t<F>, InplaceFunction>) &&
+             std::is_invocable_r_v<R, std::decay_t<F>&, Args...>
+    InplaceFunction& operator=(F&& func) {
+        return *this = InplaceFunction(std::forward<F>(func));
+    }
+
+    InplaceFunction(const InplaceFunction&) = delete;
+    InplaceFunction& operator=(const InplaceFunction&) = delete;
+
+    ~InplaceFunction() { Reset(); }
+
+    R operator()(Args... args) const { return m_VTable->invoke(m_Storage, std::forward<Args>(args)...); }
+    explicit operator bool() const { return m_VTable != nullptr; }
+
+    friend bool operator==(const InplaceFunction& func, std::nullptr_t) { return !func; }
+
+    // The stored callable when it is exactly an F, lets hot paths call a known default without the indirection
+    template <typename F>
+    F* Target() const {
+        if (m_VTable != VTableOf<F>()) return nullptr;
+        if constexpr (FitsInplace<F>) {
+            return std::launder(reinterpret_cast<F*>(m_Storage));
+        } else {
+            return *reinterpret_cast<F**>(m_Storage);
+        }
+    }
+};
+
+// Non-owning view of a callable, two pointers; the callable must outlive it (pass it down, don't store it)
+template <typename R, typename... Args>
+class FunctionRef<R(Args...)> {
+private:
+    union Target {
+        void* object;
+        void (*function)();
+    };
+
+    Target m_Target{};
+    R (*m_Invoke)(Target target, Args&&... args){nullptr};
+public:
+    template <typename F>
+    requires (!std::same_as<std::remove_cvref_t<F>, FunctionRef>) &&
+             std::is_invocable_r_v<R, F&, Args...>
+    FunctionRef(F&& func) noexcept {
+        if constexpr (std::is_function_v<std::remove_pointer_t<std::remove_cvref_t<F>>>) {
+            using Fn = std::remove_pointer_t<std::remove_cvref_t<F>>*;
+            m_Target.function = reinterpret_cast<void (*)()>(static_cast<Fn>(func));
+            m_Invoke = [](Target t, Args&&... args) -> R {
+                return std::invoke(reinterpret_cast<Fn>(t.function), std::forward<Args>(args)...);
+            };
+        } else {
+            using Obj = std::remove_reference_t<F>;
+            m_Target.object = const_cast<void*>(static_cast<const volatile void*>(std::addressof(func)));
+            m_Invoke = [](Target t, Args&&... args) -> R {
+                return std::invoke(*static_cast<Obj*>(t.object), std::forward<Args>(args)...);
+            };
+        }
+    }
+
+    R operator()(Args... args) const { return m_Invoke(m_Target, std::forward<Args>(args)...); }
+};
+
+}
@@ -156,12 +156,12 @@ public:
         return m_Order;
     }
 
-    void ModifyOrder(std::function<void(std::vector<MagicId>&)> modify_func) {
+    void ModifyOrder(FunctionRef<void(std::vector<MagicId>&)> modify_func) {
         if (!m_Ordered) return;
         modify_func(m_Order);
     }
 
-    void SortOrder(Predicate<T_Intern> cmp) {
+    void SortOrder(FunctionRef<bool(const T_Intern&, const T_Intern&)> cmp) {
         if (!m_Ordered) return;
         std::sort(
             m_Order.begin(),
@@ -172,7 +172,7 @@ public:
         );
     }
 
-    void SortOrder(Predicate<T_Extern> cmp) {
+    void SortOrder(FunctionRef<bool(const T_Extern&, const T_Extern&)> cmp) {
         if (!m_Ordered) return;
         std::sort(
             m_Order.begin(),
@@ -0,0 +1,254 @@
+#pragma once
+
+#include "axle/utils/AX_MagicPool.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace axle::utils
+{
+
+// Slot map flavour of MagicPool: live values stay packed in dense arrays (one per component, SoA when more
+// than one) so iteration never touches dead slots; handles resolve through a sparse slot table with
+// generations. Erase is O(1) by swap-remove, which reorders the dense arrays. Ordered maps additionally keep
+// an intrusive doubly-linked list through the slots, so inserting after / moving / erasing never scans.
+template <typename T_Extern, typename... T_Components>
+requires (std::is_base_of_v<MagicHandle, T_Extern> && sizeof...(T_Components) > 0)
+class MagicSlotMap {
+private:
+    static constexpr MagicId NIL = UINT32_MAX;
+
+    struct Slot {
+        MagicId dense{NIL}; // NIL while free
+        MagicId generation{0};
+        MagicId prev{NIL};
+        MagicId next{NIL}; // Next in order, or next free slot
+    };
+
+    std::vector<Slot> m_Slots{};
+    std::tuple<std::vector<T_Components>...> m_Dense{};
+    std::vector<MagicId> m_DenseToSlot{};
+    MagicId m_FreeHead{NIL};
+
+    bool m_Ordered{false};
+    MagicId m_Head{NIL}, m_Tail{NIL};
+
+    T_Extern MakeHandle(MagicId slot) const {
+        T_Extern res;
+        res.index = slot;
+        res.generation = m_Slots[slot].generation;
+        return res;
+    }
+
+    MagicId AcquireSlot() {
+        if (m_FreeHead != NIL) {
+            MagicId slot = m_FreeHead;
+            m_FreeHead = m_Slots[slot].next;
+            return slot;
+        }
+        m_Slots.emplace_back();
+        return static_cast<MagicId>(m_Slots.size() - 1);
+    }
+
+    bool IsLive(MagicId slot) const {
+        return slot < m_Slots.size() && m_Slots[slot].dense != NIL;
+    }
+
+    // `after` == NIL (or dead) appends
+    void Link(MagicId slot, MagicId after) {
+        auto& s = m_Slots[slot];
+        if (!IsLive(after) || after == slot) after = m_Tail;
+
+        s.prev = after;
+        s.next = after == NIL ? m_Head : m_Slots[after].next;
+        if (s.prev != NIL) m_Slots[s.prev].next = slot; else m_Head = slot;
+        if (s.next != NIL) m_Slots[s.next].prev = slot; else m_Tail = slot;
+    }
+
+    void Unlink(MagicId slot) {
+        auto& s = m_Slots[slot];
+        if (s.prev != NIL) m_Slots[s.prev].next = s.next; else m_Head = s.next;
+        if (s.next != NIL) m_Slots[s.next].prev = s.prev; else m_Tail = s.prev;
+        s.prev = s.next = NIL;
+    }
+
+    template <size_t... Is, typename... Args>
+    void EmplaceDense(std::index_sequence<Is...>, Args&&... components) {
+        (std::get<Is>(m_Dense).emplace_back(std::forward<Args>(components)), ...);
+    }
+
+    template <size_t... Is>
+    void SwapRemoveDense(std::index_sequence<Is...>, MagicId dense) {
+        auto move = [dense](auto& vec) {
+            if (dense + 1 != vec.size()) vec[dense] = std::move(vec.back());
+            vec.pop_back();
+        };
+        (move(std::get<Is>(m_Dense)), ...);
+    }
+
+    template <typename F, size_t... Is>
+    void Invoke(F& fn, MagicId slot, std::index_sequence<Is...>) {
+        MagicId dense = m_Slots[slot].dense;
+        fn(MakeHandle(slot), std::get<Is>(m_Dense)[dense]...);
+    }
+public:
+    template <size_t I>
+    using component_type = std::tuple_element_t<I, std::tuple<T_Components...>>;
+
+    explicit MagicSlotMap(bool ordered = false) : m_Ordered(ordered) {}
+
+    void Reserve(size_t capacity) {
+        m_Slots.reserve(capacity);
+        m_DenseToSlot.reserve(capacity);
+        std::apply([capacity](auto&... vec) { (vec.reserve(capacity), ...); }, m_Dense);
+    }
+
+    size_t Size() const { return m_DenseToSlot.size(); }
+    bool Empty() const { return m_DenseToSlot.empty(); }
+
+    void Clear() {
+        for (MagicId dense{0}; dense < m_DenseToSlot.size(); dense++) {
+            auto& slot = m_Slots[m_DenseToSlot[dense]];
+            slot.dense = NIL;
+            slot.generation++;
+            slot.prev = NIL;
+            slot.next = m_FreeHead;
+            m_FreeHead = m_DenseToSlot[dense];
+        }
+        m_DenseToSlot.clear();
+        std::apply([](auto&... vec) { (vec.clear(), ...); }, m_Dense);
+        m_Head = m_Tail = NIL;
+    }
+
+    bool IsValid(MagicId index, MagicId generation) const {
+        return IsLive(index) && m_Slots[index].generation == generation;
+    }
+
+    bool IsValid(const T_Extern& handle) const {
+        return IsValid(handle.index, handle.generation);
+    }
+
+    // One argument per component
+    template <typename... Args>
+    requires (sizeof...(Args) == sizeof...(T_Components))
+    T_Extern Insert(Args&&... components) {
+        return InsertAfter(NIL, std::forward<Args>(components)...);
+    }
+
+    // Ordered maps only place the entry after the live slot `after`, otherwise at the end
+    template <typename... Args>
+    requires (sizeof...(Args) == sizeof...(T_Components))
+    T_Extern InsertAfter(MagicId after, Args&&... components) {
+        MagicId slot = AcquireSlot();
+        EmplaceDense(std::index_sequence_for<T_Components...>{}, std::forward<Args>(components)...);
+        m_Slots[slot].dense = static_cast<MagicId>(m_DenseToSlot.size());
+        m_DenseToSlot.push_back(slot);
+
+        if (m_Ordered) {
+            Link(slot, after);
+        }
+        return MakeHandle(slot);
+    }
+
+    bool Erase(const T_Extern& handle) {
+        if (!IsValid(handle))
+            return false;
+
+        MagicId slot = handle.index;
+        MagicId dense = m_Slots[slot].dense;
+        MagicId last = static_cast<MagicId>(m_DenseToSlot.size() - 1);
+
+        SwapRemoveDense(std::index_sequence_for<T_Components...>{}, dense);
+        if (dense != last) {
+            m_DenseToSlot[dense] = m_DenseToSlot[last];
+            m_Slots[m_DenseToSlot[dense]].dense = dense;
+        }
+        m_DenseToSlot.pop_back();
+
+        if (m_Ordered) {
+            Unlink(slot);
+        }
+        auto& s = m_Slots[slot];
+        s.dense = NIL;
+        s.generation++;
+        s.next = m_FreeHead;
+        m_FreeHead = slot;
+        return true;
+    }
+
+    template <size_t I = 0>
+    component_type<I>* Get(const T_Extern& handle) {
+        if (!IsValid(handle))
+            return nullptr;
+        return &std::get<I>(m_Dense)[m_Slots[handle.index].dense];
+    }
+
+    template <size_t I = 0>
+    const component_type<I>* Get(const T_Extern& handle) const {
+        if (!IsValid(handle))
+            return nullptr;
+        return &std::get<I>(m_Dense)[m_Slots[handle.index].dense];
+    }
+
+    // Packed live values, in no particular order; index i belongs to HandleAt(i)
+    template <size_t I = 0>
+    std::vector<component_type<I>>& Dense() { return std::get<I>(m_Dense); }
+
+    template <size_t I = 0>
+    const std::vector<component_type<I>>& Dense() const { return std::get<I>(m_Dense); }
+
+    T_Extern HandleAt(size_t dense) const { return MakeHandle(m_DenseToSlot[dense]); }
+
+    // fn(handle, components&...) over live entries in dense order
+    template <typename F>
+    void ForEach(F&& fn) {
+        for (MagicId dense{0}; dense < m_DenseToSlot.size(); dense++) {
+            Invoke(fn, m_DenseToSlot[dense], std::index_sequence_for<T_Components...>{});
+        }
+    }
+
+    // fn(handle, components&...) in list order, ordered maps only; fn must not insert or erase
+    template <typename F>
+    void ForEachOrdered(F&& fn) {
+        for (MagicId slot{m_Head}; slot != NIL; slot = m_Slots[slot].next) {
+            Invoke(fn, slot, std::index_sequence_for<T_Components...>{});
+        }
+    }
+
+    bool MoveAfter(const T_Extern& handle, MagicId after) {
+        if (!m_Ordered || !IsValid(handle) || handle.index == after)
+            return false;
+        Unlink(handle.index);
+        Link(handle.index, after);
+        return true;
+    }
+
+    bool MoveToBack(const T_Extern& handle) {
+        return MoveAfter(handle, NIL);
+    }
+
+    // Relinks the list by cmp(handleA, handleB), O(n log n)
+    template <typename Cmp>
+    void SortOrder(Cmp cmp) {
+        if (!m_Ordered) return;
+        std::vector<MagicId> order;
+        order.reserve(Size());
+        for (MagicId slot{m_Head}; slot != NIL; slot = m_Slots[slot].next) {
+            order.push_back(slot);
+        }
+        std::stable_sort(order.begin(), order.end(), [&](MagicId a, MagicId b) {
+            return cmp(MakeHandle(a), MakeHandle(b));
+        });
+        m_Head = m_Tail = NIL;
+        for (MagicId slot : order) {
+            m_Slots[slot].prev = m_Slots[slot].next = NIL;
+            Link(slot, NIL);
+        }
+    }
+};
+
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace axle::utils
+{
+
+// FNV-1a with a murmur finalizer, usable at compile time; NameIds carry its low 32 bits
+constexpr uint64_t NameHash(std::string_view text) {
+    uint64_t h = 0xCBF29CE484222325ull;
+    for (char c : text) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x100000001B3ull;
+    }
+    h ^= h >> 33;
+    h *= 0xFF51AFD7ED558CCDull;
+    h ^= h >> 33;
+    h *= 0xC4CEB9FE1A85EC53ull;
+    return h ^ (h >> 33);
+}
+
+// A literal whose hash was computed by the compiler, see AX_NAME
+struct NameLiteral {
+    std::string_view text;
+    uint64_t hash;
+
+    consteval NameLiteral(const char* literal) : text(literal), hash(NameHash(text)) {}
+};
+
+// Interned string: 8 bytes (table index + hash), compares and hashes as integers, and its text
+// lives as long as the process. The table is global and lock-free; interning a name that already
+// exists never allocates. Index 0 is the empty name.
+class NameId {
+private:
+    uint32_t m_Index{0};
+    uint32_t m_Hash{0};
+
+    NameId(uint32_t index, uint32_t hash) : m_Index(index), m_Hash(hash) {}
+
+    static NameId Intern(std::string_view text, uint64_t hash);
+public:
+    // Bounds the table: 3/4 of the slots can hold names, interning past that is fatal
+    static constexpr uint32_t TABLE_SLOTS = 1u << 18;
+    static constexpr uint32_t MAX_NAMES = TABLE_SLOTS / 4 * 3;
+
+    constexpr NameId() = default;
+    NameId(std::string_view text) : NameId(Intern(text, NameHash(text))) {}
+    NameId(const char* text) : NameId(std::string_view(text)) {}
+    NameId(const std::string& text) : NameId(std::string_view(text)) {}
+    explicit NameId(NameLiteral literal) : NameId(Intern(literal.text, literal.hash)) {}
+
+    // Lookup only, nullopt if the text was never interned
+    static std::optional<NameId> Find(std::string_view text);
+
+    // Interns "name[index]", e.g. the GL uniform name of an array element
+    NameId Indexed(uint32_t index) const;
+
+    std::string_view View() const;
+    const char* CStr() const; // Null-terminated, stable
+    std::string Str() const { return std::string(View()); }
+
+    constexpr uint32_t Index() const { return m_Index; }
+    constexpr uint32_t Hash() const { return m_Hash; }
+    constexpr bool IsEmpty() const { return m_Index == 0; }
+
+    // Count of interned names, including the empty one
+    static uint32_t Count();
+
+    constexpr bool operator==(const NameId& other) const { return m_Index == other.m_Index; }
+    // Table order, not alphabetical
+    constexpr auto operator<=>(const NameId& other) const { return m_Index <=> other.m_Index; }
+
+    friend bool operator==(const NameId& name, std::string_view text) { return name.View() == text; }
+    friend bool operator==(const NameId& name, const char* text) { return name.View() == text; }
+    friend bool operator==(const NameId& name, const std::string& text) { return name.View() == text; }
+};
+
+}
+
+// NameId of a string literal, hashed at compile time and interned once per call site
+#define AX_NAME(literal) \
+    ([]() -> const ::axle::utils::NameId& { \
+        static const ::axle::utils::NameId s_Name{::axle::utils::NameLiteral(literal)}; \
+        return s_Name; \
+    }())
+
+namespace std {
+
+template<>
+struct hash<axle::utils::NameId> {
+    size_t operator()(const axle::utils::NameId& name) const noexcept {
+        return name.Hash();
+    }
+};
+
+}
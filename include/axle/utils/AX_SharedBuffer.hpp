@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+#include <vector>
+
+namespace axle::utils
+{
+
+// Immutable refcounted array: copies and slices share one block (atomic refcount, no element copies).
+// The only way to write is MakeMutable(), which detaches into a private copy first unless already unique.
+template <typename T>
+class SharedBuffer {
+private:
+    struct Block {
+        std::atomic<uint32_t> refs{1};
+        std::pmr::memory_resource* resource{nullptr}; // Where the elements live, nullptr: std::allocator
+        void (*destroy)(Block* block){nullptr};
+        bool external{false}; // Elements belong to an outside owner (e.g. a file mapping) and are never written in place
+    };
+
+    template <typename Vec>
+    struct VecBlock : Block {
+        Vec storage;
+        explicit VecBlock(Vec&& vec) : storage(std::move(vec)) {
+            this->destroy = [](Block* block) { delete static_cast<VecBlock*>(block); };
+        }
+    };
+
+    struct ExternalBlock : Block {
+        std::shared_ptr<const void> owner;
+        explicit ExternalBlock(std::shared_ptr<const void>&& keepAlive) : owner(std::move(keepAlive)) {
+            this->external = true;
+            this->destroy = [](Block* block) { delete static_cast<ExternalBlock*>(block); };
+        }
+    };
+
+    Block* m_Block{nullptr};
+    T* m_Data{nullptr};
+    size_t m_Size{0};
+
+    void Retain() const {
+        if (m_Block) m_Block->refs.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void Release() {
+        if (m_Block && m_Block->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            m_Block->destroy(m_Block);
+        }
+        m_Block = nullptr;
+        m_Data = nullptr;
+        m_Size = 0;
+    }
+
+    SharedBuffer(Block* block, T* data, size_t size) : m_Block(block), m_Data(data), m_Size(size) {}
+public:
+    using const_iterator = const T*;
+
+    SharedBuffer() = default;
+
+    SharedBuffer(std::vector<T>&& data) {
+        auto* block = new VecBlock<std::vector<T>>(std::move(data));
+        m_Block = block;
+        m_Data = block->storage.data();
+        m_Size = block->storage.size();
+    }
+
+    // Keeps the vector's memory_resource, copies made by MakeMutable() allocate from it too
+    SharedBuffer(std::pmr::vector<T>&& data) {
+        auto* block = new VecBlock<std::pmr::vector<T>>(std::move(data));
+        block->resource = block->storage.get_allocator().resource();
+        m_Block = block;
+        m_Data = block->storage.data();
+        m_Size = block->storage.size();
+    }
+
+    static SharedBuffer Copy(const T* data, size_t size, std::pmr::memory_resource* resource = nullptr) {
+        if (resource) {
+            return SharedBuffer(std::pmr::vector<T>(data, data + size, resource));
+        }
+        return SharedBuffer(std::vector<T>(data, data + size));
+    }
+
+    // Shares memory owned elsewhere without copying it; `owner` stays alive until the last copy/slice is gone.
+    // MakeMutable() always detaches from such a buffer, the outside memory may be read-only.
+    static SharedBuffer Adopt(const T* data, size_t size, std::shared_ptr<const void> owner) {
+        return SharedBuffer(new ExternalBlock(std::move(owner)), const_cast<T*>(data), size);
+    }
+
+    SharedBuffer(const SharedBuffer& other) : m_Block(other.m_Block), m_Data(other.m_Data), m_Size(other.m_Size) {
+        Retain();
+    }
+
+    SharedBuffer& operator=(const SharedBuffer& other) {
+        if (this != &other) {
+            other.Retain();
+            Release();
+            m_Block = other.m_Block;
+            m_Data = other.m_Data;
+            m_Size = other.m_Size;
+        }
+        return *this;
+    }
+
+    SharedBuffer(SharedBuffer&& other) noexcept
+        : m_Block(std::exchange(other.m_Block, nullptr)),
+          m_Data(std::exchange(other.m_Data, nullptr)),
+          m_Size(std::exchange(other.m_Size, 0)) {}
+
+    SharedBuffer& operator=(SharedBuffer&& other) noexcept {
+        if (this != &other) {
+            Release();
+            m_Block = std::exchange(other.m_Block, nullptr);
+            m_Data = std::exchange(other.m_Data, nullptr);
+            m_Size = std::exchange(other.m_Size, 0);
+        }
+        return *this;
+    }
+
+    ~SharedBuffer() { Release(); }
+
+    // Shares the block, count is clamped to the end of this buffer
+    SharedBuffer Slice(size_t offset, size_t count = SIZE_MAX) const {
+        if (offset > m_Size) offset = m_Size;
+        if (count > m_Size - offset) count = m_Size - offset;
+        Retain();
+        return SharedBuffer(m_Block, m_Data + offset, count);
+    }
+
+    // Writable view of this buffer's range, copying it out of the shared block first if anyone else holds it
+    T* MakeMutable() {
+        if (m_Block && (m_Block->external || !IsUnique())) {
+            *this = Copy(m_Data, m_Size, m_Block->resource);
+        }
+        return m_Data;
+    }
+
+    bool IsExternal() const { return m_Block && m_Block->external; }
+    bool IsUnique() const { return m_Block && m_Block->refs.load(std::memory_order_acquire) == 1; }
+    uint32_t UseCount() const { return m_Block ? m_Block->refs.load(std::memory_order_relaxed) : 0; }
+
+    explicit operator bool() const { return m_Block != nullptr; }
+
+    const T& operator[](size_t index) const noexcept { return m_Data[index]; }
+
+    const T* data() const { return m_Data; }
+    size_t size() const { return m_Size; }
+    bool empty() const { return m_Size == 0; }
+
+    const_iterator begin() const { return m_Data; }
+    const_iterator end() const { return m_Data + m_Size; }
+};
+
+}
@@ -1,6 +1,12 @@
 #pragma once
 
+#include "axle/utils/AX_SharedBuffer.hpp"
+
 #include <array>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <utility>
 #include <vector>
 
 namespace axle::utils
@@ -38,75 +44,83 @@ private:
 using SRawView = utils::Span<int8_t>;
 using URawView = utils::Span<uint8_t>;
 
+// Either a borrowed view or a share of a SharedBuffer: copies bump a refcount instead of duplicating the
+// elements. The non-const accessors detach owned storage first (MakeMutable()), so writes never reach other
+// shares or adopted read-only memory; borrowed views are written in place. Raw reads go through the const ones.
 template<typename T>
 class CowSpan {
 private:
-    bool m_Owned{false};
-
     Span<T> m_View{};
-    std::vector<T> m_Storage{};
+    SharedBuffer<T> m_Buffer{}; // Empty while borrowing
+
+    void BindBuffer() {
+        m_View = Span<T>(const_cast<T*>(m_Buffer.data()), m_Buffer.size());
+    }
 public:
     using iterator = T*;
     using const_iterator = const T*;
 
     CowSpan() = default;
-    CowSpan(Span<T> span) : m_Owned(false), m_View(span) {}
-    CowSpan(std::vector<T>&& data) : m_Owned(true), m_Storage(std::move(data)) {
-        m_View = Span<T>(m_Storage.data(), m_Storage.size());
-    }
-    CowSpan(const CowSpan& other) : m_Owned(other.m_Owned), m_Storage(other.m_Storage) {
-        if (m_Owned) {
-            m_View = Span<T>(m_Storage.data(), m_Storage.size());
-        } else {
-            m_View = other.m_View;
-        }
-    }
+    CowSpan(Span<T> span) : m_View(span) {}
+    CowSpan(SharedBuffer<T> buffer) : m_Buffer(std::move(buffer)) { BindBuffer(); }
+    CowSpan(std::vector<T>&& data) : m_Buffer(std::move(data)) { BindBuffer(); }
+    // Keeps the vector's memory_resource (e.g. a TlsfAllocator heap)
+    CowSpan(std::pmr::vector<T>&& data) : m_Buffer(std::move(data)) { BindBuffer(); }
 
-    CowSpan& operator=(const CowSpan& other) {
-        if (this == &other)
-            return *this;
+    CowSpan(const CowSpan& other) = default;
+    CowSpan& operator=(const CowSpan& other) = default;
 
-        m_Owned = other.m_Owned;
-        m_Storage = other.m_Storage;
+    CowSpan(CowSpan&& other) noexcept
+        : m_View(std::exchange(other.m_View, Span<T>{})), m_Buffer(std::move(other.m_Buffer)) {}
 
-        if (m_Owned) {
-            m_View = Span<T>(m_Storage.data(), m_Storage.size());
-        } else {
-            m_View = other.m_View;
+    CowSpan& operator=(CowSpan&& other) noexcept {
+        if (this != &other) {
+            m_View = std::exchange(other.m_View, Span<T>{});
+            m_Buffer = std::move(other.m_Buffer);
         }
         return *this;
     }
 
-    CowSpan(CowSpan&& other) noexcept : m_Owned(other.m_Owned), m_Storage(std::move(other.m_Storage)) {
-        if (m_Owned) {
-            m_View = Span<T>(m_Storage.data(), m_Storage.size());
-        } else {
-            m_View = other.m_View;
-        }
-    }
+    bool IsOwned() const { return static_cast<bool>(m_Buffer); }
+    bool IsUnique() const { return m_Buffer.IsUnique(); }
+    uint32_t UseCount() const { return m_Buffer.UseCount(); }
 
-    CowSpan& operator=(CowSpan&& other) noexcept {
-        if (this == &other)
-            return *this;
+    // The owning buffer, empty for borrowed views
+    const SharedBuffer<T>& Buffer() const { return m_Buffer; }
 
-        m_Owned = other.m_Owned;
-        m_Storage = std::move(other.m_Storage);
-
-        if (m_Owned)
-            m_View = Span<T>(m_Storage.data(), m_Storage.size());
-        else
-            m_View = other.m_View;
+    // Same ownership as this span, no copy
+    CowSpan Slice(size_t offset, size_t count = SIZE_MAX) const {
+        if (IsOwned()) {
+            return CowSpan(m_Buffer.Slice(offset, count));
+        }
+        if (offset > size()) offset = size();
+        if (count > size() - offset) count = size() - offset;
+        return CowSpan(Span<T>(m_View.handle() + offset, count));
+    }
 
-        return *this;
+    // Private writable copy unless already the sole owner; borrowed views are copied into owned storage
+    Span<T> MakeMutable() {
+        if (!IsOwned()) {
+            if (m_View.size() == 0) return m_View;
+            m_Buffer = SharedBuffer<T>::Copy(m_View.handle(), m_View.size());
+        } else {
+            m_Buffer.MakeMutable();
+        }
+        BindBuffer();
+        return m_View;
     }
 
-    T& operator[](std::size_t index) noexcept { return m_View[index]; }
+    T& operator[](std::size_t index) { return data()[index]; }
     const T& operator[](std::size_t index) const noexcept { return m_View[index]; }
 
     const Span<T>& Get() const { return m_View; }
 
-    T* data() const { return Get().handle(); }
-    size_t size() const { return Get().size(); }
+    T* data() {
+        if (IsOwned()) MakeMutable();
+        return m_View.handle();
+    }
+    const T* data() const { return m_View.handle(); }
+    size_t size() const { return m_View.size(); }
 
     iterator begin() { return data(); }
     iterator end() { return data() + size(); }
@@ -1,5 +1,7 @@
 #pragma once
 
+#include "axle/utils/AX_InplaceFunction.hpp"
+
 #include <chrono>
 #include <functional>
 #include <future>
@@ -26,13 +28,13 @@ using ChSteadyClock = std::chrono::steady_clock;
 using ChSteadyTimepoint = std::chrono::time_point<ChSteadyClock>;
 
 template <typename T>
-using Job = std::function<T()>;
+using Job = InplaceFunction<T()>;
 using VoidJob = Job<void>;
 
-using TickJob = std::function<void(float dTSeconds)>;
+using TickJob = InplaceFunction<void(float dTSeconds)>;
 
 template <typename T>
-using Predicate = std::function<bool(const T& a, const T& b)>;
+using Predicate = InplaceFunction<bool(const T& a, const T& b)>;
 
 template <typename T>
 using Future = std::future<T>;
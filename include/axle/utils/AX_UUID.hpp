@@ -1,67 +1,61 @@
 #pragma once
 
 #include <array>
+#include <compare>
 #include <cstdint>
-#include <iomanip>
-#include <random>
-#include <sstream>
+#include <functional>
+#include <optional>
 #include <string>
+#include <string_view>
 
 // AI-Generated
 
 namespace axle::utils
 {
 
+// 128-bit id held as two big-endian halves, so comparison is byte order (v7 ids sort by creation time)
 class UUID {
 public:
-    UUID() { bytes.fill(0); }
+    static constexpr size_t STRING_LENGTH = 36;
 
-    static UUID Generate() {
-        UUID uuid;
+    constexpr UUID() = default;
+    constexpr UUID(uint64_t high, uint64_t low) : m_High(high), m_Low(low) {}
 
-        static thread_local std::random_device rd;
-        static thread_local std::mt19937_64 gen(rd());
+    // RFC 9562 version 4: random bits from a per-thread xoshiro256** (seeded once), not cryptographic
+    static UUID Generate();
 
-        std::uniform_int_distribution<uint64_t> dist;
+    // RFC 9562 version 7: unix milliseconds + a 12-bit sub-millisecond counter, strictly increasing per process
+    static UUID GenerateV7();
 
-        uint64_t a = dist(gen);
-        uint64_t b = dist(gen);
+    // Accepts the canonical 8-4-4-4-12 form (either hex case)
+    static std::optional<UUID> Parse(std::string_view text);
 
-        for (int i = 0; i < 8; i++)
-            uuid.bytes[i] = static_cast<uint8_t>((a >> (56 - i * 8)) & 0xFF);
+    // Writes STRING_LENGTH characters, no terminator
+    void ToChars(char* out) const;
+    std::string ToString() const;
 
-        for (int i = 0; i < 8; i++)
-            uuid.bytes[8 + i] = static_cast<uint8_t>((b >> (56 - i * 8)) & 0xFF);
+    constexpr uint64_t High() const { return m_High; }
+    constexpr uint64_t Low() const { return m_Low; }
+    constexpr bool IsNil() const { return (m_High | m_Low) == 0; }
+    constexpr uint32_t Version() const { return static_cast<uint32_t>(m_High >> 12) & 0xF; }
 
-        // RFC4122 version 4
-        uuid.bytes[6] = (uuid.bytes[6] & 0x0F) | 0x40;
-        uuid.bytes[8] = (uuid.bytes[8] & 0x3F) | 0x80;
+    std::array<uint8_t, 16> Data() const;
 
-        return uuid;
+    // Full-avalanche 64-bit mix of both halves, so ids differing only in the time or counter bits spread too
+    constexpr uint64_t Hash() const {
+        uint64_t h = m_High * 0x9E3779B97F4A7C15ull ^ (m_Low + 0xD6E8FEB86659FD93ull);
+        h ^= h >> 32;
+        h *= 0xD6E8FEB86659FD93ull;
+        h ^= h >> 32;
+        h *= 0xD6E8FEB86659FD93ull;
+        return h ^ (h >> 32);
     }
 
-    std::string ToString() const {
-        std::ostringstream ss;
-
-        for (int i = 0; i < 16; ++i) {
-            if (i == 4 || i == 6 || i == 8 || i == 10)
-                ss << '-';
-
-            ss << std::hex
-               << std::setw(2)
-               << std::setfill('0')
-               << (int)bytes[i];
-        }
-
-        return ss.str();
-    }
-
-    bool operator==(const UUID&) const = default;
-    auto operator<=>(const UUID&) const = default;
-
-    const std::array<uint8_t, 16>& Data() const { return bytes; }
+    constexpr bool operator==(const UUID&) const = default;
+    constexpr auto operator<=>(const UUID&) const = default;
 private:
-    std::array<uint8_t, 16> bytes;
+    uint64_t m_High{0};
+    uint64_t m_Low{0};
 };
 
 }
@@ -71,20 +65,8 @@ namespace std {
 template<>
 struct hash<axle::utils::UUID> {
     size_t operator()(const axle::utils::UUID& uuid) const noexcept {
-        const auto& d = uuid.Data();
-
-        uint64_t a = 0;
-        uint64_t b = 0;
-
-        for (int i = 0; i < 8; ++i)
-            a = (a << 8) | d[i];
-
-        for (int i = 8; i < 16; ++i)
-            b = (b << 8) | d[i];
-
-        return hash<uint64_t>()(a) ^
-               (hash<uint64_t>()(b) << 1);
+        return static_cast<size_t>(uuid.Hash());
     }
 };
 
-}
\ No newline at end of file
+}
@@ -54,7 +54,12 @@ inline void HashEnum(size_t& h, E v) {
 
 bool EqualsIgnoreCase(const char* a, const char* b);
 
-void Uni_NanoSleep(ChNanos nanos);
+constexpr ChNanos UNI_DEFAULT_SPIN_TAIL = ChNanos(100000);
+
+// Sleeps on the OS timer (absolute deadline) until `spinTail` before target, then spins the rest
+void Uni_SleepUntil(ChSteadyTimepoint target, ChNanos spinTail = UNI_DEFAULT_SPIN_TAIL);
+void Uni_NanoSleep(ChNanos nanos, ChNanos spinTail = UNI_DEFAULT_SPIN_TAIL);
+void Uni_CpuRelax();
 
 unsigned int Decode85Byte(char c);
 void Decode85(const unsigned char* src, unsigned char* dst, std::size_t size);
@@ -1,5 +1,9 @@
 #include "axle/assets/AX_AssetGpu.hpp"
 
+#include "axle/graphics/cmd/AX_IGraphicsBackend.hpp"
+
+#include <sstream>
+
 // struct AssetGPUMeshBuffers {
 //     gfx::BufferHandle vertices;
 //     gfx::BufferHandle indices;
@@ -32,6 +36,52 @@ using namespace axle::utils;
 namespace axle::assets
 {
 
+namespace
+{
+
+struct PendingBuffer {
+    gfx::BufferHandle handle;
+    gfx::BufferDesc desc;
+    utils::URaw bytes; // Shares the import's storage
+};
+
+struct PendingTexture {
+    gfx::TextureHandle handle;
+    gfx::TextureDesc desc;
+    int32_t texIdx{0};
+};
+
+struct PendingMaterial {
+    uint32_t matIdx{0};
+    uint32_t resourceSetIndex{0};
+    MaterialProps props;
+
+    gfx::BufferHandle propsUbo{UINT32_MAX, UINT32_MAX};
+    gfx::BufferDesc propsUboDesc;
+
+    std::vector<PendingTexture> textures;
+    std::vector<gfx::Binding> bindings;
+};
+
+ExError JoinErrors(const std::vector<ExError>& errors) {
+    std::stringstream error_str_stream;
+    for (auto& error : errors) {
+        error_str_stream << "ErrCode=" << error.GetCode() << ", "
+            << error.GetMessage() << "\n";
+    }
+    return ExError{error_str_stream.str()};
+}
+
+// No-op for handles that already went live
+void ReleasePending(gfx::IGraphicsBackend& gbgfx, const std::vector<PendingMaterial>& pending) {
+    for (auto& pmat : pending) {
+        gbgfx.ReleaseReservedBuffer(pmat.propsUbo);
+        for (auto& ptex : pmat.textures) gbgfx.ReleaseReservedTexture(ptex.handle);
+    }
+}
+
+}
+
 AssetGpu::AssetGpu(ThreadGfxScope gfxThread)
     : ThreadOwned(gfxThread) {}
 
@@ -48,125 +98,141 @@ AssetGpu::~AssetGpu() {
 }
 
 ThreadInvocation<ExResult<AssetGpuMeshes>> AssetGpu::UploadMeshes(AssetMeshesUploadDesc& desc) {
-    ThreadInvocation<ExResult<AssetGpuMeshes>>(m_Thread, [&]() -> ExResult<AssetGpuMeshes> {
-        auto gbgfx = m_Thread->GetContext();
+    // Handles are reserved and layouts built on the caller thread, the gfx thread only creates and fills the buffers
+    auto gbgfx = m_Thread->GetContext();
+
+    std::vector<ExError> errors;
+    std::vector<AssetGpuMesh> meshes;
+    std::vector<PendingBuffer> pending;
+
+    auto reserve = [&](const AssetBuffer& buffer, gfx::BufferUsage usage) {
+        PendingBuffer p;
+        p.handle = gbgfx->ReserveBuffer();
+        p.desc.size = buffer.raw.size();
+        p.desc.usage = usage;
+        p.desc.access = gfx::BufferAccess::Immutable;
+        p.desc.cpuVisible = false;
+        p.bytes = buffer.raw;
+        if (p.handle.index != UINT32_MAX) pending.push_back(p);
+        return p.handle;
+    };
+
+    for (uint32_t i{0}; i < desc.immutableMeshes.size(); i++) {
+        auto& immutableMeshRef = desc.immutableMeshes[i];
+
+        gfx::BufferHandle vertexBuffer{UINT32_MAX, UINT32_MAX};
+        gfx::BufferHandle indexBuffer{UINT32_MAX, UINT32_MAX};
+        
+        gfx::MeshVertexLayout layout;
 
-        std::vector<ExError> errors;
-        std::vector<AssetGpuMesh> meshes;
+        auto& vertices = desc.immutableImport.buffers[immutableMeshRef.vertexBufferIdx];
 
-        std::vector<gfx::BufferHandle> localHeldBuffers;
+        vertexBuffer = reserve(vertices, gfx::BufferUsage::Vertex);
+        if (vertexBuffer.index == UINT32_MAX) {
+            errors.push_back({"Vertices handle pool exhausted at desc.meshes, i=" + std::to_string(i)});
+        }
 
-        gfx::BufferDesc verticesDesc;
-        verticesDesc.access = gfx::BufferAccess::Immutable;
-        verticesDesc.usage = gfx::BufferUsage::Vertex;
-        verticesDesc.cpuVisible = false;
+        bool indexed = immutableMeshRef.indexBufferIdx != UINT32_MAX;
+        uint32_t indexCount{0};
 
-        gfx::BufferDesc indicesDesc;
-        indicesDesc.access = gfx::BufferAccess::Immutable;
-        indicesDesc.usage = gfx::BufferUsage::Index;
-        indicesDesc.cpuVisible = false;
+        if (indexed) {
+            auto& indices = desc.immutableImport.buffers[immutableMeshRef.indexBufferIdx];
+            indexCount = indices.count;
 
-        for (uint32_t i{0}; i < desc.immutableMeshes.size(); i++) {
-            auto& immutableMeshRef = desc.immutableMeshes[i];
+            indexBuffer = reserve(indices, gfx::BufferUsage::Index);
+            if (indexBuffer.index == UINT32_MAX) {
+                errors.push_back({"Indices handle pool exhausted at desc.meshes, i=" + std::to_string(i)});
+            }
+        }
 
-            gfx::BufferHandle vertexBuffer{UINT32_MAX, UINT32_MAX};
-            gfx::BufferHandle indexBuffer{UINT32_MAX, UINT32_MAX};
-            
-            gfx::MeshVertexLayout layout;
+        auto& vDesc = GetVertexFormatDesc(immutableMeshRef.vertexFormat);
+
+        gfx::VertexTypeDesc typeDesc {
+            gfx::VertexAttributeClass::Float, 
+            gfx::VertexAttributeType::Float32
+        };
+
+        uint32_t currentOffset = 0;
+        const uint32_t FLOAT_SIZE = sizeof(float); // 4 bytes
+
+        // Position (float3, POSITION0)
+        std::vector<gfx::MeshVertexAttribute> attributes;
+        attributes.push_back({gfx::VertexSemantic::Position, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
+        currentOffset += FLOAT_SIZE * 3;
+        // Normal (float3, NORMAL0)
+        attributes.push_back({gfx::VertexSemantic::Normal, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
+        currentOffset += FLOAT_SIZE * 3;
+        // TexCoords (float2 * uv_count, TEXCOORD[0-7])
+        for (uint32_t uv_i{0}; uv_i < vDesc.uvCount; uv_i++) {
+            attributes.push_back({gfx::VertexSemantic::TexCoord, uv_i, 2, 0, currentOffset, FLOAT_SIZE * 2, typeDesc, false});
+            currentOffset += FLOAT_SIZE * 2;
+        }
+        // Tangent (float3, TANGENT0) (if supported by mesh)
+        if (vDesc.hasTangents) {
+            attributes.push_back({gfx::VertexSemantic::Tangent, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
+            currentOffset += FLOAT_SIZE * 3;
+        }
 
-            auto& vertices = desc.immutableImport.buffers[immutableMeshRef.vertexBufferIdx];
-            verticesDesc.size = vertices.raw.size();
+        layout.attributes = utils::CowSpan{std::move(attributes)};
+        layout.stride = currentOffset; 
 
-            auto vres = gbgfx->CreateBuffer(verticesDesc);
-            if (!vres.has_value()) {
-                auto& err = vres.error();
-                errors.push_back(ExError{err.GetCode(), 
-                    "Vertices Upload failure at desc.meshes, i=" 
-                    + std::to_string(i) + ", Error=" + std::string(err.GetMessage())
-                });
-            } else {
-                vertexBuffer = vres.value();
-                localHeldBuffers.push_back(vertexBuffer);
-            }
+        if (vertices.stride != currentOffset) {
+            errors.push_back({"Vertices stride mismatches with currentOffset, at desc.meshes, i=" + std::to_string(i)});
+        }
 
-            bool indexed = immutableMeshRef.indexBufferIdx != UINT32_MAX;
-            uint32_t indexCount{0};
+        AssetGpuMesh gpuMesh;
+        gpuMesh.vertices = vertexBuffer;
+        gpuMesh.indices = indexBuffer;
+        gpuMesh.layout = layout;
+        gpuMesh.vertexCount = vertices.count;
+        gpuMesh.indexCount = indexCount;
+        gpuMesh.indexed = indexed;
 
-            if (indexed) {
-                auto& indices = desc.immutableImport.buffers[immutableMeshRef.indexBufferIdx];
-                indicesDesc.size = indices.raw.size();
-                indexCount = indices.count;
+        meshes.push_back(gpuMesh);
+    }
 
-                auto ires = gbgfx->CreateBuffer(indicesDesc);
-                if (!ires.has_value()) {
-                    auto& err = ires.error();
-                    errors.push_back(ExError{err.GetCode(), 
-                        "Indices Upload failure at desc.meshes, i=" 
-                        + std::to_string(i) + ", Error=" + std::string(err.GetMessage())
-                    });
-                } else {
-                    indexBuffer = ires.value();
-                    localHeldBuffers.push_back(indexBuffer);
-                }
-            }
+    if (!errors.empty()) {
+        for (auto& p : pending) gbgfx->ReleaseReservedBuffer(p.handle);
+        ExError error = JoinErrors(errors);
+        return ThreadInvocation<ExResult<AssetGpuMeshes>>(m_Thread, [error]() -> ExResult<AssetGpuMeshes> {
+            return error;
+        });
+    }
 
-            auto& vDesc = GetVertexFormatDesc(immutableMeshRef.vertexFormat);
+    return ThreadInvocation<ExResult<AssetGpuMeshes>>(m_Thread, 
+        [this, pending = std::move(pending), gpuMeshes = utils::CowSpan<AssetGpuMesh>{std::move(meshes)}]() -> ExResult<AssetGpuMeshes> {
+        auto gbgfx = m_Thread->GetContext();
 
-            gfx::VertexTypeDesc typeDesc {
-                gfx::VertexAttributeClass::Float, 
-                gfx::VertexAttributeType::Float32
-            };
+        std::vector<ExError> errors;
+        std::vector<gfx::BufferHandle> localHeldBuffers;
 
-            uint32_t currentOffset = 0;
-            const uint32_t FLOAT_SIZE = sizeof(float); // 4 bytes
+        for (uint32_t i{0}; i < pending.size(); i++) {
+            auto& p = pending[i];
 
-            // Position (float3, POSITION0)
-            std::vector<gfx::MeshVertexAttribute> attributes;
-            attributes.push_back({gfx::VertexSemantic::Position, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
-            currentOffset += FLOAT_SIZE * 3;
-            // Normal (float3, NORMAL0)
-            attributes.push_back({gfx::VertexSemantic::Normal, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
-            currentOffset += FLOAT_SIZE * 3;
-            // TexCoords (float2 * uv_count, TEXCOORD[0-7])
-            for (uint32_t uv_i{0}; uv_i < vDesc.uvCount; uv_i++) {
-                attributes.push_back({gfx::VertexSemantic::TexCoord, uv_i, 2, 0, currentOffset, FLOAT_SIZE * 2, typeDesc, false});
-                currentOffset += FLOAT_SIZE * 2;
-            }
-            // Tangent (float3, TANGENT0) (if supported by mesh)
-            if (vDesc.hasTangents) {
-                attributes.push_back({gfx::VertexSemantic::Tangent, 0, 3, 0, currentOffset, FLOAT_SIZE * 3, typeDesc, false});
-                currentOffset += FLOAT_SIZE * 3;
+            auto cerr = gbgfx->CreateReservedBuffer(p.handle, p.desc);
+            if (cerr.IsValid()) {
+                errors.push_back(ExError{cerr.GetCode(), 
+                    "Buffer creation failure at pending buffer i=" 
+                    + std::to_string(i) + ", Error=" + std::string(cerr.GetMessage())
+                });
+                continue;
             }
+            localHeldBuffers.push_back(p.handle);
 
-            layout.attributes = utils::CowSpan{std::move(attributes)};
-            layout.stride = currentOffset; 
-
-            if (vertices.stride != currentOffset) {
-                errors.push_back({"Vertices stride mismatches with currentOffset, at desc.meshes, i=" + std::to_string(i)});
+            auto uerr = gbgfx->UpdateBuffer(p.handle, 0, p.bytes.size(), p.bytes.data());
+            if (uerr.IsValid()) {
+                errors.push_back(ExError{uerr.GetCode(), 
+                    "Buffer upload failure at pending buffer i=" 
+                    + std::to_string(i) + ", Error=" + std::string(uerr.GetMessage())
+                });
             }
-
-            AssetGpuMesh gpuMesh;
-            gpuMesh.vertices = vertexBuffer;
-            gpuMesh.indices = indexBuffer;
-            gpuMesh.layout = layout;
-            gpuMesh.vertexCount = vertices.count;
-            gpuMesh.indexCount = indexCount;
-            gpuMesh.indexed = indexed;
-
-            meshes.push_back(gpuMesh);
         }
 
         if (!errors.empty()) {
-            for (auto& mesh : meshes) {
-                gbgfx->DestroyBuffer(mesh.vertices);
-                if (mesh.indexed) gbgfx->DestroyBuffer(mesh.indices);
-            }
-            std::stringstream error_str_stream;
-            for (auto& error : errors) {
-                error_str_stream << "ErrCode=" << error.GetCode() << ", "
-                    << error.GetMessage() << "\n";
-            }
-            return ExError{error_str_stream.str()};
+            // Only what this call created, reservations it never reached are released
+            for (auto& h : localHeldBuffers) gbgfx->DestroyBuffer(h);
+            for (auto& p : pending) gbgfx->ReleaseReservedBuffer(p.handle);
+            return JoinErrors(errors);
         }
 
         m_HeldBuffers.insert(
@@ -175,12 +241,114 @@ ThreadInvocation<ExResult<AssetGpuMeshes>> AssetGpu::UploadMeshes(AssetMeshesUpl
             std::make_move_iterator(localHeldBuffers.end())
         );
 
-        return AssetGpuMeshes{{std::move(meshes)}};
+        return AssetGpuMeshes{gpuMeshes};
     });
 }
 
 ThreadInvocation<ExResult<AssetGpuMaterials>> AssetGpu::UploadMaterials(AssetMaterialsUploadDesc& desc) {
-    return ThreadInvocation<ExResult<AssetGpuMaterials>>(m_Thread, [&, desc]() -> ExResult<AssetGpuMaterials> {
+    // Same split as UploadMeshes: buffer/texture handles and bindings on the caller thread, GL work on the gfx thread
+    auto gbgfx = m_Thread->GetContext();
+
+    constexpr std::size_t MAT_PROPS_SIZE = sizeof(MaterialProps);
+
+    std::vector<ExError> errors;
+    std::vector<PendingMaterial> pending;
+
+    for (uint32_t matIdx{0}; matIdx < desc.immutableMaterials.size(); matIdx++) {
+        auto& argMat = desc.immutableMaterials[matIdx];
+        auto& mat = argMat.immutableMaterial;
+
+        if (!mat.imported) {
+            errors.push_back({"Material at matIdx=" + std::to_string(matIdx) + " is not yet imported!"});
+            continue;
+        }
+
+        PendingMaterial pmat;
+        pmat.matIdx = matIdx;
+        pmat.resourceSetIndex = argMat.resourceSetIndex;
+        pmat.props = mat.props;
+
+        pmat.propsUboDesc.size = MAT_PROPS_SIZE;
+        pmat.propsUboDesc.usage = gfx::BufferUsage::Uniform;
+        pmat.propsUboDesc.access = gfx::BufferAccess::Dynamic;
+        pmat.propsUboDesc.cpuVisible = true;
+
+        pmat.propsUbo = gbgfx->ReserveBuffer();
+        if (pmat.propsUbo.index == UINT32_MAX) {
+            errors.push_back({"MaterialProps uniform buffer handle pool exhausted at matIdx=" + std::to_string(matIdx)});
+        } else {
+            gfx::ResourceHandle uboResH(pmat.propsUbo);
+            gfx::Binding uboBind;
+            uboBind.bindName = AX_BINDING_KEY_MATERIAL_PROPS;
+            uboBind.slot = AX_BINDING_SLOT_MATERIAL_PROPS;
+            uboBind.type = gfx::BindingType::UniformBuffer;
+            uboBind.resources = {std::vector<gfx::ResourceHandle>{uboResH}};
+            uboBind.offset = 0;
+            uboBind.range = 0;
+            uboBind.stageMask = gfx::BindingStage_Vertex | gfx::BindingStage_Fragment;
+
+            pmat.bindings.push_back(uboBind);
+        }
+
+        for (uint32_t i{0}; i < mat.texture_indices.size(); i++) {
+            auto texType = (MaterialTextureType) i;
+            auto& texIndices = mat.texture_indices[i];
+
+            for (auto& texIdx : texIndices) {
+                auto& tex = desc.immutableImport.textures[texIdx];
+
+                PendingTexture ptex;
+                ptex.texIdx = texIdx;
+                ptex.desc.type = gfx::TextureType::Texture2D;
+                ptex.desc.width = tex.image.width;
+                ptex.desc.height = tex.image.height;
+                ptex.desc.format = GetTexFormatOfImg(tex.image.format);
+                ptex.desc.usage = gfx::TextureUsage::Sampled;
+
+                std::vector<utils::URaw> layers;
+                layers.push_back(tex.image.bytes); // Shares the decoded pixels
+                ptex.desc.pixelsByLayers = {std::move(layers)};
+
+                gfx::TextureSubDesc subDesc;
+                subDesc.generateMips = true; // TODO: add parameters in desc which affets each texture upload and gives ability to code (or we actually) to modify texture/uniform-props desc per material/material-texture
+                subDesc.mipFilter = gfx::MipmapFilter::Linear;
+                subDesc.minFilter = gfx::TextureFilter::Linear;
+                subDesc.magFilter = gfx::TextureFilter::Linear;
+                ptex.desc.subDesc = std::move(subDesc); // Aniso is picked on the gfx thread, caps live there
+
+                ptex.handle = gbgfx->ReserveTexture();
+                if (ptex.handle.index == UINT32_MAX) {
+                    errors.push_back({"Texture handle pool exhausted at matIdx=" + std::to_string(matIdx) +
+                        " and texIdx=" + std::to_string(texIdx)});
+                    continue;
+                }
+
+                gfx::ResourceHandle texResH(ptex.handle);
+                gfx::Binding texBind;
+                texBind.bindName = GetAssetBindKey(texType);
+                texBind.slot = GetAssetBindSlot(texType);
+                texBind.type = gfx::BindingType::SampledTexture;
+                texBind.resources = {std::vector<gfx::ResourceHandle>{texResH}};
+                texBind.stageMask = gfx::BindingStage_Vertex | gfx::BindingStage_Fragment;
+
+                pmat.bindings.push_back(texBind);
+                pmat.textures.push_back(std::move(ptex));
+            }
+        }
+
+        pending.push_back(std::move(pmat));
+    }
+
+    if (!errors.empty()) {
+        ReleasePending(*gbgfx, pending);
+        ExError error = JoinErrors(errors);
+        return ThreadInvocation<ExResult<AssetGpuMaterials>>(m_Thread, [error]() -> ExResult<AssetGpuMaterials> {
+            return error;
+        });
+    }
+
+    return ThreadInvocation<ExResult<AssetGpuMaterials>>(m_Thread, 
+        [this, pending = std::move(pending)]() -> ExResult<AssetGpuMaterials> {
         auto gbgfx = m_Thread->GetContext();
 
         std::vector<AssetGpuMaterial> materials;
@@ -189,55 +357,21 @@ ThreadInvocation<ExResult<AssetGpuMaterials>> AssetGpu::UploadMaterials(AssetMat
         std::vector<gfx::BufferHandle> localHeldBuffers;
         std::vector<gfx::TextureHandle> localHeldTextures;
         std::vector<gfx::ResourceSetHandle> localHeldResources;
-        
-        for (uint32_t matIdx{0}; matIdx < desc.immutableMaterials.size(); matIdx++) {
-            auto& argMat = desc.immutableMaterials[matIdx];
-            auto& mat = argMat.immutableMaterial;
 
-            std::vector<gfx::Binding> bindings;
-            std::vector<gfx::TextureHandle> textureHandles;
-            gfx::BufferHandle propsUbo;
-
-            if (!mat.imported) {
-                errors.push_back({"Material at matIdx=" + std::to_string(matIdx) + " is not yet imported!"});
-                continue;
-            }
+        for (auto& pmat : pending) {
+            auto matIdx = pmat.matIdx;
 
-            constexpr std::size_t MAT_PROPS_SIZE = sizeof(MaterialProps);
-
-            gfx::BufferDesc propsUboDesc;
-            propsUboDesc.size = MAT_PROPS_SIZE;
-            propsUboDesc.usage = gfx::BufferUsage::Uniform;
-            propsUboDesc.access = gfx::BufferAccess::Dynamic;
-            propsUboDesc.cpuVisible = true;
-
-            auto uboCRes = gbgfx->CreateBuffer(propsUboDesc);
-
-            if (!uboCRes.has_value()) {
-                auto& err = uboCRes.error();
-                errors.push_back(ExError{err.GetCode(), 
+            auto uboCErr = gbgfx->CreateReservedBuffer(pmat.propsUbo, pmat.propsUboDesc);
+            if (uboCErr.IsValid()) {
+                errors.push_back(ExError{uboCErr.GetCode(), 
                     "MaterialProps uniform buffer creation failure at matIdx=" + std::to_string(matIdx) +
-                    " Error=" + std::string(err.GetMessage())
+                    " Error=" + std::string(uboCErr.GetMessage())
                 });
-            } else {
-                propsUbo = uboCRes.value();
-                localHeldBuffers.push_back(propsUbo);
-
-                gfx::ResourceHandle uboResH(propsUbo);
-                gfx::Binding uboBind;
-                uboBind.bindName = AX_BINDING_KEY_MATERIAL_PROPS;
-                uboBind.slot = AX_BINDING_SLOT_MATERIAL_PROPS;
-                uboBind.type = gfx::BindingType::UniformBuffer;
-                uboBind.resources = {std::vector<gfx::ResourceHandle>{uboResH}};
-                uboBind.offset = 0;
-                uboBind.range = 0;
-                uboBind.stageMask = gfx::BindingStage_Vertex | gfx::BindingStage_Fragment;
-
-                bindings.push_back(uboBind);
+                continue;
             }
+            localHeldBuffers.push_back(pmat.propsUbo);
 
-            auto uboUErr = gbgfx->UpdateBuffer(propsUbo, 0, MAT_PROPS_SIZE, &mat.props);
-
+            auto uboUErr = gbgfx->UpdateBuffer(pmat.propsUbo, 0, MAT_PROPS_SIZE, &pmat.props);
             if (uboUErr.IsValid()) {
                 errors.push_back(ExError{uboUErr.GetCode(), 
                     "MaterialProps uniform buffer upload failure at matIdx=" + std::to_string(matIdx) +
@@ -245,64 +379,26 @@ ThreadInvocation<ExResult<AssetGpuMaterials>> AssetGpu::UploadMaterials(AssetMat
                 });
             }
 
-            for (uint32_t i{0}; i < mat.texture_indices.size(); i++) {
-                auto texType = (MaterialTextureType) i;
-                auto& texIndices = mat.texture_indices[i];
-
-                for (auto& texIdx : texIndices) {
-                    auto& tex = desc.immutableImport.textures[texIdx];
-
-                    gfx::TextureDesc texDesc;
-                    texDesc.type = gfx::TextureType::Texture2D;
-                    texDesc.width = tex.image.width;
-                    texDesc.height = tex.image.height;
-                    texDesc.format = GetTexFormatOfImg(tex.image.format);
-                    texDesc.usage = gfx::TextureUsage::Sampled;
-
-                    std::vector<utils::URaw> layers;
-                    layers.push_back(utils::URaw(utils::URawView(tex.image.bytes.data(), tex.image.bytes.size())));
-                    texDesc.pixelsByLayers = {std::move(layers)};
-
-                    gfx::TextureSubDesc subDesc;
-                    if (gbgfx->GetCaps().maxAniso >= 4.0f) {
-                        subDesc.aniso = 4.0f;
-                    }
-                    subDesc.generateMips = true; // TODO: add parameters in desc which affets each texture upload and gives ability to code (or we actually) to modify texture/uniform-props desc per material/material-texture
-                    subDesc.mipFilter = gfx::MipmapFilter::Linear;
-                    subDesc.minFilter = gfx::TextureFilter::Linear;
-                    subDesc.magFilter = gfx::TextureFilter::Linear;
-                    texDesc.subDesc = std::move(subDesc);
-
-                    auto texRes = gbgfx->CreateTexture(texDesc);
-
-                    if (!texRes.has_value()) {
-                        auto& err = texRes.error();
-                        errors.push_back(ExError{err.GetCode(), 
-                            "Texture Upload failure at matIdx=" + std::to_string(matIdx) +
-                            " and texIdx=" + std::to_string(texIdx) + ", Error=" + std::string(err.GetMessage())
-                        });
-                    } else {
-                        auto val = texRes.value();
-
-                        textureHandles.push_back(val);
-                        localHeldTextures.push_back(val);
-
-                        gfx::ResourceHandle texResH(val);
-                        gfx::Binding texBind;
-                        texBind.bindName = GetAssetBindKey(texType);
-                        texBind.slot = GetAssetBindSlot(texType);
-                        texBind.type = gfx::BindingType::SampledTexture;
-                        texBind.resources = {std::vector<gfx::ResourceHandle>{texResH}};
-                        texBind.stageMask = gfx::BindingStage_Vertex | gfx::BindingStage_Fragment;
-
-                        bindings.push_back(texBind);
-                    }
+            for (auto& ptex : pmat.textures) {
+                gfx::TextureDesc texDesc = ptex.desc;
+                if (gbgfx->GetCaps().maxAniso >= 4.0f) {
+                    texDesc.subDesc.aniso = 4.0f;
+                }
+
+                auto texErr = gbgfx->CreateReservedTexture(ptex.handle, texDesc);
+                if (texErr.IsValid()) {
+                    errors.push_back(ExError{texErr.GetCode(), 
+                        "Texture Upload failure at matIdx=" + std::to_string(matIdx) +
+                        " and texIdx=" + std::to_string(ptex.texIdx) + ", Error=" + std::string(texErr.GetMessage())
+                    });
+                } else {
+                    localHeldTextures.push_back(ptex.handle);
                 }
             }
 
             gfx::ResourceSetDesc rDesc;
-            rDesc.setIndex = argMat.resourceSetIndex;
-            rDesc.bindings = {std::move(bindings)};
+            rDesc.setIndex = pmat.resourceSetIndex;
+            rDesc.bindings = {std::vector<gfx::Binding>(pmat.bindings)};
 
             auto resRes = gbgfx->CreateResourceSet(rDesc);
             if (!resRes.has_value()) {
@@ -311,26 +407,13 @@ ThreadInvocation<ExResult<AssetGpuMaterials>> AssetGpu::UploadMaterials(AssetMat
                     "ResourceSet creation failure at matIdx=" + std::to_string(matIdx) +
                     ", Error=" + std::string(err.GetMessage())
                 });
-                
-                for (auto& binding : bindings) {
-                    for (auto& res : binding.resources) {
-                        switch (res.kind) {
-                            case gfx::ResourceKind::Buffer:
-                                gbgfx->DestroyBuffer(res.AsBuffer());
-                            break;
-                            case gfx::ResourceKind::Texture:
-                                gbgfx->DestroyTexture(res.AsTexture());
-                            break;
-                        }
-                    }
-                }
             } else {
                 auto resHandle = resRes.value();
                 localHeldResources.push_back(resHandle);
 
                 AssetGpuMaterial gpuMat;
 
-                gpuMat.bindings = std::move(bindings);
+                gpuMat.bindings = std::vector<gfx::Binding>(pmat.bindings);
                 gpuMat.resourcesHandle = resHandle;
 
                 materials.push_back(gpuMat);
@@ -338,24 +421,12 @@ ThreadInvocation<ExResult<AssetGpuMaterials>> AssetGpu::UploadMaterials(AssetMat
         }
         
         if (!errors.empty()) {
-            for (auto& material : materials) {
-                for (auto& binding : material.bindings) {
-                    for (auto& resource : binding.resources) {
-                        if (binding.type == gfx::BindingType::UniformBuffer || binding.type == gfx::BindingType::StorageBuffer) {
-                            gbgfx->DestroyBuffer(resource.AsBuffer());
-                        } else { // if (binding.type == Texture)
-                            gbgfx->DestroyTexture(resource.AsTexture());
-                        }
-                    }
-                }
-                gbgfx->DestroyResourceSet(material.resourcesHandle);
-            }
-            std::stringstream error_str_stream;
-            for (auto& error : errors) {
-                error_str_stream << "ErrCode=" << error.GetCode() << ", "
-                    << error.GetMessage() << "\n";
-            }
-            return ExError{error_str_stream.str()};
+            // Only what this call created, reservations it never reached are released
+            for (auto& h : localHeldResources) gbgfx->DestroyResourceSet(h);
+            for (auto& h : localHeldTextures) gbgfx->DestroyTexture(h);
+            for (auto& h : localHeldBuffers) gbgfx->DestroyBuffer(h);
+            ReleasePending(*gbgfx, pending);
+            return JoinErrors(errors);
         }
 
         m_HeldBuffers.insert(
@@ -405,7 +476,7 @@ gfx::TextureFormat GetTexFormatOfImg(const gfx::ImageFormat& fmt) {
     }
 }
 
-const char* GetAssetBindKey(const MaterialTextureType& type) {
+utils::NameId GetAssetBindKey(const MaterialTextureType& type) {
     switch (type) {
         case MaterialTextureType_Albedo:            return AX_BINDING_KEY_TEXTURE_BASE_COLOR;
         case MaterialTextureType_Specular:          return AX_BINDING_KEY_TEXTURE_SPECULAR;
@@ -417,7 +488,7 @@ const char* GetAssetBindKey(const MaterialTextureType& type) {
         case MaterialTextureType_AmbientOcclusion:  return AX_BINDING_KEY_TEXTURE_AO;
         case MaterialTextureType_Displacement:      return AX_BINDING_KEY_TEXTURE_DISPLACEMENT;
     }
-    return "";
+    return {};
 }
 
 uint32_t GetAssetBindSlot(const MaterialTextureType& type) {
@@ -0,0 +1,369 @@
+#include "axle/assets/AX_AssetPacker.hpp"
+
+#include "axle/data/AX_CompressedStream.hpp"
+#include "axle/data/AX_DataEndianness.hpp"
+#include "axle/data/AX_DataStreamImplBuffer.hpp"
+#include "axle/data/AX_StreamWriter.hpp"
+
+#include "axle/utils/AX_NameId.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <numeric>
+
+namespace axle::assets
+{
+
+static constexpr uint64_t XXH_PRIME1 = 11400714785074694791ull;
+static constexpr uint64_t XXH_PRIME2 = 14029467366897019727ull;
+static constexpr uint64_t XXH_PRIME3 = 1609587929392839161ull;
+static constexpr uint64_t XXH_PRIME4 = 9650029242287828579ull;
+static constexpr uint64_t XXH_PRIME5 = 2870177450012600261ull;
+
+template <typename T>
+static T LoadLE(const uint8_t* bytes) {
+    T value;
+    std::memcpy(&value, bytes, sizeof(T));
+    data::LE_SwapInPlace(&value, 1);
+    return value;
+}
+
+static uint64_t XXHRound(uint64_t acc, uint64_t input) {
+    acc += input * XXH_PRIME2;
+    return std::rotl(acc, 31) * XXH_PRIME1;
+}
+
+static uint64_t XXHMerge(uint64_t acc, uint64_t value) {
+    acc ^= XXHRound(0, value);
+    return acc * XXH_PRIME1 + XXH_PRIME4;
+}
+
+uint64_t PackChecksum(const void* data, std::size_t size) {
+    auto* p = static_cast<const uint8_t*>(data);
+    const uint8_t* end = p + size;
+    uint64_t h;
+
+    if (size >= 32) {
+        uint64_t v1 = XXH_PRIME1 + XXH_PRIME2, v2 = XXH_PRIME2, v3 = 0, v4 = 0 - XXH_PRIME1;
+        for (; p + 32 <= end; p += 32) {
+            v1 = XXHRound(v1, LoadLE<uint64_t>(p));
+            v2 = XXHRound(v2, LoadLE<uint64_t>(p + 8));
+            v3 = XXHRound(v3, LoadLE<uint64_t>(p + 16));
+            v4 = XXHRound(v4, LoadLE<uint64_t>(p + 24));
+        }
+        h = std::rotl(v1, 1) + std::rotl(v2, 7) + std::rotl(v3, 12) + std::rotl(v4, 18);
+        h = XXHMerge(h, v1);
+        h = XXHMerge(h, v2);
+        h = XXHMerge(h, v3);
+        h = XXHMerge(h, v4);
+    } else {
+        h = XXH_PRIME5;
+    }
+    h += size;
+
+    for (; p + 8 <= end; p += 8) {
+        h ^= XXHRound(0, LoadLE<uint64_t>(p));
+        h = std::rotl(h, 27) * XXH_PRIME1 + XXH_PRIME4;
+    }
+    if (p + 4 <= end) {
+        h ^= uint64_t(LoadLE<uint32_t>(p)) * XXH_PRIME1;
+        h = std::rotl(h, 23) * XXH_PRIME2 + XXH_PRIME3;
+        p += 4;
+    }
+    for (; p < end; p++) {
+        h ^= *p * XXH_PRIME5;
+        h = std::rotl(h, 11) * XXH_PRIME1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_PRIME2;
+    h ^= h >> 29;
+    h *= XXH_PRIME3;
+    h ^= h >> 32;
+    return h;
+}
+
+std::string NormalizePackPath(std::string_view path) {
+    std::string normalized(path);
+    std::replace(normalized.begin(), normalized.end(), '\\', '/');
+    size_t start = normalized.find_first_not_of('/');
+    return start == std::string::npos ? std::string{} : normalized.substr(start);
+}
+
+static uint64_t AlignPack(uint64_t value) {
+    return (value + PACK_ALIGNMENT - 1) & ~(PACK_ALIGNMENT - 1);
+}
+
+template <typename... T>
+static void SwapFields(T&... fields) {
+    (data::LE_SwapInPlace(&fields, 1), ...);
+}
+
+static void SwapHeader(AssetPackHeader& h) {
+    SwapFields(h.version, h.entryCount, h.tocOffset, h.namesOffset, h.namesSize, h.dataOffset, h.tocChecksum, h.reserved);
+}
+
+static void SwapEntry(AssetPackEntry& e) {
+    SwapFields(e.pathHash, e.offset, e.size, e.rawSize, e.checksum, e.pathOffset, e.pathLength, e.compression, e.flags, e.reserved);
+}
+
+// Whole blob as one compressed stream; stored blocks cap it at the raw size plus the index and footer
+static utils::ExResult<utils::URaw> CompressBlob(const utils::URaw& bytes, data::CompressionCodec codec) {
+    data::CompressedWriteDesc desc{codec};
+    uint64_t blocks = (bytes.size() + desc.blockSize - 1) / desc.blockSize;
+    std::vector<uint8_t> stored(bytes.size() + blocks * sizeof(data::CompressedBlockInfo) + sizeof(data::CompressedStreamFooter));
+
+    data::BufferDataStream out(utils::URawView(stored.data(), stored.size()));
+    AX_PROPAGATE_ERROR(out.Open());
+    data::CompressedWriteStream stream(out, desc);
+    AX_PROPAGATE_ERROR(stream.Open());
+    AX_PROPAGATE_RESULT_ERROR(stream.Write(bytes.data(), bytes.size()));
+    AX_PROPAGATE_ERROR(stream.Finish());
+
+    stored.resize(stream.GetStoredSize());
+    return utils::URaw(std::move(stored));
+}
+
+utils::ExError AssetPacker::Add(std::string_view path, utils::URaw bytes, PackCompression compression) {
+    std::string normalized = NormalizePackPath(path);
+    if (normalized.empty()) return {"Empty pack path"};
+    if (m_Paths.contains(normalized)) return {"Duplicate pack path: " + normalized};
+
+    uint64_t rawSize = bytes.size();
+    if (compression != PackCompression::None) {
+        auto codec = static_cast<data::CompressionCodec>(compression);
+        if (compression > PackCompression::Zstd || !data::IsCodecAvailable(codec)) return {"Unsupported pack compression"};
+        auto compressed = CompressBlob(bytes, codec);
+        if (!compressed.has_value()) return compressed.error();
+        if (compressed.value().size() < bytes.size()) bytes = std::move(compressed.value());
+        else compression = PackCompression::None; // Already compressed data (PNG, JPEG, ...) gains nothing
+    }
+
+    uint64_t checksum = PackChecksum(bytes.data(), bytes.size());
+    m_Paths.insert(normalized);
+    m_Entries.push_back({std::move(normalized), std::move(bytes), rawSize, checksum, compression});
+    return utils::ExError::NoError();
+}
+
+utils::ExError AssetPacker::AddFile(std::string_view path, const std::filesystem::path& file, PackCompression compression) {
+    data::MMapDataStream stream(file, data::MMapAdvice::Sequential);
+    AX_PROPAGATE_ERROR(stream.Open());
+    return Add(path, stream.Share(0, stream.GetLength()), compression);
+}
+
+utils::ExError AssetPacker::AddDirectory(const std::filesystem::path& dir, std::string_view prefix, PackCompression compression) {
+    std::error_code err;
+    std::vector<std::filesystem::path> files;
+    for (std::filesystem::recursive_directory_iterator it(dir, err), end; !err && it != end; it.increment(err)) {
+        if (it->is_regular_file(err)) files.push_back(it->path());
+    }
+    if (err) return {err.value(), "Failed to list directory: \"" + dir.string() + "\" Error: " + err.message()};
+
+    std::sort(files.begin(), files.end()); // Deterministic packs regardless of directory order
+    std::string base = prefix.empty() ? std::string{} : NormalizePackPath(prefix) + "/";
+    for (const auto& file : files) {
+        AX_PROPAGATE_ERROR(AddFile(base + std::filesystem::relative(file, dir).generic_string(), file, compression));
+    }
+    return utils::ExError::NoError();
+}
+
+std::vector<uint32_t> AssetPacker::SortEntries(std::vector<uint64_t>& hashes) const {
+    std::vector<uint32_t> order(m_Entries.size());
+    hashes.resize(m_Entries.size());
+    for (size_t i{0}; i < m_Entries.size(); i++) hashes[i] = utils::NameHash(m_Entries[i].path);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](uint32_t a, uint32_t b) {
+        if (hashes[a] != hashes[b]) return hashes[a] < hashes[b];
+        return m_Entries[a].path < m_Entries[b].path;
+    });
+    return order;
+}
+
+uint64_t AssetPacker::GetPackSize() const {
+    std::vector<uint64_t> hashes;
+    uint64_t namesSize{0};
+    for (const auto& entry : m_Entries) namesSize += entry.path.size();
+
+    // Padding depends on the order blobs are written in
+    uint64_t end = AlignPack(sizeof(AssetPackHeader) + m_Entries.size() * sizeof(AssetPackEntry) + namesSize);
+    for (uint32_t idx : SortEntries(hashes)) end = AlignPack(end) + m_Entries[idx].bytes.size();
+    return end;
+}
+
+utils::ExError AssetPacker::Write(data::IDataStream& out) const {
+    std::vector<uint64_t> hashes;
+    std::vector<uint32_t> order = SortEntries(hashes);
+
+    // Entry table and path strings are laid out together, the checksum covers both
+    uint64_t tocSize = m_Entries.size() * sizeof(AssetPackEntry);
+    std::vector<uint8_t> toc(tocSize);
+    std::string names;
+
+    AssetPackHeader header{};
+    std::memcpy(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC));
+    header.version = PACK_VERSION;
+    header.entryCount = uint32_t(m_Entries.size());
+    header.tocOffset = sizeof(AssetPackHeader);
+    header.namesOffset = header.tocOffset + tocSize;
+    for (const auto& entry : m_Entries) header.namesSize += entry.path.size();
+    if (header.namesSize > UINT32_MAX) return {"Pack path strings exceed 4 GiB"};
+    header.dataOffset = AlignPack(header.namesOffset + header.namesSize);
+
+    uint64_t offset = header.dataOffset;
+    for (size_t i{0}; i < order.size(); i++) {
+        const auto& pending = m_Entries[order[i]];
+        AssetPackEntry entry{};
+        entry.pathHash = hashes[order[i]];
+        entry.offset = offset;
+        entry.size = pending.bytes.size();
+        entry.rawSize = pending.rawSize;
+        entry.checksum = pending.checksum;
+        entry.pathOffset = uint32_t(names.size());
+        entry.pathLength = uint32_t(pending.path.size());
+        entry.compression = uint32_t(pending.compression);
+        SwapEntry(entry);
+        std::memcpy(toc.data() + i * sizeof(AssetPackEntry), &entry, sizeof(AssetPackEntry));
+
+        names += pending.path;
+        offset = AlignPack(offset + pending.bytes.size());
+    }
+    toc.insert(toc.end(), names.begin(), names.end());
+    header.tocChecksum = PackChecksum(toc.data(), toc.size());
+    SwapHeader(header);
+
+    static constexpr uint8_t ZEROS[PACK_ALIGNMENT]{};
+    data::StreamWriter writer(out);
+    AX_PROPAGATE_ERROR(writer.WriteBytes(&header, sizeof(header)));
+    AX_PROPAGATE_ERROR(writer.WriteBytes(toc.data(), toc.size()));
+
+    uint64_t written = sizeof(header) + toc.size();
+    for (uint32_t idx : order) {
+        const auto& bytes = m_Entries[idx].bytes;
+        AX_PROPAGATE_ERROR(writer.WriteBytes(ZEROS, AlignPack(written) - written));
+        AX_PROPAGATE_ERROR(writer.WriteBytes(bytes.data(), bytes.size()));
+        written = AlignPack(written) + bytes.size();
+    }
+    return writer.Flush();
+}
+
+AssetPack::AssetPack(const std::filesystem::path& path, data::MMapAdvice advice)
+    : m_Path(path), m_Advice(advice) {}
+
+AssetPack::AssetPack(utils::URaw bytes) : m_Bytes(std::move(bytes)) {}
+
+utils::ExError AssetPack::Open() {
+    if (!m_Path.empty()) {
+        auto stream = std::make_unique<data::MMapDataStream>(m_Path, m_Advice);
+        AX_PROPAGATE_ERROR(stream->Open());
+        m_Bytes = stream->Share(0, stream->GetLength());
+        m_Stream = std::move(stream);
+    }
+    AX_PROPAGATE_ERROR(Parse());
+    m_Opened = true;
+    return utils::ExError::NoError();
+}
+
+utils::ExError AssetPack::Parse() {
+    const uint8_t* base = m_Bytes.data();
+    uint64_t size = m_Bytes.size();
+    if (size < sizeof(AssetPackHeader)) return {"Not an axpak: file too small"};
+
+    AssetPackHeader header;
+    std::memcpy(&header, base, sizeof(header));
+    SwapHeader(header);
+    if (std::memcmp(header.magic, PACK_MAGIC, sizeof(PACK_MAGIC)) != 0) return {"Not an axpak: bad magic"};
+    if (header.version != PACK_VERSION) return {"Unsupported axpak version " + std::to_string(header.version)};
+
+    uint64_t tocSize = uint64_t(header.entryCount) * sizeof(AssetPackEntry);
+    if (header.tocOffset % alignof(AssetPackEntry) != 0 ||
+        header.tocOffset > size || tocSize > size - header.tocOffset ||
+        header.namesOffset != header.tocOffset + tocSize ||
+        header.namesSize > size - header.namesOffset) {
+        return {"Corrupt axpak: table of contents out of range"};
+    }
+    if (PackChecksum(base + header.tocOffset, tocSize + header.namesSize) != header.tocChecksum) {
+        return {"Corrupt axpak: table of contents checksum mismatch"};
+    }
+
+    const uint8_t* toc = base + header.tocOffset;
+    if constexpr (std::endian::native == std::endian::little) {
+        if (reinterpret_cast<uintptr_t>(toc) % alignof(AssetPackEntry) == 0) {
+            m_Entries = {reinterpret_cast<const AssetPackEntry*>(toc), header.entryCount};
+        }
+    }
+    if (m_Entries.size() != header.entryCount) { // Big-endian host or unaligned storage
+        m_SwappedEntries.resize(header.entryCount);
+        std::memcpy(m_SwappedEntries.data(), toc, tocSize);
+        for (auto& entry : m_SwappedEntries) SwapEntry(entry);
+        m_Entries = {m_SwappedEntries.data(), m_SwappedEntries.size()};
+    }
+    m_Names = reinterpret_cast<const char*>(base + header.namesOffset);
+    m_NamesSize = header.namesSize;
+
+    for (const auto& entry : m_Entries) {
+        if (entry.offset > size || entry.size > size - entry.offset ||
+            uint64_t(entry.pathOffset) + entry.pathLength > m_NamesSize) {
+            return {"Corrupt axpak: entry out of range"};
+        }
+    }
+    return utils::ExError::NoError();
+}
+
+std::string_view AssetPack::GetPath(const AssetPackEntry& entry) const {
+    return {m_Names + entry.pathOffset, entry.pathLength};
+}
+
+const AssetPackEntry* AssetPack::Find(std::string_view path) const {
+    uint64_t hash = utils::NameHash(path);
+    auto it = std::lower_bound(m_Entries.begin(), m_Entries.end(), hash, [](const AssetPackEntry& entry, uint64_t h) {
+        return entry.pathHash < h;
+    });
+    for (; it != m_Entries.end() && it->pathHash == hash; ++it) {
+        if (GetPath(*it) == path) return &*it;
+    }
+    return nullptr;
+}
+
+utils::ExError AssetPack::Prefetch(const AssetPackEntry& entry) const {
+    if (!m_Opened) return {"Pack is not open"};
+    if (!m_Stream || entry.size == 0) return utils::ExError::NoError();
+    return m_Stream->Advise(data::MMapAdvice::WillNeed, entry.offset, entry.size);
+}
+
+utils::ExResult<utils::Span<const uint8_t>> AssetPack::View(const AssetPackEntry& entry) const {
+    if (!m_Opened) return utils::ExError{"Pack is not open"};
+    if (entry.compression != uint32_t(PackCompression::None)) return utils::ExError{"Entry is compressed, use Load()"};
+    Prefetch(entry); // Only a hint, faulting the pages in still works without it
+    return utils::Span<const uint8_t>(m_Bytes.data() + entry.offset, entry.size);
+}
+
+utils::ExResult<utils::URaw> AssetPack::Load(const AssetPackEntry& entry) const {
+    if (!m_Opened) return utils::ExError{"Pack is not open"};
+    Prefetch(entry);
+    if (entry.compression == uint32_t(PackCompression::None)) return m_Bytes.Slice(entry.offset, entry.size);
+    if (entry.compression > uint32_t(PackCompression::Zstd)) return utils::ExError{"Unsupported pack compression"};
+    AX_PROPAGATE_ERROR(Verify(entry)); // Decoders should only ever see the bytes that were packed
+
+    // The stream is only read from, the pack's storage may be a read-only mapping
+    data::BufferDataStream stored(utils::URawView(const_cast<uint8_t*>(m_Bytes.data()) + entry.offset, entry.size));
+    AX_PROPAGATE_ERROR(stored.Open());
+    data::CompressedReadStream stream(stored);
+    AX_PROPAGATE_ERROR(stream.Open());
+    if (stream.GetLength() != entry.rawSize) return utils::ExError{"Compressed entry has the wrong size: " + std::string(GetPath(entry))};
+
+    std::vector<uint8_t> raw(entry.rawSize);
+    AX_DECL_OR_PROPAGATE(read, stream.Read(raw.data(), raw.size()));
+    if (read != raw.size()) return utils::ExError{-5, "Unexpected EOF"};
+    return utils::URaw(std::move(raw));
+}
+
+utils::ExError AssetPack::Verify(const AssetPackEntry& entry) const {
+    if (!m_Opened) return {"Pack is not open"};
+    if (PackChecksum(m_Bytes.data() + entry.offset, entry.size) != entry.checksum) {
+        return {"Checksum mismatch: " + std::string(GetPath(entry))};
+    }
+    return utils::ExError::NoError();
+}
+
+}
@@ -1,17 +1,59 @@
 #include "axle/assets/AX_AssetSTLAssimpFileImporter.hpp"
 #include "axle/assets/AX_AssetAssimpDefs.hpp"
 
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/core/concurrency/AX_Task.hpp"
+#include "axle/core/profile/AX_Profiler.hpp"
+
+#include "axle/data/AX_AsyncIO.hpp"
+
 #include "axle/utils/AX_Universal.hpp"
 
 #include <iostream>
+#include <latch>
 
 namespace axle::assets
 {
 
+static constexpr std::pair<MaterialTextureType, aiTextureType> MAPPED_TEXTURE_TYPES[] = {
+    {MaterialTextureType_Albedo, aiTextureType_DIFFUSE},
+    {MaterialTextureType_Specular, aiTextureType_SPECULAR},
+    {MaterialTextureType_NormalMap, aiTextureType_NORMALS},
+    {MaterialTextureType_HeightMap, aiTextureType_HEIGHT},
+    {MaterialTextureType_Roughness, aiTextureType_DIFFUSE_ROUGHNESS},
+    {MaterialTextureType_Metallic, aiTextureType_METALNESS},
+    {MaterialTextureType_Emissive, aiTextureType_EMISSIVE},
+    {MaterialTextureType_AmbientOcclusion, aiTextureType_AMBIENT_OCCLUSION},
+    {MaterialTextureType_Displacement, aiTextureType_DISPLACEMENT}
+};
+
+static const aiTexture* FindEmbeddedTexture(const aiScene* scene, const aiString& path) {
+    if (path.length > 1 && path.data[0] == '*') { // Referencing an embedded texture via scene->mTextures
+        return scene->mTextures[std::atoi(&path.data[1])];
+    }
+    return scene->GetEmbeddedTexture(path.C_Str()); // Referencing an embedded texture via path
+}
+
+// Decodes an external texture as a continuation of its read, so no job worker sits in IOFuture::Get()
+static Task<void> DecodeWhenRead(data::IOFuture<utils::URaw> read, utils::ExResult<gfx::Image>& out, std::latch& done) {
+    auto bytes = co_await read;
+    co_await core::JobSystem::Global().Schedule(); // ThreadPool reads resume on their I/O worker
+    if (bytes.has_value()) {
+        out = gfx::Img_Auto_LoadFileBytes(bytes.value().Get());
+    } else {
+        out = bytes.error();
+    }
+    done.count_down();
+}
+
 AssetSTLAssimpFileImporter::AssetSTLAssimpFileImporter(const AssetImportDesc& desc, const std::filesystem::path& path)
     : IAssetImporter(desc), m_Path(path) {}
 
 utils::ExResult<AssetImportResult> AssetSTLAssimpFileImporter::Import() {
+    AX_PROFILE_SCOPE("AssetSTLAssimpFileImporter::Import");
+    AX_ALLOC_TAG(Assets);
+
     Assimp::Importer importer;
 
     auto flags = aiProcess_Triangulate |
@@ -23,30 +65,90 @@ utils::ExResult<AssetImportResult> AssetSTLAssimpFileImporter::Import() {
         flags |= aiProcess_CalcTangentSpace;
     }
 
-    const aiScene* scene = importer.ReadFile(m_Path.string(), flags);
+    const aiScene* scene{nullptr};
+    {
+        AX_PROFILE_SCOPE("Assimp::ReadFile");
+        scene = importer.ReadFile(m_Path.string(), flags);
+    }
 
     if (!scene || !scene->mRootNode)
         return utils::ExError("Assimp failed to load scene");
 
     AssetImportResult result;
 
-    std::vector<AssetTexture> asset_texs;
+    auto& jobs = core::JobSystem::Global();
+
+    // External texture files are read in one AsyncIO batch up front and each one is decoded on a job worker as
+    // soon as its bytes land; only this thread waits, before the materials pick the images up
+    std::unordered_map<std::string, utils::ExResult<gfx::Image>> prefetched;
+    {
+        std::vector<std::string> names;
+        std::vector<std::filesystem::path> paths;
+        aiString path;
+        for (uint32_t matIdx{0}; matIdx < scene->mNumMaterials; matIdx++) {
+            const aiMaterial* material = scene->mMaterials[matIdx];
+            for (auto [axType, type] : MAPPED_TEXTURE_TYPES) {
+                for (uint32_t i{0}; i < material->GetTextureCount(type); i++) {
+                    if (material->GetTexture(type, i, &path) != AI_SUCCESS || FindEmbeddedTexture(scene, path)) continue;
+                    if (!prefetched.emplace(path.C_Str(), utils::ExError{"Texture was not prefetched"}).second) continue;
+                    names.emplace_back(path.C_Str());
+                    paths.push_back(m_Path.parent_path() / path.C_Str());
+                }
+            }
+        }
+        auto reads = data::AsyncIO::Global().ReadFiles({paths.data(), paths.size()});
+
+        // The map is complete, its values stay put while the decodes write them
+        std::latch decoded(static_cast<std::ptrdiff_t>(names.size()));
+        for (size_t i{0}; i < names.size(); i++) {
+            core::Spawn(DecodeWhenRead(std::move(reads[i]), prefetched.at(names[i]), decoded));
+        }
+        decoded.wait();
+    }
+
+    // Materials build independently (only embedded textures still decode there), ids stay material-local until merged below
+    std::vector<std::vector<AssetTexture>> mat_texs(scene->mNumMaterials);
+    std::vector<utils::ExError> mat_errs(scene->mNumMaterials, utils::ExError::NoError());
     result.materials = {std::vector<AssetMaterial>(scene->mNumMaterials)};
-    for (uint32_t matIdx{0}; matIdx < scene->mNumMaterials; matIdx++) {
-        auto err = ProcessMaterial({scene, result, matIdx, asset_texs});
+    jobs.ParallelFor(scene->mNumMaterials, [&](uint32_t begin, uint32_t end) {
+        for (uint32_t matIdx{begin}; matIdx < end; matIdx++) {
+            mat_errs[matIdx] = ProcessMaterial({scene, result, matIdx, mat_texs[matIdx], prefetched});
+        }
+    }, 1);
+    for (auto& err : mat_errs) {
         if (err.IsValid()) return err;
     }
+
+    std::vector<AssetTexture> asset_texs;
+    for (uint32_t matIdx{0}; matIdx < scene->mNumMaterials; matIdx++) {
+        auto offset = static_cast<int32_t>(asset_texs.size());
+        for (auto& indices : result.materials[matIdx].texture_indices) {
+            for (auto& texIdx : indices) texIdx += offset;
+        }
+        for (auto& tex : mat_texs[matIdx]) {
+            tex.id += offset;
+            asset_texs.push_back(std::move(tex));
+        }
+    }
     result.textures = {std::move(asset_texs)};
 
     Node root;
     root.name = "ROOT";
 
     uint32_t meshIdx{0}, buffIdx{0}, nodeIdx{0};
+    std::vector<AssimpMeshProcessParams> meshJobs;
     result.meshes = {std::vector<AssetMesh>(scene->mNumMeshes)};
     result.buffers = {std::vector<AssetBuffer>(2 * scene->mNumMeshes)};
-    ProcessNode({scene->mRootNode, scene, root, result, meshIdx, buffIdx, nodeIdx});
+    ProcessNode({scene->mRootNode, scene, root, result, meshIdx, buffIdx, nodeIdx, meshJobs});
     result.nodes = {std::vector<Node>{root}};
 
+    // Slots were assigned during traversal, each mesh writes only its own entries
+    jobs.ParallelFor(static_cast<uint32_t>(meshJobs.size()), [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i{begin}; i < end; i++) {
+            ProcessMesh(meshJobs[i]);
+        }
+    }, 1);
+
     return result;
 }
 
@@ -66,12 +168,14 @@ void AssetSTLAssimpFileImporter::ProcessNode(const AssimpNodeProcessParams& para
     outNode.transform = utils::Coordination{utils::Assimp_ToGLM(node->mTransformation)};
 
     for (uint32_t i = 0; i < node->mNumMeshes; ++i) {
-        ProcessMesh({scene->mMeshes[node->mMeshes[i]], result, meshIdx, buffIdx});
-        outNode.meshIds.push_back(meshIdx);
+        uint32_t slot{meshIdx++};
+        params.meshJobs.push_back({scene->mMeshes[node->mMeshes[i]], result, slot, buffIdx});
+        buffIdx += 2;
+        outNode.meshIds.push_back(slot);
     }
     for (uint32_t i = 0; i < node->mNumChildren; ++i) {
         Node child;
-        ProcessNode({node->mChildren[i], scene, child, result, meshIdx, buffIdx, nodeIdx});
+        ProcessNode({node->mChildren[i], scene, child, result, meshIdx, buffIdx, nodeIdx, params.meshJobs});
         outNode.children.push_back(std::move(child));
     }
 }
@@ -84,21 +188,23 @@ uint32_t GetMeshUvCount(const aiMesh* mesh) {
 }
 
 void AssetSTLAssimpFileImporter::ProcessMesh(const AssimpMeshProcessParams& params) {
+    AX_PROFILE_SCOPE("AssetSTLAssimpFileImporter::ProcessMesh");
+    AX_ALLOC_TAG(Assets); // Runs on job workers
     const auto* mesh = params.mesh;
 
-    auto& buffIdx = params.buffIdx;
-    auto& meshIdx = params.meshIdx;
+    auto buffIdx = params.buffIdx;
+    auto meshIdx = params.meshIdx;
 
     auto& result = params.result;
 
-    std::vector<uint8_t> vertexBuffer;
+    std::pmr::vector<uint8_t> vertexBuffer(GetBufferResource());
     auto fmt = GetVertexFormat(GetMeshUvCount(mesh), HasFlag(AssetImportFlag::CalcTangents));
     auto fmtDesc = GetVertexFormatDesc(fmt);
     auto vtSize = sizeof(float) * ((fmtDesc.hasTangents ? 6 : 0) + fmtDesc.uvCount * 2 + 6) * mesh->mNumVertices;
     vertexBuffer.reserve(vtSize);
     vertexBuffer.resize(vtSize);
 
-    std::vector<uint8_t> indexBuffer;
+    std::pmr::vector<uint8_t> indexBuffer(GetBufferResource());
     auto idxCount{0u};
     for (uint32_t i{0}; i < mesh->mNumFaces; i++) {
         idxCount += mesh->mFaces[i].mNumIndices;
@@ -164,7 +270,7 @@ void AssetSTLAssimpFileImporter::ProcessMesh(const AssimpMeshProcessParams& para
     indexBuf.count = idxCount;
     indexBuf.raw = {std::move(indexBuffer)};
 
-    uint32_t vertBuffIdx{buffIdx++}, idxBuffIdx{buffIdx++};
+    uint32_t vertBuffIdx{buffIdx}, idxBuffIdx{buffIdx + 1};
 
     result.buffers[vertBuffIdx] = {std::move(vertexBuf)};
     result.buffers[idxBuffIdx] = {std::move(indexBuf)};
@@ -176,7 +282,7 @@ void AssetSTLAssimpFileImporter::ProcessMesh(const AssimpMeshProcessParams& para
     assetMesh.vertexFormat = fmt;
     // TODO: Research: about how to get mesh parts, we need it for multi-stage rendering and world geometry
 
-    result.meshes[meshIdx++] = std::move(assetMesh);
+    result.meshes[meshIdx] = std::move(assetMesh);
 }
 
 glm::vec4 GetMemberColor(
@@ -197,20 +303,24 @@ glm::vec4 GetMemberColor(
     return color;
 }
 
-void SwapAssimp_BGRA8888_To_RGBA8888(const aiTexture* assimp_tex) {
+// Copies instead of swapping in place, embedded textures may be shared between materials processed concurrently
+void CopyAssimp_BGRA8888_To_RGBA8888(const aiTexture* assimp_tex, uint8_t* dst) {
     auto width = assimp_tex->mWidth;
     auto height = assimp_tex->mHeight;
 
     for (uint32_t i{0}; i < width * height; i++) {
-        aiTexel& texel = assimp_tex->pcData[i];
-        aiTexel temp = texel;
+        const aiTexel& texel = assimp_tex->pcData[i];
 
-        texel.b = temp.r;
-        texel.r = temp.b;
+        dst[i * 4 + 0] = texel.r;
+        dst[i * 4 + 1] = texel.g;
+        dst[i * 4 + 2] = texel.b;
+        dst[i * 4 + 3] = texel.a;
     }
 }
 
 utils::ExError AssetSTLAssimpFileImporter::ProcessMaterial(const AssimpMaterialProcessParams& params) {
+    AX_PROFILE_SCOPE("AssetSTLAssimpFileImporter::ProcessMaterial");
+    AX_ALLOC_TAG(Assets);
     const auto* scene = params.scene;
 
     auto& asset_texs = params.asset_texs;
@@ -290,13 +400,7 @@ utils::ExError AssetSTLAssimpFileImporter::ProcessMaterial(const AssimpMaterialP
                 tex_indices.push_back(0);
                 continue;
             }
-            const aiTexture* assimp_tex{nullptr};
-
-            if (path.length > 1 && path.data[0] == '*') { // Referencing an embedded texture via scene->mTextures
-                assimp_tex = scene->mTextures[std::atoi(&path.data[1])];
-            } else { // Referencing an embedded texture via path
-                assimp_tex = scene->GetEmbeddedTexture(path.C_Str());
-            }
+            const aiTexture* assimp_tex = FindEmbeddedTexture(scene, path);
             
             auto& asset_tex = asset_texs.emplace_back();
             uint32_t asset_tex_id = asset_texs.size() - 1;
@@ -322,26 +426,25 @@ utils::ExError AssetSTLAssimpFileImporter::ProcessMaterial(const AssimpMaterialP
                     image.bytes = {std::vector<uint8_t>(4 * width * height)};
 
                     // Swap channels R <=> B
-                    SwapAssimp_BGRA8888_To_RGBA8888(assimp_tex);
-                    std::memcpy(image.bytes.data(), assimp_tex->pcData, image.bytes.size());
+                    CopyAssimp_BGRA8888_To_RGBA8888(assimp_tex, image.bytes.data());
                 }
-            } else { // Texture is NOT embedded, we should look into filesystem
-                AX_DECL_OR_PROPAGATE(img, gfx::Img_Auto_LoadFile({m_Path.parent_path() / path.C_Str()}));
-                asset_tex.image = std::move(img);
+            } else { // Texture is NOT embedded, its bytes were prefetched from the filesystem
+                utils::ExResult<gfx::Image> img = utils::ExError{"Texture was not prefetched"};
+                auto it = params.prefetched.find(path.C_Str());
+                if (it != params.prefetched.end()) img = it->second; // Shares the decoded pixels
+                if (!img.has_value()) { // Retry through the file loaders, which also see the extension
+                    img = gfx::Img_Auto_LoadFile({m_Path.parent_path() / path.C_Str()});
+                }
+                AX_DECL_OR_PROPAGATE(loaded, std::move(img));
+                asset_tex.image = std::move(loaded);
             }
         }
         return utils::ExError::NoError();
     };
 
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Albedo, aiTextureType_DIFFUSE));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Specular, aiTextureType_SPECULAR));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_NormalMap, aiTextureType_NORMALS));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_HeightMap, aiTextureType_HEIGHT));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Roughness, aiTextureType_DIFFUSE_ROUGHNESS));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Metallic, aiTextureType_METALNESS));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Emissive, aiTextureType_EMISSIVE));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_AmbientOcclusion, aiTextureType_AMBIENT_OCCLUSION));
-    AX_PROPAGATE_ERROR(MapTexture(MaterialTextureType_Displacement, aiTextureType_DISPLACEMENT));
+    for (auto [axType, type] : MAPPED_TEXTURE_TYPES) {
+        AX_PROPAGATE_ERROR(MapTexture(axType, type));
+    }
 
     mat.imported = true;
     result.materials[matIdx] = mat;
@@ -1,6 +1,8 @@
 #include "axle/audio/data/AX_AudioOGG.hpp"
 
-#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/data/AX_DataStreamImplMMap.hpp"
 #include "axle/data/AX_DataStreamImplBuffer.hpp"
 
 #define STB_VORBIS_HEADER_ONLY
@@ -13,13 +15,12 @@
 namespace axle::audio {
 
 utils::ExResult<OGGAudio> OGG_LoadFileBytes(data::IDataStream& buffer) {
+    AX_ALLOC_TAG(Audio);
     size_t len = buffer.GetLength();
 
     if (len < 4) {
         return utils::ExError{"Invalid Ogg file format"};
     }
-    std::vector<uint8_t> fileData(len);
-
     char magic[4];
     AX_PROPAGATE_RESULT_ERROR(buffer.Read(magic, 4));
     if (std::strncmp(magic, "OggS", 4) != 0) {
@@ -28,7 +29,7 @@ utils::ExResult<OGGAudio> OGG_LoadFileBytes(data::IDataStream& buffer) {
 
     size_t originalPos = buffer.GetReadIndex();
     AX_PROPAGATE_ERROR(buffer.SeekRead(0));
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(fileData.data(), len));
+    AX_DECL_OR_PROPAGATE(fileData, buffer.ReadShared(len)); // Shares the mapping when loaded from a file
     AX_PROPAGATE_ERROR(buffer.SeekRead(originalPos)); // Restore pos
 
     int error;
@@ -53,7 +54,7 @@ utils::ExResult<OGGAudio> OGG_LoadFileBytes(utils::Span<uint8_t> bufferView) {
 }
 
 utils::ExResult<OGGAudio> OGG_LoadFile(const std::filesystem::path& path) {
-    auto stream = std::make_shared<data::FileDataStream>(path, true, false);
+    auto stream = std::make_shared<data::MMapDataStream>(path, data::MMapAdvice::Sequential);
     AX_PROPAGATE_ERROR(stream->Open());
     return OGG_LoadFileBytes(*stream);
 }
@@ -1,8 +1,10 @@
 #include "axle/audio/data/AX_AudioWAV.hpp"
 
-#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include "axle/data/AX_DataStreamImplMMap.hpp"
 #include "axle/data/AX_DataStreamImplBuffer.hpp"
-#include "axle/data/AX_DataEndianness.hpp"
+#include "axle/data/AX_StreamReader.hpp"
 
 #include <cstdint>
 #include <cstring>
@@ -10,54 +12,59 @@
 namespace axle::audio {
 
 utils::ExResult<WAVAudio> WAV_LoadFileBytes(data::IDataStream& buffer) {
+    AX_ALLOC_TAG(Audio);
     if (buffer.GetLength() < 12) {
         return utils::ExError{"Invalid WAV file format"};
     }
 
-    char riff[4], wave[4];
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read((uint8_t*) riff, 4));
-    AX_PROPAGATE_ERROR(buffer.SkipRead(4));
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read((uint8_t*) wave, 4));
-    if (std::strncmp(riff, "RIFF", 4) != 0 ||
-        std::strncmp(wave, "WAVE", 4) != 0) {
-        AX_PROPAGATE_ERROR(buffer.SkipRead(-12));
-        return utils::ExError{"Invalid WAV file format"};
-    }
-    AX_PROPAGATE_ERROR(buffer.SkipRead(-12));
-
+    auto start = buffer.GetReadIndex();
     WAVAudio wav;
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(wav.header.riff, 4));
-    AX_PROPAGATE_ERROR(buffer.SkipRead(4));
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(wav.header.wave, 4));
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(wav.header.fmt, 4));
-    AX_PROPAGATE_ERROR(buffer.SkipRead(4));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint16_t>(buffer, &wav.header.audioFormat));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint16_t>(buffer, &wav.header.numChannels));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint32_t>(buffer, &wav.header.sampleRate));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint32_t>(buffer, &wav.header.byteRate));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint16_t>(buffer, &wav.header.blockAlign));
-    AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint16_t>(buffer, &wav.header.bitsPerSample));
+    {
+        // Header fields come out of one buffered window instead of a virtual Read each
+        data::StreamReader reader(buffer);
+        AX_PROPAGATE_ERROR(reader.ReadBytes(wav.header.riff, 4));
+        AX_PROPAGATE_ERROR(reader.Skip(4));
+        AX_PROPAGATE_ERROR(reader.ReadBytes(wav.header.wave, 4));
+        if (std::strncmp(wav.header.riff, "RIFF", 4) != 0 ||
+            std::strncmp(wav.header.wave, "WAVE", 4) != 0) {
+            AX_PROPAGATE_ERROR(reader.Seek(start));
+            return utils::ExError{"Invalid WAV file format"};
+        }
 
-    char dataHeader[4];
-    uint32_t dataSize;
-    do {
-        AX_PROPAGATE_RESULT_ERROR(buffer.Read(dataHeader, 4));
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<uint32_t>(buffer, &dataSize));
-        
-        if (std::string(dataHeader, 4) != "data") {
-            buffer.SkipRead(dataSize);
+        uint32_t fmtSize{0};
+        AX_PROPAGATE_ERROR(reader.ReadBytes(wav.header.fmt, 4));
+        AX_SET_OR_PROPAGATE(fmtSize, reader.ReadLE<uint32_t>());
+        AX_SET_OR_PROPAGATE(wav.header.audioFormat, reader.ReadLE<uint16_t>());
+        AX_SET_OR_PROPAGATE(wav.header.numChannels, reader.ReadLE<uint16_t>());
+        AX_SET_OR_PROPAGATE(wav.header.sampleRate, reader.ReadLE<uint32_t>());
+        AX_SET_OR_PROPAGATE(wav.header.byteRate, reader.ReadLE<uint32_t>());
+        AX_SET_OR_PROPAGATE(wav.header.blockAlign, reader.ReadLE<uint16_t>());
+        AX_SET_OR_PROPAGATE(wav.header.bitsPerSample, reader.ReadLE<uint16_t>());
+        if (fmtSize > 16) {
+            AX_PROPAGATE_ERROR(reader.Skip(fmtSize - 16)); // Extensible format fields
         }
-    } while (std::string(dataHeader,4) != "data");
+
+        do {
+            AX_PROPAGATE_ERROR(reader.ReadBytes(wav.header.dataHeader, 4));
+            AX_SET_OR_PROPAGATE(wav.header.dataSize, reader.ReadLE<uint32_t>());
+
+            if (std::strncmp(wav.header.dataHeader, "data", 4) != 0) {
+                AX_PROPAGATE_ERROR(reader.Skip(wav.header.dataSize));
+            }
+        } while (std::strncmp(wav.header.dataHeader, "data", 4) != 0);
+    } // The reader leaves the stream at the first sample
+    uint32_t dataSize = wav.header.dataSize;
 
     wav.format = (wav.header.numChannels == 1 ?
                  (wav.header.bitsPerSample == 8 ? AL_FORMAT_MONO8 : AL_FORMAT_MONO16) :
                  (wav.header.bitsPerSample == 8 ? AL_FORMAT_STEREO8 : AL_FORMAT_STEREO16));
 
-    std::vector<uint8_t> samples;
-    samples.resize(dataSize);
-    
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read((uint8_t*) samples.data(), dataSize));
-    wav.samples = utils::URaw(std::move(samples));
+    // Memory-backed streams hand out their bytes directly, file mappings without a copy
+    AX_DECL_OR_PROPAGATE(samples, buffer.ReadShared(dataSize));
+    if (samples.size() != dataSize) {
+        return utils::ExError{-5, "Unexpected EOF"};
+    }
+    wav.samples = std::move(samples);
 
     return wav;
 }
@@ -69,7 +76,7 @@ utils::ExResult<WAVAudio> WAV_LoadFileBytes(utils::Span<uint8_t> bufferView) {
 }
 
 utils::ExResult<WAVAudio> WAV_LoadFile(const std::filesystem::path& path) {
-    auto stream = std::make_shared<data::FileDataStream>(path, true, false);
+    auto stream = std::make_shared<data::MMapDataStream>(path, data::MMapAdvice::Sequential);
     AX_PROPAGATE_ERROR(stream->Open());
     return WAV_LoadFileBytes(*stream);
 }
@@ -0,0 +1,436 @@
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <ostream>
+
+#if defined(__GLIBC__)
+#include <execinfo.h>
+#endif
+
+namespace axle::core
+{
+
+namespace
+{
+
+constexpr size_t SOURCES = size_t(AllocSource::Count);
+constexpr size_t TAGS = size_t(AllocTag::Count);
+constexpr uint32_t MAX_THREAD_RECORDS = 256;
+constexpr uint32_t SAMPLE_PROBES = 16;
+
+struct ThreadCell {
+    std::atomic<uint64_t> allocs{0};
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    std::atomic<int64_t> pendingBytes{0}; // Not yet folded into GlobalCell::liveBytes
+};
+
+struct GlobalCell {
+    std::atomic<uint64_t> allocs{0}; // Retired threads only
+    std::atomic<uint64_t> frees{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    std::atomic<int64_t> liveBytes{0};
+    std::atomic<int64_t> peakBytes{0};
+};
+
+// Written by its owning thread only, unless `shared` (threads beyond MAX_THREAD_RECORDS)
+struct alignas(64) ThreadRecord {
+    std::atomic_bool inUse{false};
+    bool shared{false};
+    ThreadCell cells[SOURCES][TAGS]{};
+};
+
+struct Sample {
+    std::atomic<void*> ptr{nullptr};
+    uint64_t serial{0};
+    size_t bytes{0};
+    AllocTag tag{AllocTag::General};
+    uint32_t depth{0};
+    void* frames[AllocTracker::MAX_FRAMES]{};
+};
+
+// Constant-initialized: usable from global new before any dynamic initializer has run
+ThreadRecord g_Records[MAX_THREAD_RECORDS]{};
+ThreadRecord g_SharedRecord{.inUse{true}, .shared{true}};
+GlobalCell g_Global[SOURCES][TAGS]{};
+std::atomic<uint32_t> g_SampleRate{0};
+Sample g_Samples[AllocTracker::SAMPLE_SLOTS]{};
+std::atomic<uint64_t> g_SampleSerial{0};
+
+thread_local ThreadRecord* t_Local{nullptr}; // Trivial TLS, skips t_Record's init guard on the hot path
+
+void Retire(ThreadRecord& record);
+
+struct ThreadRecordHandle {
+    ThreadRecord* record{nullptr};
+    bool retired{false};
+
+    ~ThreadRecordHandle() {
+        if (record) Retire(*record);
+        record = nullptr;
+        t_Local = nullptr;
+        retired = true; // Late frees from other thread_local destructors go to the shared record
+    }
+};
+
+thread_local ThreadRecordHandle t_Record{};
+thread_local AllocTag t_Tag{AllocTag::General};
+thread_local uint32_t t_SampleCountdown{0};
+thread_local bool t_InSample{false};
+
+ThreadRecord& ClaimRecord() {
+    auto& handle = t_Record;
+    if (handle.record) return *handle.record;
+    if (handle.retired) return g_SharedRecord;
+
+    for (auto& record : g_Records) {
+        bool expected{false};
+        if (!record.inUse.load(std::memory_order_relaxed) &&
+            record.inUse.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            handle.record = &record;
+            t_Local = &record;
+            return record;
+        }
+    }
+    handle.retired = true;
+    return g_SharedRecord;
+}
+
+inline ThreadRecord& LocalRecord() {
+    if (auto* record = t_Local) return *record;
+    return ClaimRecord();
+}
+
+inline void FoldLive(GlobalCell& global, int64_t delta) {
+    auto live = global.liveBytes.fetch_add(delta, std::memory_order_relaxed) + delta;
+    auto peak = global.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !global.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {}
+}
+
+inline bool ShouldFold(int64_t pending) {
+    return pending >= AllocTracker::FLUSH_BYTES || pending <= -AllocTracker::FLUSH_BYTES;
+}
+
+inline void Add(std::atomic<uint64_t>& counter, uint64_t value) {
+    counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+// Threads without a record of their own (table full, or exiting) share one, updated atomically
+[[gnu::noinline]] void AccountShared(size_t source, size_t tag, int64_t delta, uint64_t allocs, uint64_t frees) {
+    auto& cell = g_SharedRecord.cells[source][tag];
+    if (allocs) {
+        cell.allocs.fetch_add(allocs, std::memory_order_relaxed);
+        cell.allocatedBytes.fetch_add(uint64_t(delta), std::memory_order_relaxed);
+    }
+    if (frees) cell.frees.fetch_add(frees, std::memory_order_relaxed);
+
+    if (ShouldFold(cell.pendingBytes.fetch_add(delta, std::memory_order_relaxed) + delta)) {
+        FoldLive(g_Global[source][tag], cell.pendingBytes.exchange(0, std::memory_order_relaxed));
+    }
+}
+
+inline void Account(size_t source, size_t tag, int64_t delta, uint64_t allocs, uint64_t frees) {
+    auto& record = LocalRecord();
+    if (record.shared) {
+        AccountShared(source, tag, delta, allocs, frees);
+        return;
+    }
+
+    // Single writer: plain load/store, readers only need untorn values
+    auto& cell = record.cells[source][tag];
+    if (allocs) {
+        Add(cell.allocs, allocs);
+        Add(cell.allocatedBytes, uint64_t(delta));
+    }
+    if (frees) Add(cell.frees, frees);
+
+    int64_t pending = cell.pendingBytes.load(std::memory_order_relaxed) + delta;
+    if (ShouldFold(pending)) {
+        FoldLive(g_Global[source][tag], pending);
+        pending = 0;
+    }
+    cell.pendingBytes.store(pending, std::memory_order_relaxed);
+}
+
+void Retire(ThreadRecord& record) {
+    for (size_t s{0}; s < SOURCES; s++) {
+        for (size_t t{0}; t < TAGS; t++) {
+            auto& cell = record.cells[s][t];
+            auto& global = g_Global[s][t];
+            global.allocs.fetch_add(cell.allocs.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            global.frees.fetch_add(cell.frees.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            global.allocatedBytes.fetch_add(cell.allocatedBytes.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+            FoldLive(global, cell.pendingBytes.exchange(0, std::memory_order_relaxed));
+        }
+    }
+    record.inUse.store(false, std::memory_order_release);
+}
+
+inline size_t SampleHash(const void* ptr) {
+    auto value = reinterpret_cast<uintptr_t>(ptr) >> 4;
+    return size_t(value * 0x9E3779B97F4A7C15ull) >> 20;
+}
+
+}
+
+const char* AllocTagName(AllocTag tag) {
+    switch (tag) {
+        case AllocTag::General: return "General";
+        case AllocTag::Assets: return "Assets";
+        case AllocTag::Gfx: return "Gfx";
+        case AllocTag::Audio: return "Audio";
+        case AllocTag::Text: return "Text";
+        case AllocTag::Scene: return "Scene";
+        default: return "Unknown";
+    }
+}
+
+const char* AllocSourceName(AllocSource source) {
+    switch (source) {
+        case AllocSource::Heap: return "Heap";
+        case AllocSource::Linear: return "Linear";
+        case AllocSource::Pool: return "Pool";
+        case AllocSource::Tlsf: return "Tlsf";
+        case AllocSource::Arena: return "Arena";
+        default: return "Unknown";
+    }
+}
+
+AllocCounters AllocTrackerSnapshot::Total(AllocSource source) const {
+    AllocCounters total{};
+    for (auto& cell : cells[size_t(source)]) {
+        total.allocs += cell.allocs;
+        total.frees += cell.frees;
+        total.allocatedBytes += cell.allocatedBytes;
+        total.liveBytes += cell.liveBytes;
+        total.peakBytes += cell.peakBytes; // Upper bound, tags peak at different times
+    }
+    return total;
+}
+
+void AllocTracker::OnAlloc(AllocSource source, AllocTag tag, size_t bytes, uint64_t count) {
+    Account(size_t(source), size_t(tag), int64_t(bytes), count, 0);
+}
+
+void AllocTracker::OnFree(AllocSource source, AllocTag tag, size_t bytes, uint64_t count) {
+    Account(size_t(source), size_t(tag), -int64_t(bytes), 0, count);
+}
+
+AllocTag AllocTracker::CurrentTag() {
+    return t_Tag;
+}
+
+void AllocTracker::SetCurrentTag(AllocTag tag) {
+    t_Tag = tag;
+}
+
+void AllocTracker::SetSampleRate(uint32_t everyN) {
+    g_SampleRate.store(everyN, std::memory_order_relaxed);
+}
+
+uint32_t AllocTracker::GetSampleRate() {
+    return g_SampleRate.load(std::memory_order_relaxed);
+}
+
+AllocTrackerSnapshot AllocTracker::Snapshot() {
+    AllocTrackerSnapshot snapshot{};
+    for (size_t s{0}; s < SOURCES; s++) {
+        for (size_t t{0}; t < TAGS; t++) {
+            auto& out = snapshot.cells[s][t];
+            auto& global = g_Global[s][t];
+            out.allocs = global.allocs.load(std::memory_order_relaxed);
+            out.frees = global.frees.load(std::memory_order_relaxed);
+            out.allocatedBytes = global.allocatedBytes.load(std::memory_order_relaxed);
+            out.liveBytes = global.liveBytes.load(std::memory_order_relaxed);
+            out.peakBytes = global.peakBytes.load(std::memory_order_relaxed);
+
+            auto addRecord = [&](const ThreadRecord& record) {
+                auto& cell = record.cells[s][t];
+                out.allocs += cell.allocs.load(std::memory_order_relaxed);
+                out.frees += cell.frees.load(std::memory_order_relaxed);
+                out.allocatedBytes += cell.allocatedBytes.load(std::memory_order_relaxed);
+                out.liveBytes += cell.pendingBytes.load(std::memory_order_relaxed);
+            };
+            for (auto& record : g_Records) addRecord(record);
+            addRecord(g_SharedRecord);
+            out.peakBytes = std::max(out.peakBytes, out.liveBytes);
+        }
+    }
+    snapshot.sampleSerial = g_SampleSerial.load(std::memory_order_acquire);
+    return snapshot;
+}
+
+void AllocTracker::ReportLeaks(std::ostream& out) {
+    ReportLeaks(out, AllocTrackerSnapshot{});
+}
+
+void AllocTracker::ReportLeaks(std::ostream& out, const AllocTrackerSnapshot& baseline) {
+    auto snapshot = Snapshot();
+    bool leaked{false};
+    for (size_t s{0}; s < SOURCES; s++) {
+        for (size_t t{0}; t < TAGS; t++) {
+            auto& cell = snapshot.cells[s][t];
+            auto& base = baseline.cells[s][t];
+            int64_t liveBytes = cell.liveBytes - base.liveBytes;
+            int64_t liveCount = cell.LiveCount() - base.LiveCount();
+            if (liveBytes <= 0 && liveCount <= 0) continue;
+            leaked = true;
+            out << "Leak: " << AllocSourceName(AllocSource(s)) << "/" << AllocTagName(AllocTag(t))
+                << " " << liveBytes << " bytes in " << liveCount << " allocations"
+                << " (peak " << cell.peakBytes << " bytes)\n";
+        }
+    }
+    if (!leaked) {
+        out << "No leaks\n";
+        return;
+    }
+
+    for (auto& sample : g_Samples) {
+        void* ptr = sample.ptr.load(std::memory_order_acquire);
+        if (!ptr || sample.serial <= baseline.sampleSerial) continue;
+        out << "Sampled leak: " << sample.bytes << " bytes at " << ptr << " [" << AllocTagName(sample.tag) << "]\n";
+#if defined(__GLIBC__)
+        if (char** symbols = backtrace_symbols(sample.frames, int(sample.depth))) {
+            for (uint32_t i{0}; i < sample.depth; i++) {
+                out << "    " << symbols[i] << "\n";
+            }
+            std::free(symbols);
+        }
+#endif
+    }
+}
+
+bool AllocTracker::ShouldSample() {
+    auto rate = g_SampleRate.load(std::memory_order_relaxed);
+    if (rate == 0 || t_InSample) return false;
+    if (t_SampleCountdown == 0 || t_SampleCountdown > rate) t_SampleCountdown = rate;
+    return --t_SampleCountdown == 0;
+}
+
+bool AllocTracker::RecordSample(void* ptr, size_t bytes, AllocTag tag) {
+    auto start = SampleHash(ptr);
+    for (uint32_t i{0}; i < SAMPLE_PROBES; i++) {
+        auto& sample = g_Samples[(start + i) % SAMPLE_SLOTS];
+        void* expected{nullptr};
+        if (sample.ptr.load(std::memory_order_relaxed) || !sample.ptr.compare_exchange_strong(expected, ptr, std::memory_order_acq_rel))
+            continue;
+
+        t_InSample = true;
+        sample.serial = g_SampleSerial.fetch_add(1, std::memory_order_acq_rel) + 1;
+        sample.bytes = bytes;
+        sample.tag = tag;
+#if defined(__GLIBC__)
+        sample.depth = uint32_t(std::max(backtrace(sample.frames, int(MAX_FRAMES)), 0));
+#else
+        sample.depth = 0;
+#endif
+        t_InSample = false;
+        return true;
+    }
+    return false; // Neighbourhood full, this allocation goes unsampled
+}
+
+void AllocTracker::EraseSample(void* ptr) {
+    auto start = SampleHash(ptr);
+    for (uint32_t i{0}; i < SAMPLE_PROBES; i++) {
+        auto& sample = g_Samples[(start + i) % SAMPLE_SLOTS];
+        void* expected{ptr};
+        if (sample.ptr.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel))
+            return;
+    }
+}
+
+}
+
+#ifdef __AX_ALLOC_TRACKING__
+
+// Global new/delete: 16-byte header in front of every block carries size, tag and sample flag for the matching delete
+namespace
+{
+
+struct HeapHeader {
+    uint64_t size;
+    uint32_t offset; // Back to the malloc'd base
+    uint8_t tag;
+    uint8_t sampled;
+    uint16_t magic;
+};
+static_assert(sizeof(HeapHeader) == 16);
+
+constexpr uint16_t HEAP_MAGIC = 0xA71C;
+constexpr size_t HEAP_HEADER = sizeof(HeapHeader);
+
+void* TrackedNew(size_t size, size_t align, bool nothrow) {
+    align = std::max(align, HEAP_HEADER);
+    size_t total = size + HEAP_HEADER + (align > HEAP_HEADER ? align : 0);
+
+    void* base{nullptr};
+    while (!(base = std::malloc(total))) {
+        auto handler = std::get_new_handler();
+        if (!handler) {
+            if (nothrow) return nullptr;
+            throw std::bad_alloc();
+        }
+        if (nothrow) {
+            try { handler(); } catch (...) { return nullptr; }
+        } else {
+            handler();
+        }
+    }
+
+    auto addr = reinterpret_cast<uintptr_t>(base) + HEAP_HEADER;
+    addr = (addr + align - 1) & ~(uintptr_t(align) - 1);
+    auto* ptr = reinterpret_cast<void*>(addr);
+
+    auto tag = axle::core::AllocTracker::CurrentTag();
+    auto* header = reinterpret_cast<HeapHeader*>(addr) - 1;
+    header->size = size;
+    header->offset = uint32_t(addr - reinterpret_cast<uintptr_t>(base));
+    header->tag = uint8_t(tag);
+    header->magic = HEAP_MAGIC;
+    header->sampled = axle::core::AllocTracker::ShouldSample() && axle::core::AllocTracker::RecordSample(ptr, size, tag);
+
+    axle::core::AllocTracker::OnAlloc(axle::core::AllocSource::Heap, tag, size);
+    return ptr;
+}
+
+void TrackedDelete(void* ptr) noexcept {
+    if (!ptr) return;
+    auto* header = static_cast<HeapHeader*>(ptr) - 1;
+    if (header->magic != HEAP_MAGIC) std::abort(); // Not ours, or corrupted
+
+    axle::core::AllocTracker::OnFree(axle::core::AllocSource::Heap, axle::core::AllocTag(header->tag), header->size);
+    if (header->sampled) axle::core::AllocTracker::EraseSample(ptr);
+
+    header->magic = 0;
+    std::free(static_cast<uint8_t*>(ptr) - header->offset);
+}
+
+}
+
+void* operator new(std::size_t size) { return TrackedNew(size, 0, false); }
+void* operator new[](std::size_t size) { return TrackedNew(size, 0, false); }
+void* operator new(std::size_t size, const std::nothrow_t&) noexcept { return TrackedNew(size, 0, true); }
+void* operator new[](std::size_t size, const std::nothrow_t&) noexcept { return TrackedNew(size, 0, true); }
+void* operator new(std::size_t size, std::align_val_t align) { return TrackedNew(size, size_t(align), false); }
+void* operator new[](std::size_t size, std::align_val_t align) { return TrackedNew(size, size_t(align), false); }
+void* operator new(std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return TrackedNew(size, size_t(align), true); }
+void* operator new[](std::size_t size, std::align_val_t align, const std::nothrow_t&) noexcept { return TrackedNew(size, size_t(align), true); }
+
+void operator delete(void* ptr) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr) noexcept { TrackedDelete(ptr); }
+void operator delete(void* ptr, std::size_t) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr, std::size_t) noexcept { TrackedDelete(ptr); }
+void operator delete(void* ptr, const std::nothrow_t&) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr, const std::nothrow_t&) noexcept { TrackedDelete(ptr); }
+void operator delete(void* ptr, std::align_val_t) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr, std::align_val_t) noexcept { TrackedDelete(ptr); }
+void operator delete(void* ptr, std::size_t, std::align_val_t) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr, std::size_t, std::align_val_t) noexcept { TrackedDelete(ptr); }
+void operator delete(void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedDelete(ptr); }
+void operator delete[](void* ptr, std::align_val_t, const std::nothrow_t&) noexcept { TrackedDelete(ptr); }
+
+#endif
@@ -1,17 +1,67 @@
 #include "axle/core/alloc/AX_FrameAllocator.hpp"
 
+#include <bit>
+#include <new>
+
 namespace axle::core
 {
 
-FrameAllocator::FrameAllocator(size_t size)
-    : m_arena(size) {}
+FrameAllocator::FrameAllocator(size_t size, std::pmr::memory_resource* upstream)
+    : m_TargetSize(size), m_Upstream(upstream) {
+    for (auto& frame : m_Frames) {
+        frame.arena = std::make_unique<LinearAllocator>(size);
+    }
+}
+
+FrameAllocator::~FrameAllocator() {
+    for (auto& frame : m_Frames) {
+        ReleaseFrame(frame);
+    }
+}
 
 void* FrameAllocator::Allocate(size_t size, size_t align) {
-    return m_arena.Allocate(size, align);
+    auto& frame = m_Frames[m_Current.load(std::memory_order_relaxed)];
+    if (void* ptr = frame.arena->Allocate(size, align))
+        return ptr;
+    return AllocateOverflow(frame, size, align);
+}
+
+void* FrameAllocator::AllocateOverflow(Frame& frame, size_t size, size_t align) {
+    void* ptr = m_Upstream->allocate(size, align);
+    std::lock_guard<std::mutex> lock(m_OverflowMutex);
+    frame.overflow.push_back({ptr, size, align});
+    frame.overflowBytes += size;
+    m_OverflowCount.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+}
+
+void FrameAllocator::ReleaseFrame(Frame& frame) {
+    for (auto& block : frame.overflow) {
+        m_Upstream->deallocate(block.ptr, block.size, block.align);
+    }
+    frame.overflow.clear();
+    frame.overflowBytes = 0;
 }
 
 void FrameAllocator::BeginFrame() {
-    m_arena.Reset();
+    auto next = m_Current.load(std::memory_order_relaxed) ^ 1u;
+    auto& frame = m_Frames[next];
+
+    if (frame.overflowBytes > 0) { // Size both arenas for the peak seen so far
+        m_TargetSize = std::max(m_TargetSize, std::bit_ceil(frame.arena->GetSize() + frame.overflowBytes));
+    }
+    ReleaseFrame(frame);
+
+    if (frame.arena->GetSize() < m_TargetSize) {
+        frame.arena->Resize(m_TargetSize);
+    } else {
+        frame.arena->Reset();
+    }
+    m_Current.store(next, std::memory_order_relaxed);
 }
 
-}
\ No newline at end of file
+void* FrameAllocator::do_allocate(size_t bytes, size_t alignment) {
+    return Allocate(bytes, alignment);
+}
+
+}
@@ -5,27 +5,54 @@ namespace axle::core
 
 LinearAllocator::LinearAllocator(size_t size) {
     m_memory = (uint8_t*)std::malloc(size);
-    m_size = size;
-    m_offset = 0;
+    m_size = m_memory ? size : 0;
+    m_offset.store(0, std::memory_order_relaxed);
 }
 
 LinearAllocator::~LinearAllocator() {
+    TrackReset();
     std::free(m_memory);
 }
 
 void* LinearAllocator::Allocate(size_t size, size_t alignment) {
-    size_t current = (size_t)(m_memory + m_offset);
-    size_t aligned = (current + alignment - 1) & ~(alignment - 1);
-
-    size_t newOffset = aligned - (size_t)m_memory + size;
-    if (newOffset > m_size) return nullptr;
+    assert((alignment & (alignment - 1)) == 0);
+
+    size_t offset = m_offset.load(std::memory_order_relaxed);
+    while (true) {
+        size_t current = (size_t)(m_memory + offset);
+        size_t aligned = (current + alignment - 1) & ~(alignment - 1);
+
+        size_t newOffset = aligned - (size_t)m_memory + size;
+        if (newOffset > m_size) return nullptr;
+
+        if (m_offset.compare_exchange_weak(offset, newOffset, std::memory_order_relaxed)) {
+#ifdef __AX_ALLOC_TRACKING__
+            m_Allocations.fetch_add(1, std::memory_order_relaxed);
+            AX_TRACK_ALLOC(AllocSource::Linear, m_Tag, newOffset - offset, 1);
+#endif
+            return (void*)aligned;
+        }
+    }
+}
 
-    m_offset = newOffset;
-    return (void*)aligned;
+// Everything handed out since the last reset is released at once, padding included
+void LinearAllocator::TrackReset() {
+#ifdef __AX_ALLOC_TRACKING__
+    AX_TRACK_FREE(AllocSource::Linear, m_Tag, m_offset.load(std::memory_order_relaxed), m_Allocations.exchange(0, std::memory_order_relaxed));
+#endif
 }
 
 void LinearAllocator::Reset() {
-    m_offset = 0;
+    TrackReset();
+    m_offset.store(0, std::memory_order_relaxed);
 }
 
-}
\ No newline at end of file
+void LinearAllocator::Resize(size_t size) {
+    TrackReset();
+    std::free(m_memory);
+    m_memory = (uint8_t*)std::malloc(size);
+    m_size = m_memory ? size : 0;
+    m_offset.store(0, std::memory_order_relaxed);
+}
+
+}
@@ -1,33 +1,216 @@
 #include "axle/core/alloc/AX_PoolAllocator.hpp"
-    
+
+#include <algorithm>
+#include <bit>
+#include <unordered_set>
+
 namespace axle::core
 {
 
-PoolAllocator::PoolAllocator(size_t objectSize, size_t capacity)
-{
-    m_objectSize = objectSize;
-    m_memory = std::malloc(objectSize * capacity);
+static std::atomic<uint64_t> s_NextPoolId{1};
+
+// Ids of pools not yet destroyed. Exiting threads hold the lock while returning their magazines, so a pool cannot
+// be destroyed underneath them. Leaked on purpose, threads may exit after static destruction.
+struct LivePools {
+    std::mutex mutex{};
+    std::unordered_set<uint64_t> ids{};
+};
+
+static LivePools& GetLivePools() {
+    static auto* s_LivePools = new LivePools();
+    return *s_LivePools;
+}
+
+// Per-thread magazine lookup keyed by pool id. Ids are never reused, so entries of destroyed pools only
+// mismatch; they are pruned as the table grows.
+struct PoolThreadCaches {
+    struct Entry {
+        uint64_t poolId;
+        PoolAllocator* pool;
+        PoolAllocator::ThreadCache* cache;
+    };
+
+    std::vector<Entry> entries{};
+    size_t pruneAt{16};
+    uint64_t lastPoolId{0};
+    PoolAllocator::ThreadCache* lastCache{nullptr};
+
+    ~PoolThreadCaches() {
+        auto& live = GetLivePools();
+        std::lock_guard<std::mutex> lock(live.mutex);
+        for (auto& entry : entries) {
+            if (live.ids.contains(entry.poolId)) entry.pool->ReleaseThreadCache(*entry.cache);
+        }
+    }
 
-    for (size_t i = 0; i < capacity; i++) {
-        void* ptr = (char*)m_memory + i * objectSize;
-        m_freeList.push_back(ptr);
+    void Prune() {
+        auto& live = GetLivePools();
+        std::lock_guard<std::mutex> lock(live.mutex);
+        std::erase_if(entries, [&](const Entry& entry) { return !live.ids.contains(entry.poolId); });
+        lastPoolId = 0;
+        pruneAt = std::max<size_t>(16, entries.size() * 2);
     }
+};
+static thread_local PoolThreadCaches t_PoolCaches{};
+
+PoolAllocator::PoolAllocator(size_t objectSize, size_t chunkObjects, size_t alignment, uint32_t magazineSize) {
+    m_Alignment = std::bit_ceil(std::max(alignment, alignof(FreeNode)));
+    size_t size = std::max(objectSize, sizeof(FreeNode));
+    m_ObjectSize = (size + m_Alignment - 1) & ~(m_Alignment - 1);
+    m_ChunkObjects = std::max<size_t>(chunkObjects, 1);
+    m_MagazineSize = std::max(magazineSize, 1u);
+    m_PoolId = s_NextPoolId.fetch_add(1, std::memory_order_relaxed);
+
+    auto& live = GetLivePools();
+    std::lock_guard<std::mutex> lock(live.mutex);
+    live.ids.insert(m_PoolId);
 }
 
 PoolAllocator::~PoolAllocator() {
-    std::free(m_memory);
+    {
+        auto& live = GetLivePools();
+        std::lock_guard<std::mutex> lock(live.mutex);
+        live.ids.erase(m_PoolId);
+    }
+    for (void* chunk : m_Chunks) {
+        ::operator delete(chunk, std::align_val_t(m_Alignment));
+    }
+}
+
+PoolAllocator::ThreadCache& PoolAllocator::GetThreadCache() {
+    auto& caches = t_PoolCaches;
+    if (caches.lastPoolId == m_PoolId) return *caches.lastCache;
+    for (auto& entry : caches.entries) {
+        if (entry.poolId == m_PoolId) {
+            caches.lastPoolId = m_PoolId;
+            caches.lastCache = entry.cache;
+            return *entry.cache;
+        }
+    }
+
+    // First use on this thread: take a magazine left by an exited thread, or register a new one
+    ThreadCache* cache{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(m_CachesMutex);
+        for (auto& candidate : m_Caches) {
+            if (!candidate->inUse) {
+                cache = candidate.get();
+                break;
+            }
+        }
+        if (!cache) {
+            m_Caches.push_back(std::make_unique<ThreadCache>());
+            cache = m_Caches.back().get();
+        }
+        cache->inUse = true;
+    }
+
+    if (caches.entries.size() >= caches.pruneAt) caches.Prune();
+    caches.entries.push_back({m_PoolId, this, cache});
+    caches.lastPoolId = m_PoolId;
+    caches.lastCache = cache;
+    return *cache;
+}
+
+void PoolAllocator::ReleaseThreadCache(ThreadCache& cache) {
+    if (cache.head) {
+        FreeNode* tail = cache.head;
+        while (tail->next) tail = tail->next;
+
+        std::lock_guard<std::mutex> lock(m_DepotMutex);
+        tail->next = m_Loose;
+        m_Loose = cache.head;
+    }
+    cache.head = nullptr;
+    cache.count = 0;
+
+    std::lock_guard<std::mutex> lock(m_CachesMutex);
+    cache.inUse = false;
+}
+
+bool PoolAllocator::Grow() {
+    void* chunk = ::operator new(m_ObjectSize * m_ChunkObjects, std::align_val_t(m_Alignment), std::nothrow);
+    if (!chunk) return false;
+    m_Chunks.push_back(chunk);
+    m_ChunkCursor = static_cast<uint8_t*>(chunk);
+    m_ChunkEnd = m_ChunkCursor + m_ObjectSize * m_ChunkObjects;
+    m_Capacity.fetch_add(m_ChunkObjects, std::memory_order_relaxed);
+    return true;
+}
+
+bool PoolAllocator::Refill(ThreadCache& cache) {
+    std::lock_guard<std::mutex> lock(m_DepotMutex);
+    if (m_Depot) {
+        cache.head = m_Depot;
+        cache.count = m_MagazineSize;
+        m_Depot = m_Depot->nextBatch;
+        return true;
+    }
+    if (m_Loose) {
+        FreeNode* tail = m_Loose;
+        uint32_t count{1};
+        for (; count < m_MagazineSize && tail->next; count++) tail = tail->next;
+        cache.head = m_Loose;
+        cache.count = count;
+        m_Loose = tail->next;
+        tail->next = nullptr;
+        return true;
+    }
+
+    // Carve a magazine out of the current chunk, growing when it runs dry
+    FreeNode* head{nullptr};
+    uint32_t count{0};
+    while (count < m_MagazineSize) {
+        if (m_ChunkCursor == m_ChunkEnd && !Grow()) break;
+        auto* node = reinterpret_cast<FreeNode*>(m_ChunkCursor);
+        m_ChunkCursor += m_ObjectSize;
+        node->next = head;
+        head = node;
+        count++;
+    }
+    cache.head = head;
+    cache.count = count;
+    return count > 0;
+}
+
+void PoolAllocator::Flush(ThreadCache& cache) {
+    // Detach one magazine worth, the cache keeps the rest
+    FreeNode* batch = cache.head;
+    FreeNode* tail = batch;
+    for (uint32_t i{1}; i < m_MagazineSize; i++) {
+        tail = tail->next;
+    }
+    cache.head = tail->next;
+    cache.count -= m_MagazineSize;
+    tail->next = nullptr;
+
+    std::lock_guard<std::mutex> lock(m_DepotMutex);
+    batch->nextBatch = m_Depot;
+    m_Depot = batch;
 }
 
 void* PoolAllocator::Allocate() {
-    if (m_freeList.empty()) return nullptr;
+    auto& cache = GetThreadCache();
+    if (!cache.head && !Refill(cache)) return nullptr;
 
-    void* ptr = m_freeList.back();
-    m_freeList.pop_back();
-    return ptr;
+    FreeNode* node = cache.head;
+    cache.head = node->next;
+    cache.count--;
+    AX_TRACK_ALLOC(AllocSource::Pool, m_Tag, m_ObjectSize, 1);
+    return node;
 }
 
 void PoolAllocator::Free(void* ptr) {
-    m_freeList.push_back(ptr);
+    if (!ptr) return;
+    AX_TRACK_FREE(AllocSource::Pool, m_Tag, m_ObjectSize, 1);
+    auto& cache = GetThreadCache();
+
+    auto* node = static_cast<FreeNode*>(ptr);
+    node->next = cache.head;
+    cache.head = node;
+    if (++cache.count >= m_MagazineSize * 2) {
+        Flush(cache);
+    }
 }
 
-}
\ No newline at end of file
+}
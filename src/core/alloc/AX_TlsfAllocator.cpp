@@ -0,0 +1,321 @@
+#include "axle/core/alloc/AX_TlsfAllocator.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#elif defined(_WIN32)
+#include <windows.h>
+#endif
+
+namespace axle::core
+{
+
+namespace
+{
+
+constexpr size_t FREE_BIT = 1;
+constexpr size_t PREV_FREE_BIT = 2;
+constexpr size_t FLAG_MASK = FREE_BIT | PREV_FREE_BIT;
+
+constexpr size_t HEADER = sizeof(void*) + sizeof(size_t); // prevPhys + sizeFlags, payload starts at nextFree
+constexpr size_t MIN_BLOCK = sizeof(void*) * 2; // Room for the free-list links
+constexpr size_t MAX_BLOCK = size_t(1) << TlsfAllocator::FL_MAX_LOG2;
+constexpr size_t VM_GRANULARITY = 64 * 1024;
+
+inline size_t AlignUp(size_t value, size_t align) { return (value + align - 1) & ~(align - 1); }
+
+inline void MappingInsert(size_t size, uint32_t& fl, uint32_t& sl) {
+    if (size < TlsfAllocator::SMALL_BLOCK) {
+        fl = 0;
+        sl = uint32_t(size / (TlsfAllocator::SMALL_BLOCK / TlsfAllocator::SL_COUNT));
+    } else {
+        uint32_t msb = uint32_t(std::bit_width(size) - 1);
+        sl = uint32_t(size >> (msb - TlsfAllocator::SL_LOG2)) ^ TlsfAllocator::SL_COUNT;
+        fl = msb - (TlsfAllocator::FL_SHIFT - 1);
+    }
+}
+
+template <typename T_Block>
+inline size_t SizeOf(const T_Block* block) { return block->sizeFlags & ~FLAG_MASK; }
+
+template <typename T_Block>
+inline uint8_t* PayloadOf(T_Block* block) { return reinterpret_cast<uint8_t*>(block) + HEADER; }
+
+template <typename T_Block>
+inline T_Block* NextOf(T_Block* block) { return reinterpret_cast<T_Block*>(PayloadOf(block) + SizeOf(block)); }
+
+// Rounds up to the next list boundary so any block found there is large enough
+inline void MappingSearch(size_t size, uint32_t& fl, uint32_t& sl) {
+    if (size >= TlsfAllocator::SMALL_BLOCK) {
+        size += (size_t(1) << (std::bit_width(size) - 1 - TlsfAllocator::SL_LOG2)) - 1;
+    }
+    MappingInsert(size, fl, sl);
+}
+
+}
+
+TlsfAllocator::TlsfAllocator(const TlsfDesc& desc) : m_Desc(desc) {
+    if (m_Desc.backing == TlsfBacking::UserBuffer) {
+        m_Desc.growSize = 0;
+    }
+    AddPool(m_Desc.poolSize);
+}
+
+TlsfAllocator::~TlsfAllocator() {
+    for (auto& pool : m_Pools) {
+        switch (m_Desc.backing) {
+            case TlsfBacking::Malloc:
+                ::operator delete(pool.memory, std::align_val_t(ALIGN));
+                break;
+            case TlsfBacking::VirtualMemory:
+#if defined(__unix__) || defined(__APPLE__)
+                munmap(pool.memory, pool.size);
+#elif defined(_WIN32)
+                VirtualFree(pool.memory, 0, MEM_RELEASE);
+#else
+                ::operator delete(pool.memory, std::align_val_t(ALIGN));
+#endif
+                break;
+            case TlsfBacking::UserBuffer:
+                break;
+        }
+    }
+}
+
+bool TlsfAllocator::AddPool(size_t size) {
+    void* memory{nullptr};
+    size = AlignUp(size, ALIGN);
+
+    switch (m_Desc.backing) {
+        case TlsfBacking::Malloc:
+            memory = ::operator new(size, std::align_val_t(ALIGN), std::nothrow);
+            break;
+        case TlsfBacking::VirtualMemory:
+            size = AlignUp(size, VM_GRANULARITY);
+#if defined(__unix__) || defined(__APPLE__)
+            memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (memory == MAP_FAILED) memory = nullptr;
+#elif defined(_WIN32)
+            memory = VirtualAlloc(nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE);
+#else
+            memory = ::operator new(size, std::align_val_t(ALIGN), std::nothrow);
+#endif
+            break;
+        case TlsfBacking::UserBuffer: {
+            if (!m_Desc.userBuffer || !m_Pools.empty()) return false;
+            auto addr = reinterpret_cast<uintptr_t>(m_Desc.userBuffer);
+            auto aligned = AlignUp(addr, ALIGN);
+            size = m_Desc.poolSize > aligned - addr ? (m_Desc.poolSize - (aligned - addr)) & ~(ALIGN - 1) : 0;
+            memory = reinterpret_cast<void*>(aligned);
+            break;
+        }
+    }
+    if (!memory) return false;
+
+    size_t payload = size >= HEADER * 2 + MIN_BLOCK ? std::min(size - HEADER * 2, MAX_BLOCK - ALIGN) : 0;
+    if (payload == 0) {
+        if (m_Desc.backing == TlsfBacking::Malloc) ::operator delete(memory, std::align_val_t(ALIGN));
+        return false;
+    }
+    m_Pools.push_back({memory, size});
+
+    // One free block spanning the pool, closed by a zero-size used sentinel
+    auto* block = reinterpret_cast<Block*>(memory);
+    block->prevPhys = nullptr;
+    block->sizeFlags = payload | FREE_BIT;
+
+    auto* sentinel = NextOf(block);
+    sentinel->prevPhys = block;
+    sentinel->sizeFlags = PREV_FREE_BIT;
+
+    InsertFree(block);
+    m_Stats.poolBytes += size;
+    m_Stats.pools++;
+    return true;
+}
+
+void TlsfAllocator::InsertFree(Block* block) {
+    uint32_t fl, sl;
+    MappingInsert(SizeOf(block), fl, sl);
+
+    Block* head = m_Blocks[fl][sl];
+    block->nextFree = head;
+    block->prevFree = nullptr;
+    if (head) head->prevFree = block;
+    m_Blocks[fl][sl] = block;
+
+    m_FlBitmap |= 1u << fl;
+    m_SlBitmap[fl] |= 1u << sl;
+}
+
+void TlsfAllocator::RemoveFree(Block* block) {
+    uint32_t fl, sl;
+    MappingInsert(SizeOf(block), fl, sl);
+
+    if (block->prevFree) block->prevFree->nextFree = block->nextFree;
+    if (block->nextFree) block->nextFree->prevFree = block->prevFree;
+
+    if (m_Blocks[fl][sl] == block) {
+        m_Blocks[fl][sl] = block->nextFree;
+        if (!block->nextFree) {
+            m_SlBitmap[fl] &= ~(1u << sl);
+            if (!m_SlBitmap[fl]) m_FlBitmap &= ~(1u << fl);
+        }
+    }
+}
+
+TlsfAllocator::Block* TlsfAllocator::FindFree(size_t size) {
+    uint32_t fl, sl;
+    MappingSearch(size, fl, sl);
+    if (fl >= FL_COUNT) return nullptr;
+
+    uint32_t slMap = m_SlBitmap[fl] & (~0u << sl);
+    if (!slMap) {
+        uint32_t flMap = fl + 1 < FL_COUNT ? m_FlBitmap & (~0u << (fl + 1)) : 0;
+        if (!flMap) return nullptr;
+        fl = uint32_t(std::countr_zero(flMap));
+        slMap = m_SlBitmap[fl];
+    }
+    sl = uint32_t(std::countr_zero(slMap));
+    return m_Blocks[fl][sl];
+}
+
+// Trims a free block (already off its list) to size, returning the tail to the lists
+TlsfAllocator::Block* TlsfAllocator::Split(Block* block, size_t size) {
+    if (SizeOf(block) < size + HEADER + MIN_BLOCK) return block;
+
+    auto* rest = reinterpret_cast<Block*>(PayloadOf(block) + size);
+    rest->sizeFlags = (SizeOf(block) - size - HEADER) | FREE_BIT;
+    block->sizeFlags = size | (block->sizeFlags & FLAG_MASK);
+
+    NextOf(rest)->prevPhys = rest; // Already marked PREV_FREE
+    InsertFree(rest);
+    return block;
+}
+
+// Coalesces a newly freed block with its free physical neighbours
+TlsfAllocator::Block* TlsfAllocator::Merge(Block* block) {
+    if (block->sizeFlags & PREV_FREE_BIT) {
+        Block* prev = block->prevPhys;
+        RemoveFree(prev);
+        prev->sizeFlags += HEADER + SizeOf(block);
+        block = prev;
+    }
+    Block* next = NextOf(block);
+    if (next->sizeFlags & FREE_BIT) {
+        RemoveFree(next);
+        block->sizeFlags += HEADER + SizeOf(next);
+    }
+    return block;
+}
+
+void* TlsfAllocator::Use(Block* block, size_t size) {
+    block = Split(block, size);
+    block->sizeFlags &= ~FREE_BIT;
+
+    Block* next = NextOf(block);
+    next->prevPhys = block;
+    next->sizeFlags &= ~PREV_FREE_BIT;
+
+    m_Stats.usedBytes += SizeOf(block);
+    m_Stats.peakBytes = std::max(m_Stats.peakBytes, m_Stats.usedBytes);
+    m_Stats.allocations++;
+    AX_TRACK_ALLOC(AllocSource::Tlsf, m_Desc.tag, SizeOf(block), 1);
+    return PayloadOf(block);
+}
+
+void* TlsfAllocator::Allocate(size_t size, size_t align) {
+    if (size >= MAX_BLOCK || !std::has_single_bit(align)) return nullptr;
+
+    size = std::max(AlignUp(size, ALIGN), MIN_BLOCK);
+    bool overAligned = align > ALIGN;
+    // Over-aligned requests leave room to carve a leading free block off the front
+    size_t search = overAligned ? size + align + HEADER + MIN_BLOCK : size;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    Block* block = FindFree(search);
+    if (!block && m_Desc.growSize) {
+        size_t need = search + (search >> SL_LOG2) + HEADER * 2 + ALIGN;
+        if (AddPool(std::max(m_Desc.growSize, need))) {
+            block = FindFree(search);
+        }
+    }
+    if (!block) return nullptr;
+    RemoveFree(block);
+
+    if (overAligned) {
+        auto payload = reinterpret_cast<uintptr_t>(PayloadOf(block));
+        auto aligned = AlignUp(payload, align);
+        if (aligned != payload && aligned - payload < HEADER + MIN_BLOCK) {
+            aligned = AlignUp(payload + HEADER + MIN_BLOCK, align);
+        }
+
+        size_t gap = aligned - payload;
+        if (gap) {
+            auto* lead = block;
+            block = reinterpret_cast<Block*>(aligned - HEADER);
+            block->prevPhys = lead;
+            block->sizeFlags = (SizeOf(lead) - gap) | FREE_BIT | PREV_FREE_BIT;
+            lead->sizeFlags = (gap - HEADER) | (lead->sizeFlags & PREV_FREE_BIT) | FREE_BIT;
+
+            NextOf(block)->prevPhys = block;
+            InsertFree(lead);
+        }
+    }
+    return Use(block, size);
+}
+
+void TlsfAllocator::Free(void* ptr) {
+    if (!ptr) return;
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto* block = reinterpret_cast<Block*>(static_cast<uint8_t*>(ptr) - HEADER);
+    assert(!(block->sizeFlags & FREE_BIT) && "TlsfAllocator: double free");
+
+    m_Stats.usedBytes -= SizeOf(block);
+    m_Stats.allocations--;
+    AX_TRACK_FREE(AllocSource::Tlsf, m_Desc.tag, SizeOf(block), 1);
+
+    block->sizeFlags |= FREE_BIT;
+    block = Merge(block);
+
+    Block* next = NextOf(block);
+    next->prevPhys = block;
+    next->sizeFlags |= PREV_FREE_BIT;
+    InsertFree(block);
+}
+
+size_t TlsfAllocator::GetBlockSize(const void* ptr) const {
+    auto* block = reinterpret_cast<const Block*>(static_cast<const uint8_t*>(ptr) - HEADER);
+    return SizeOf(block);
+}
+
+TlsfStats TlsfAllocator::GetStats() const {
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    TlsfStats stats = m_Stats;
+    for (uint32_t fl{0}; fl < FL_COUNT; fl++) {
+        if (!(m_FlBitmap & (1u << fl))) continue;
+        for (uint32_t sl{0}; sl < SL_COUNT; sl++) {
+            for (Block* block = m_Blocks[fl][sl]; block; block = block->nextFree) {
+                stats.freeBytes += SizeOf(block);
+                stats.largestFree = std::max(stats.largestFree, SizeOf(block));
+            }
+        }
+    }
+    return stats;
+}
+
+void* TlsfAllocator::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = Allocate(bytes, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+}
@@ -0,0 +1,151 @@
+#include "axle/core/alloc/AX_VirtualArena.hpp"
+
+#include <algorithm>
+#include <new>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/mman.h>
+#include <unistd.h>
+#define AX_ARENA_MMAP
+#elif defined(_WIN32)
+#include <windows.h>
+#define AX_ARENA_VIRTUALALLOC
+#endif
+
+namespace axle::core
+{
+
+static size_t AlignUp(size_t value, size_t align) {
+    return (value + align - 1) & ~(align - 1);
+}
+
+static size_t GetPageSize() {
+#if defined(AX_ARENA_MMAP)
+    return size_t(sysconf(_SC_PAGESIZE));
+#elif defined(AX_ARENA_VIRTUALALLOC)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return size_t(info.dwPageSize);
+#else
+    return 4096;
+#endif
+}
+
+VirtualArena::VirtualArena(const VirtualArenaDesc& desc) : m_Desc(desc) {
+    size_t page = GetPageSize();
+    m_Desc.commitStep = AlignUp(std::max(m_Desc.commitStep, page), page);
+    size_t reserve = AlignUp(m_Desc.reserveSize, m_Desc.commitStep);
+
+#if defined(AX_ARENA_MMAP)
+    void* base = mmap(nullptr, reserve, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED) return;
+#if defined(MADV_HUGEPAGE)
+    if (m_Desc.hugePages) madvise(base, reserve, MADV_HUGEPAGE);
+#endif
+#elif defined(AX_ARENA_VIRTUALALLOC)
+    void* base = VirtualAlloc(nullptr, reserve, MEM_RESERVE, PAGE_NOACCESS);
+    if (!base) return;
+#else
+    void* base = ::operator new(reserve, std::nothrow); // No virtual memory: the whole reservation is committed now
+    if (!base) return;
+    m_Committed.store(reserve, std::memory_order_relaxed);
+#endif
+    m_Base = static_cast<uint8_t*>(base);
+    m_Reserved = reserve;
+}
+
+VirtualArena::~VirtualArena() {
+    Rollback({});
+    if (!m_Base) return;
+#if defined(AX_ARENA_MMAP)
+    munmap(m_Base, m_Reserved);
+#elif defined(AX_ARENA_VIRTUALALLOC)
+    VirtualFree(m_Base, 0, MEM_RELEASE);
+#else
+    ::operator delete(m_Base);
+#endif
+}
+
+bool VirtualArena::Commit(size_t end) {
+    std::lock_guard<std::mutex> lock(m_CommitMutex);
+    size_t committed = m_Committed.load(std::memory_order_relaxed);
+    if (end <= committed) return true;
+
+    size_t target = std::min(AlignUp(end, m_Desc.commitStep), m_Reserved);
+#if defined(AX_ARENA_MMAP)
+    if (mprotect(m_Base + committed, target - committed, PROT_READ | PROT_WRITE) != 0) return false;
+#elif defined(AX_ARENA_VIRTUALALLOC)
+    if (!VirtualAlloc(m_Base + committed, target - committed, MEM_COMMIT, PAGE_READWRITE)) return false;
+#endif
+    m_Committed.store(target, std::memory_order_release);
+    return true;
+}
+
+void VirtualArena::Decommit(size_t from) {
+    std::lock_guard<std::mutex> lock(m_CommitMutex);
+    size_t committed = m_Committed.load(std::memory_order_relaxed);
+    if (from >= committed) return;
+
+#if defined(AX_ARENA_MMAP)
+    madvise(m_Base + from, committed - from, MADV_DONTNEED);
+    mprotect(m_Base + from, committed - from, PROT_NONE);
+#elif defined(AX_ARENA_VIRTUALALLOC)
+    VirtualFree(m_Base + from, committed - from, MEM_DECOMMIT);
+#else
+    return; // Nothing to give back
+#endif
+    m_Committed.store(from, std::memory_order_release);
+}
+
+void* VirtualArena::Allocate(size_t size, size_t alignment) {
+    if (!m_Base) return nullptr;
+
+    auto base = reinterpret_cast<uintptr_t>(m_Base);
+    size_t offset = m_Offset.load(std::memory_order_relaxed);
+    size_t begin, end;
+    do {
+        begin = AlignUp(base + offset, alignment) - base;
+        end = begin + size;
+        if (end > m_Reserved || end < begin) return nullptr;
+    } while (!m_Offset.compare_exchange_weak(offset, end, std::memory_order_relaxed));
+
+    // The range stays claimed if committing fails (OS out of memory), a Rollback() past it reclaims it
+    if (end > m_Committed.load(std::memory_order_acquire) && !Commit(end)) return nullptr;
+
+    size_t peak = m_Peak.load(std::memory_order_relaxed);
+    while (end > peak && !m_Peak.compare_exchange_weak(peak, end, std::memory_order_relaxed)) {}
+
+#ifdef __AX_ALLOC_TRACKING__
+    m_Allocations.fetch_add(1, std::memory_order_relaxed);
+    AX_TRACK_ALLOC(AllocSource::Arena, m_Tag, end - offset, 1);
+#endif
+    return m_Base + begin;
+}
+
+ArenaMarker VirtualArena::GetMarker() const {
+    return {m_Offset.load(std::memory_order_relaxed), m_Allocations.load(std::memory_order_relaxed)};
+}
+
+void VirtualArena::Rollback(const ArenaMarker& marker) {
+    size_t offset = m_Offset.load(std::memory_order_relaxed);
+    if (marker.offset >= offset) return;
+
+#ifdef __AX_ALLOC_TRACKING__
+    AX_TRACK_FREE(AllocSource::Arena, m_Tag, offset - marker.offset, m_Allocations.load(std::memory_order_relaxed) - marker.allocations);
+#endif
+    m_Allocations.store(marker.allocations, std::memory_order_relaxed);
+    m_Offset.store(marker.offset, std::memory_order_relaxed);
+}
+
+void VirtualArena::Reset() {
+    Rollback({});
+    Decommit(AlignUp(m_Desc.retainOnReset, m_Desc.commitStep));
+}
+
+void* VirtualArena::do_allocate(size_t bytes, size_t alignment) {
+    void* ptr = Allocate(bytes, alignment);
+    if (!ptr) throw std::bad_alloc();
+    return ptr;
+}
+
+}
@@ -1,4 +1,5 @@
 #include "axle/core/app/AX_Application.hpp"
+#include "axle/core/alloc/AX_AllocTracker.hpp"
 #include "axle/core/window/AX_IWindow.hpp"
 
 #include "axle/graphics/ctx/AX_IRenderContext.hpp"
@@ -23,11 +24,24 @@
 #endif
 
 #include <algorithm>
+#include <cstdlib>
+#include <iostream>
 #include <memory>
+#include <mutex>
 
 namespace axle::core
 {
 
+#ifdef __AX_ALLOC_TRACKING__
+// Taken on the first InitCurrent(), along with registering the exit report. Statics set up before then are in the
+// baseline, and ones constructed afterwards are destroyed before the atexit handler runs, so neither shows as a leak.
+static AllocTrackerSnapshot s_LeakBaseline{};
+
+static void ReportLeaksAtExit() {
+    AllocTracker::ReportLeaks(std::cerr, s_LeakBaseline);
+}
+#endif
+
 // TODO: Support Android Cycles (NOTE: Main thread == UI) ASAP!!!
 utils::ExError Application::InitCurrent(
     ApplicationSpec spec,
@@ -37,6 +51,14 @@ utils::ExError Application::InitCurrent(
 ) {
     using namespace axle::utils;
 
+#ifdef __AX_ALLOC_TRACKING__
+    static std::once_flag s_LeakReportOnce;
+    std::call_once(s_LeakReportOnce, []() {
+        s_LeakBaseline = AllocTracker::Snapshot();
+        std::atexit(ReportLeaksAtExit);
+    });
+#endif
+
     // m_WndThread->SetCycleTimeCap(spec.fixedWndRate);
     utils::ExError wndRes = m_WndThread->StartApp([wndspec = std::move(spec.wndspec)]() -> ExResult<SharedPtr<IWindow>> {
         IWindow* wndPtr{nullptr};
@@ -49,7 +71,7 @@ utils::ExError Application::InitCurrent(
 #endif
         AX_PROPAGATE_ERROR(wndPtr->Launch());
         return SharedPtr<IWindow>(wndPtr);
-    });
+    }, spec.wndThreadSpec);
     if (wndRes.IsValid()) {
         return wndRes;
     }
@@ -58,6 +80,7 @@ utils::ExError Application::InitCurrent(
 
     auto wndCtx = m_WndThread->GetContext();
 
+    auto gfxThreadSpec = spec.gfxThreadSpec; // spec itself is moved into the creator below
     utils::ExError gfxRes = m_GfxThread->StartGfx([this, wndCtx, spec = std::move(spec)]() -> ExResult<SharedPtr<gfx::IGraphicsBackend>> {
         gfx::IRenderContext* ctxPtr{nullptr};
         int32_t combinedTypes = gfx::IRenderContext::CombinedTypes();
@@ -111,7 +134,7 @@ utils::ExError Application::InitCurrent(
             case gfx::GfxType::GL330: return {std::make_shared<gfx::GLGraphicsBackend>(gfxDesc)};
             default: ExError("Unsupported GfxType");
         }
-    });
+    }, 0.0f, false, std::move(gfxThreadSpec));
     if (gfxRes.IsValid()) {
         m_WndThread->Stop(true);
         return gfxRes;
@@ -119,24 +142,22 @@ utils::ExError Application::InitCurrent(
 
     m_GfxThread->AwaitStart();
 
+    m_Scheduler.Configure(spec.fixedTickRate, spec.maxCatchUpSteps);
+    m_Scheduler.SetStepCallback([this, &updateFunc, miscData](float dT) {
+        updateFunc(dT, *this, miscData);
+    });
+
     initFunc(*this, miscData);
 
     auto& state = *wndCtx->GetDiscreteState();
 
-    using namespace std::chrono;
-
-    auto tickRate = spec.fixedTickRate;
-    auto lastTime = steady_clock::now();
+    m_Scheduler.Reset();
     while (!state.IsQuitting()) {
-        auto now = steady_clock::now();
-        auto delta = duration_cast<ChMillis>(now - lastTime);
-        lastTime = now;
-        updateFunc(float(delta.count() / 1e9), *this, miscData);
-        if (tickRate.count() > 0) {
-            std::this_thread::sleep_for(ChMillis(std::max(tickRate.count() - delta.count(), (int64_t)0)));
-        }
+        m_Scheduler.Advance();
+        m_Scheduler.SleepUntilNextStep();
     }
-    
+    m_Scheduler.SetStepCallback(nullptr);
+
     if (m_GfxThread->IsRunning()) {
         m_GfxThread->Stop(true);
     }
@@ -144,7 +165,7 @@ utils::ExError Application::InitCurrent(
     if (m_WndThread->IsRunning()) {
         m_WndThread->Stop(true);
     }
-    
+
     return utils::ExError::NoError();
 }
 
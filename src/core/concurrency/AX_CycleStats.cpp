@@ -0,0 +1,104 @@
+#include "axle/core/concurrency/AX_CycleStats.hpp"
+
+#include <sstream>
+
+namespace axle::core
+{
+
+uint64_t HistogramSnapshot::Percentile(double p) const {
+    if (count == 0) return 0;
+    auto target = static_cast<uint64_t>(p * double(count - 1)) + 1;
+    uint64_t seen{0};
+    for (uint32_t i{0}; i < HistogramBuckets::COUNT; i++) {
+        seen += counts[i];
+        if (seen >= target) return std::min(HistogramBuckets::UpperBound(i), max);
+    }
+    return max;
+}
+
+HistogramSnapshot HistogramSnapshot::operator-(const HistogramSnapshot& older) const {
+    HistogramSnapshot delta;
+    for (uint32_t i{0}; i < HistogramBuckets::COUNT; i++) {
+        delta.counts[i] = counts[i] - older.counts[i];
+    }
+    delta.count = count - older.count;
+    delta.sum = sum - older.sum;
+    delta.max = max;
+    return delta;
+}
+
+HistogramSnapshot AtomicHistogram::Snapshot() const {
+    HistogramSnapshot snap;
+    for (uint32_t i{0}; i < HistogramBuckets::COUNT; i++) {
+        snap.counts[i] = m_Counts[i].load(std::memory_order_relaxed);
+    }
+    snap.count = m_Count.load(std::memory_order_relaxed);
+    snap.sum = m_Sum.load(std::memory_order_relaxed);
+    snap.max = m_Max.load(std::memory_order_relaxed);
+    return snap;
+}
+
+CycleStatsSnapshot CycleStats::Snapshot() const {
+    CycleStatsSnapshot snap;
+    snap.cycles = m_Cycles.load(std::memory_order_relaxed);
+    snap.deadlineMisses = m_DeadlineMisses.load(std::memory_order_relaxed);
+    snap.cycleTime = m_CycleTime.Snapshot();
+    snap.waitTime = m_WaitTime.Snapshot();
+    snap.tasksPerCycle = m_TasksPerCycle.Snapshot();
+    snap.queueDepth = m_QueueDepth.Snapshot();
+    return snap;
+}
+
+CycleStatsSnapshot CycleStatsSnapshot::operator-(const CycleStatsSnapshot& older) const {
+    CycleStatsSnapshot delta;
+    delta.cycleTime = cycleTime - older.cycleTime;
+    delta.waitTime = waitTime - older.waitTime;
+    delta.tasksPerCycle = tasksPerCycle - older.tasksPerCycle;
+    delta.queueDepth = queueDepth - older.queueDepth;
+    delta.cycles = cycles - older.cycles;
+    delta.deadlineMisses = deadlineMisses - older.deadlineMisses;
+    return delta;
+}
+
+static const char* const STAT_NAMES[] = {"cycle_ns", "wait_ns", "tasks", "queue_depth"};
+
+std::string CycleStatsSnapshot::CsvHeader() {
+    std::ostringstream out;
+    out << "name,cycles,deadline_misses";
+    for (auto* stat : STAT_NAMES) {
+        out << ',' << stat << "_mean," << stat << "_p50," << stat << "_p95," << stat << "_p99," << stat << "_max";
+    }
+    return out.str();
+}
+
+std::string CycleStatsSnapshot::ToCsvRow(std::string_view name) const {
+    std::ostringstream out;
+    out << name << ',' << cycles << ',' << deadlineMisses;
+    for (auto* hist : {&cycleTime, &waitTime, &tasksPerCycle, &queueDepth}) {
+        out << ',' << hist->Mean()
+            << ',' << hist->Percentile(0.50)
+            << ',' << hist->Percentile(0.95)
+            << ',' << hist->Percentile(0.99)
+            << ',' << hist->max;
+    }
+    return out.str();
+}
+
+std::string CycleStatsSnapshot::ToJson() const {
+    std::ostringstream out;
+    out << "{\"cycles\":" << cycles << ",\"deadline_misses\":" << deadlineMisses;
+    const HistogramSnapshot* hists[] = {&cycleTime, &waitTime, &tasksPerCycle, &queueDepth};
+    for (uint32_t i{0}; i < 4; i++) {
+        auto& hist = *hists[i];
+        out << ",\"" << STAT_NAMES[i] << "\":{"
+            << "\"mean\":" << hist.Mean()
+            << ",\"p50\":" << hist.Percentile(0.50)
+            << ",\"p95\":" << hist.Percentile(0.95)
+            << ",\"p99\":" << hist.Percentile(0.99)
+            << ",\"max\":" << hist.max << '}';
+    }
+    out << '}';
+    return out.str();
+}
+
+}
@@ -0,0 +1,305 @@
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+
+#include <algorithm>
+#include <bit>
+
+namespace axle::core
+{
+
+static thread_local JobSystem* t_JobSystem{nullptr};
+static thread_local int32_t t_WorkerIdx{-1};
+
+static ThreadSpec& GlobalSpec() {
+    static ThreadSpec s_Spec{.name = "AX Job"};
+    return s_Spec;
+}
+
+bool JobScheduleAwaiter::await_ready() const {
+    return jobs.IsWorkerThread();
+}
+
+void JobScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+    jobs.Run([handle]() { handle.resume(); });
+}
+
+WorkStealingDeque::WorkStealingDeque(uint32_t capacity) {
+    auto cap = std::bit_ceil(std::max(capacity, 2u));
+    m_Buffer = std::make_unique<std::atomic<JobEntry*>[]>(cap);
+    m_Mask = static_cast<int64_t>(cap) - 1;
+}
+
+bool WorkStealingDeque::Push(JobEntry* entry) {
+    int64_t b = m_Bottom.load(std::memory_order_relaxed);
+    int64_t t = m_Top.load(std::memory_order_acquire);
+    if (b - t > m_Mask) return false;
+
+    m_Buffer[b & m_Mask].store(entry, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    m_Bottom.store(b + 1, std::memory_order_relaxed);
+    return true;
+}
+
+JobEntry* WorkStealingDeque::Pop() {
+    int64_t b = m_Bottom.load(std::memory_order_relaxed) - 1;
+    m_Bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t t = m_Top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+        m_Bottom.store(b + 1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    JobEntry* entry = m_Buffer[b & m_Mask].load(std::memory_order_relaxed);
+    if (t == b) { // Last item, race against thieves
+        if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            entry = nullptr;
+        m_Bottom.store(b + 1, std::memory_order_relaxed);
+    }
+    return entry;
+}
+
+JobEntry* WorkStealingDeque::Steal() {
+    int64_t t = m_Top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t b = m_Bottom.load(std::memory_order_acquire);
+
+    if (t >= b) return nullptr;
+
+    JobEntry* entry = m_Buffer[t & m_Mask].load(std::memory_order_relaxed);
+    if (!m_Top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+    return entry;
+}
+
+JobSystem::JobSystem(uint32_t workerCount, const ThreadSpec& spec) {
+    if (workerCount == 0) {
+        auto hw = std::thread::hardware_concurrency();
+        workerCount = hw > 1 ? hw - 1 : 1;
+    }
+    m_Deques.reserve(workerCount);
+    for (uint32_t i{0}; i < workerCount; i++) {
+        m_Deques.push_back(std::make_unique<WorkStealingDeque>());
+    }
+    m_Workers.reserve(workerCount);
+    for (uint32_t i{0}; i < workerCount; i++) {
+        ThreadSpec workerSpec = spec;
+        if (!spec.name.empty()) {
+            workerSpec.name = spec.name + " " + std::to_string(i);
+        }
+        if (spec.cpus.size() >= workerCount) {
+            workerSpec.cpus = {spec.cpus[i]};
+        }
+        m_Workers.emplace_back([this, i, workerSpec = std::move(workerSpec)]() { WorkerLoop(i, workerSpec); });
+    }
+}
+
+JobSystem::~JobSystem() {
+    m_Running.store(false);
+    {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+    }
+    m_WakeCV.notify_all();
+    for (auto& worker : m_Workers) {
+        if (worker.joinable()) worker.join();
+    }
+}
+
+JobSystem& JobSystem::Global() {
+    static JobSystem s_Global{0, GlobalSpec()};
+    return s_Global;
+}
+
+void JobSystem::SetGlobalSpec(ThreadSpec spec) {
+    GlobalSpec() = std::move(spec);
+}
+
+utils::ExError JobSystem::GetSpecError() {
+    std::lock_guard<std::mutex> lock(m_SpecMutex);
+    return m_SpecError;
+}
+
+bool JobSystem::IsWorkerThread() const {
+    return t_JobSystem == this && t_WorkerIdx >= 0;
+}
+
+void JobSystem::WorkerLoop(uint32_t workerIdx, ThreadSpec spec) {
+    t_JobSystem = this;
+    t_WorkerIdx = static_cast<int32_t>(workerIdx);
+
+    if (auto err = ApplyThreadSpec(spec); err.IsValid()) {
+        std::lock_guard<std::mutex> lock(m_SpecMutex);
+        if (!m_SpecError.IsValid()) m_SpecError = err;
+    }
+
+    while (true) {
+        if (auto* entry = FindJob()) {
+            Execute(entry);
+            continue;
+        }
+        if (!m_Running.load(std::memory_order_relaxed))
+            break;
+
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_Sleeping.fetch_add(1);
+        m_WakeCV.wait(lock, [this]() {
+            return !m_Running.load(std::memory_order_relaxed) || m_Queued.load() > 0;
+        });
+        m_Sleeping.fetch_sub(1);
+    }
+}
+
+void JobSystem::Submit(JobEntry* entry) {
+    m_Queued.fetch_add(1);
+
+    if (!IsWorkerThread() || !m_Deques[t_WorkerIdx]->Push(entry)) {
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        m_Injected.push_back(entry);
+    }
+
+    if (m_Sleeping.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+        }
+        m_WakeCV.notify_one();
+    }
+}
+
+JobEntry* JobSystem::FindJob() {
+    JobEntry* entry{nullptr};
+    bool worker = IsWorkerThread();
+
+    if (worker) {
+        entry = m_Deques[t_WorkerIdx]->Pop();
+    }
+    if (!entry) {
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        if (!m_Injected.empty()) {
+            entry = m_Injected.front();
+            m_Injected.pop_front();
+        }
+    }
+    if (!entry) {
+        auto count = static_cast<uint32_t>(m_Deques.size());
+        auto start = worker ? static_cast<uint32_t>(t_WorkerIdx) + 1 : 0u;
+        for (uint32_t i{0}; i < count && !entry; i++) {
+            auto victim = (start + i) % count;
+            if (worker && victim == static_cast<uint32_t>(t_WorkerIdx)) continue;
+            entry = m_Deques[victim]->Steal();
+        }
+    }
+
+    if (entry) m_Queued.fetch_sub(1);
+    return entry;
+}
+
+JobEntry* JobSystem::FindJobFor(JobCounter& counter) {
+    JobEntry* entry{nullptr};
+    {
+        std::lock_guard<std::mutex> lock(m_InjectMutex);
+        auto it = std::find_if(m_Injected.begin(), m_Injected.end(), [&](JobEntry* e) { return e->counter == &counter; });
+        if (it == m_Injected.end()) return nullptr;
+        entry = *it;
+        m_Injected.erase(it);
+    }
+    m_Queued.fetch_sub(1);
+    return entry;
+}
+
+void JobSystem::Execute(JobEntry* entry) {
+    entry->job();
+    Release(entry->counter);
+    delete entry;
+}
+
+void JobSystem::Release(JobCounter* counter) {
+    if (!counter) return;
+
+    uint32_t pending = counter->m_Pending.load(std::memory_order_relaxed);
+    while (pending > 1) {
+        if (counter->m_Pending.compare_exchange_weak(pending, pending - 1, std::memory_order_acq_rel))
+            return;
+    }
+
+    // Last job: no other release can race us, take the continuations before dropping to zero
+    std::vector<JobEntry*> continuations;
+    {
+        std::lock_guard<std::mutex> lock(counter->m_ContinuationMutex);
+        continuations.swap(counter->m_Continuations);
+        counter->m_Sealed = true;
+    }
+    for (auto* entry : continuations) {
+        Submit(entry);
+    }
+    counter->m_Pending.fetch_sub(1); // The waiter may destroy the counter from here on
+
+    if (m_Sleeping.load() > 0) {
+        {
+            std::lock_guard<std::mutex> lock(m_WakeMutex);
+        }
+        m_WakeCV.notify_all();
+    }
+}
+
+void JobSystem::AddPending(JobCounter* counter) {
+    if (!counter || counter->m_Pending.fetch_add(1, std::memory_order_relaxed) != 0) return;
+    std::lock_guard<std::mutex> lock(counter->m_ContinuationMutex); // Reused after draining
+    counter->m_Sealed = false;
+}
+
+void JobSystem::Run(VoidJob job, JobCounter* counter) {
+    AddPending(counter);
+    Submit(new JobEntry{std::move(job), counter});
+}
+
+void JobSystem::RunAfter(JobCounter& dependency, VoidJob job, JobCounter* counter) {
+    AddPending(counter);
+    auto* entry = new JobEntry{std::move(job), counter};
+    {
+        std::lock_guard<std::mutex> lock(dependency.m_ContinuationMutex);
+        if (!dependency.m_Sealed && !dependency.IsDone()) {
+            dependency.m_Continuations.push_back(entry);
+            return;
+        }
+    }
+    Submit(entry);
+}
+
+void JobSystem::Wait(JobCounter& counter) {
+    bool worker = IsWorkerThread();
+    while (!counter.IsDone()) {
+        if (auto* entry = worker ? FindJob() : FindJobFor(counter)) {
+            Execute(entry);
+            continue;
+        }
+
+        // Released by the counter's last job, workers also wake for new jobs to help with
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_Sleeping.fetch_add(1);
+        m_WakeCV.wait(lock, [&]() {
+            return counter.m_Pending.load() == 0 || (worker && m_Queued.load() > 0);
+        });
+        m_Sleeping.fetch_sub(1);
+    }
+}
+
+void JobSystem::ParallelFor(uint32_t count, ParallelForFunc func, uint32_t grain) {
+    if (count == 0) return;
+    if (grain == 0) {
+        grain = std::max(1u, count / ((GetWorkerCount() + 1) * 4));
+    }
+    if (count <= grain) {
+        func(0, count);
+        return;
+    }
+
+    JobCounter counter;
+    for (uint32_t begin{grain}; begin < count; begin += grain) {
+        auto end = std::min(count, begin + grain);
+        Run([&func, begin, end]() { func(begin, end); }, &counter);
+    }
+    func(0, grain); // Caller takes the first chunk
+    Wait(counter);
+}
+
+}
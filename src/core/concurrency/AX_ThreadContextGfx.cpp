@@ -7,7 +7,7 @@
 namespace axle::core
 {
 
-utils::ExError ThreadContextGfx::StartGfx(CtxCreatorFunc initFunc, float frameCap, bool autoPresent) {
+utils::ExError ThreadContextGfx::StartGfx(CtxCreatorFunc initFunc, float frameCap, bool autoPresent, ThreadSpec spec) {
     m_IsAutoPresent.store(autoPresent);
     m_FrameCap.store(frameCap);
     
@@ -40,7 +40,7 @@ utils::ExError ThreadContextGfx::StartGfx(CtxCreatorFunc initFunc, float frameCa
             auto targetFrame = nanoseconds((int64_t)((1.0 / frameCap) * 1e9));
             auto targetTime = frameStart + targetFrame;
 
-            utils::Uni_NanoSleep(targetTime - steady_clock::now());
+            utils::Uni_SleepUntil(targetTime, GetSpinTail());
 
             now = steady_clock::now();
             delta = now - frameStart;
@@ -53,7 +53,7 @@ utils::ExError ThreadContextGfx::StartGfx(CtxCreatorFunc initFunc, float frameCa
         m_AccumulatedTime.fetch_add(deltaF);
     };
 
-    return StartSyncd(std::move(initFunc), std::move(constWk));
+    return StartSyncd(std::move(initFunc), std::move(constWk), std::move(spec));
 }
 
 }
\ No newline at end of file
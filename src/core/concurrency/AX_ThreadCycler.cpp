@@ -1,5 +1,6 @@
 #include "axle/core/concurrency/AX_ThreadCycler.hpp"
 
+#include "axle/core/profile/AX_Profiler.hpp"
 #include "axle/core/window/AX_IWindow.hpp"
 
 #include "axle/utils/AX_Types.hpp"
@@ -16,17 +17,35 @@
 namespace axle::core
 {
 
+static thread_local FrameAllocator* t_FrameArena{nullptr};
+
+std::pmr::memory_resource* ThreadCycler::CurrentFrameResource() {
+    if (t_FrameArena) return t_FrameArena;
+    return std::pmr::get_default_resource();
+}
+
+bool CycleScheduleAwaiter::await_ready() const {
+    return thread.ValidateThread();
+}
+
+void CycleScheduleAwaiter::await_suspend(std::coroutine_handle<> handle) const {
+    thread.EnqueueTask([handle]() { handle.resume(); });
+}
+
 ThreadCycler::~ThreadCycler() {
     Stop();
 }
 
-void ThreadCycler::Start() {
+void ThreadCycler::Start(ThreadSpec spec) {
     std::lock_guard<std::mutex> lock(m_LifeCycleMutex);
     if (m_Running.load()) return;
     m_Running.store(true);
+    m_Spec = std::move(spec);
     m_Thread = std::thread([this]() {
+        auto specErr = ApplyThreadSpec(m_Spec);
         {
             std::lock_guard<std::mutex> lock(m_StateMutex);
+            m_SpecError = specErr;
             m_Started = true;
         }
         m_StateCV.notify_all();
@@ -49,6 +68,7 @@ void ThreadCycler::Stop(bool join) {
         m_Running.store(false);
         if (m_Stopped) return;
     }
+    Wake();
     if (join && m_Thread.joinable())
         m_Thread.join();
 }
@@ -61,33 +81,49 @@ bool ThreadCycler::ValidateThread() {
     return m_Running.load() && std::this_thread::get_id() == m_Thread.get_id();
 }
 
-void ThreadCycler::EnqueueTask(std::function<void()> func) {
-    std::lock_guard<std::mutex> lock(m_CycleMutex);
-    m_CycleTasks.push_back(std::move(func));
+void ThreadCycler::EnqueueTask(CycleTask task) {
+    m_Inbox.Push(std::move(task));
+    Wake();
+}
+
+void ThreadCycler::Wake() {
+    m_WakePending.store(true);
+    if (m_Idling.load()) {
+        std::lock_guard<std::mutex> lock(m_WakeMutex);
+        m_WakeCV.notify_one();
+    }
 }
 
 WorkHandle ThreadCycler::CreateWork(VoidJob job, WorkId after) {
     std::lock_guard<std::mutex> lock(m_CycleMutex);
-    auto res = m_CycleWorks.Reserve(after);
-    res->job = job;
-    res->Sign();
-    return res->External();
+    auto handle = m_CycleWorks.InsertAfter(after, std::make_shared<const VoidJob>(std::move(job)));
+    RebuildWorkSnapshot();
+    Wake();
+    return handle;
 }
 
 void ThreadCycler::RemoveWork(WorkHandle wh) {
     std::lock_guard<std::mutex> lock(m_CycleMutex);
-    m_CycleWorks.Delete(wh);
+    if (!m_CycleWorks.Erase(wh)) return;
+    RebuildWorkSnapshot();
+    Wake();
 }
 
 void ThreadCycler::MoveWorkToEnd(WorkHandle wh) {
     std::lock_guard<std::mutex> lock(m_CycleMutex);
-    m_CycleWorks.ModifyOrder([whCpy = wh](std::vector<utils::MagicId>& order) {
-        auto it = std::find(order.begin(), order.end(), whCpy.index);
-        if (it == order.end()) return;
+    m_CycleWorks.MoveToBack(wh);
+    RebuildWorkSnapshot();
+    Wake();
+}
 
-        order.erase(it);
-        order.push_back(whCpy.index);
+void ThreadCycler::RebuildWorkSnapshot() {
+    auto snapshot = std::make_shared<std::vector<SharedPtr<const VoidJob>>>();
+    snapshot->reserve(m_CycleWorks.Size());
+    m_CycleWorks.ForEachOrdered([&snapshot](WorkHandle, const SharedPtr<const VoidJob>& job) {
+        snapshot->push_back(job);
     });
+    m_WorkSnapshot = std::move(snapshot);
+    m_WorkVersion++;
 }
 
 void ThreadCycler::AwaitStart() {
@@ -120,66 +156,144 @@ void ThreadCycler::SetCycleTimeCap(ChNanos nano_seconds) {
     m_CycleTimeCap = nano_seconds;
 }
 
+ChNanos ThreadCycler::GetSpinTail() {
+    std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
+    return m_SpinTail;
+}
+
+void ThreadCycler::SetSpinTail(ChNanos spinTail) {
+    std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
+    m_SpinTail = spinTail;
+}
+
+bool ThreadCycler::IsIdleWait() {
+    std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
+    return m_IdleWait;
+}
+
+void ThreadCycler::SetIdleWait(bool idleWait, ChNanos idleTimeout) {
+    {
+        std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
+        m_IdleWait = idleWait;
+        m_IdleTimeout = idleTimeout;
+    }
+    Wake();
+}
+
+void ThreadCycler::IdleWait(ChSteadyTimepoint deadline, ChNanos spinTail) {
+    bool woken;
+    {
+        std::unique_lock<std::mutex> lock(m_WakeMutex);
+        m_Idling.store(true);
+
+        auto pred = [this]() { return m_WakePending.load() || !m_Running.load(); };
+        if (deadline == ChSteadyTimepoint::max()) {
+            m_WakeCV.wait(lock, pred);
+            woken = true;
+        } else {
+            woken = m_WakeCV.wait_until(lock, deadline - spinTail, pred);
+        }
+        m_Idling.store(false);
+    }
+    m_WakePending.store(false); // Cleared before the next drain, so nothing enqueued after this is missed
+
+    if (!woken) {
+        while (ChSteadyClock::now() < deadline)
+            utils::Uni_CpuRelax();
+    }
+}
+
 void ThreadCycler::DoCycle() {
-    std::deque<VoidJob> localTasks;
+    std::vector<CycleTask> localTasks;
 
-    std::vector<WorkSlot> localWorkSlots;
-    std::vector<WorkId> localWorkOrder;
+    SharedPtr<const std::vector<SharedPtr<const VoidJob>>> localWorks{nullptr};
+    uint64_t localWorkVersion{UINT64_MAX};
 
     using namespace std::chrono;
 
     auto cycleBegin = steady_clock::now(), cycleEnd = steady_clock::now();
 
+    t_FrameArena = m_FrameArena.get();
+
     while (m_Running.load(std::memory_order_relaxed)) {
+        m_FrameArena->BeginFrame();
+        m_Inbox.Drain(localTasks);
         {
             std::lock_guard<std::mutex> lock(m_CycleMutex);
-            localTasks = m_CycleTasks;
-            m_CycleTasks.clear();
-
-            const auto& workSlots = m_CycleWorks.GetInternal();
-            const auto& workOrder = m_CycleWorks.GetOrder();
-            localWorkSlots = workSlots;
-            localWorkOrder = workOrder;
+            if (localWorkVersion != m_WorkVersion) {
+                localWorks = m_WorkSnapshot;
+                localWorkVersion = m_WorkVersion;
+            }
         }
 
         cycleBegin = steady_clock::now();
-        for (auto& job : localTasks) {
-            job();
+        auto taskCount = static_cast<uint32_t>(localTasks.size());
+        {
+            AX_PROFILE_SCOPE("ThreadCycler::Tasks");
+            for (auto& job : localTasks) {
+                job();
+            }
+            localTasks.clear(); // Keeps capacity for the next drain
         }
-        for (const WorkId& hId : localWorkOrder) {
-            localWorkSlots[hId].job();
+        auto queueDepth = static_cast<uint32_t>(m_Inbox.ApproxSize());
+        {
+            AX_PROFILE_SCOPE("ThreadCycler::Works");
+            for (const auto& job : *localWorks) {
+                (*job)();
+            }
         }
         cycleEnd = steady_clock::now();
 
-        auto cycleTimeCap{ChNanos(0)};
+        auto cycleTimeCap{ChNanos(0)}, spinTail{ChNanos(0)}, idleTimeout{ChNanos(0)};
+        bool idleWait{false};
         {
             std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
             cycleTimeCap = m_CycleTimeCap;
+            spinTail = m_SpinTail;
+            idleWait = m_IdleWait;
+            idleTimeout = m_IdleTimeout;
         }
 
-        auto targetTime = cycleBegin + cycleTimeCap;
-        utils::Uni_NanoSleep(targetTime - steady_clock::now());
+        if (idleWait) {
+            auto deadline = ChSteadyTimepoint::max();
+            if (cycleTimeCap > ChNanos(0)) {
+                deadline = cycleBegin + cycleTimeCap;
+            } else if (idleTimeout > ChNanos(0)) {
+                deadline = steady_clock::now() + idleTimeout;
+            }
+            IdleWait(deadline, spinTail);
+        } else {
+            utils::Uni_SleepUntil(cycleBegin + cycleTimeCap, spinTail);
+        }
 
+        auto waitEnd = steady_clock::now();
         {
             std::lock_guard<std::mutex> lock(m_CycleTimeMutex);
 
             m_LastCycleTimeBegin = cycleBegin;
-            m_LastCycleTimeEnd = steady_clock::now();
+            m_LastCycleTimeEnd = waitEnd;
         }
+
+        auto cycleTime = cycleEnd - cycleBegin;
+        m_Stats.RecordCycle(cycleTime, waitEnd - cycleEnd, taskCount, queueDepth,
+            cycleTimeCap > ChNanos(0) && cycleTime > cycleTimeCap);
     }
+
+    t_FrameArena = nullptr;
 }
 
 utils::ExError ThreadContextGeneric::StartCycle(
     std::function<SharedPtr<EmptyStruct>()> initFunc,
-    std::function<void(EmptyStruct& gctx)> constWork
+    std::function<void(EmptyStruct& gctx)> constWork,
+    ThreadSpec spec
 ) {
     auto constWk = [this, constWork = constWork](){ if (m_Ctx) constWork(*m_Ctx.get()); };
-    return StartSyncd(std::move(initFunc), std::move(constWk));
+    return StartSyncd(std::move(initFunc), std::move(constWk), std::move(spec));
 }
 
-utils::ExError ThreadContextWnd::StartApp(CtxCreatorFunc initFunc) {
+utils::ExError ThreadContextWnd::StartApp(CtxCreatorFunc initFunc, ThreadSpec spec) {
     auto constWk = [this](){ if (m_Ctx) m_Ctx->PollEvents(); };
-    return StartSyncd(std::move(initFunc), std::move(constWk));
+    return StartSyncd(std::move(initFunc), std::move(constWk), std::move(spec));
 }
 
 void ThreadContextWnd::SignalWindow() {
@@ -0,0 +1,179 @@
+#include "axle/core/concurrency/AX_ThreadSpec.hpp"
+
+#include "axle/core/profile/AX_Profiler.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#elif defined(_WIN32)
+#define WIN32_LEAN_AND_MEAN
+#include <windows.h>
+#elif defined(__APPLE__)
+#include <pthread.h>
+#endif
+
+namespace axle::core
+{
+
+static constexpr uint32_t MAX_CPU_INDEX = 1u << 16;
+
+static bool ParseCpuIndex(std::string_view text, uint32_t& out) {
+    auto res = std::from_chars(text.data(), text.data() + text.size(), out);
+    return res.ec == std::errc{} && res.ptr == text.data() + text.size() && !text.empty() && out < MAX_CPU_INDEX;
+}
+
+utils::ExResult<std::vector<uint32_t>> ParseCpuList(std::string_view list) {
+    while (!list.empty() && (list.back() == '\n' || list.back() == '\r' || list.back() == ' ')) list.remove_suffix(1);
+
+    std::vector<uint32_t> cpus;
+    while (!list.empty()) {
+        auto comma = list.find(',');
+        std::string_view range = list.substr(0, comma);
+        list = comma == std::string_view::npos ? std::string_view{} : list.substr(comma + 1);
+        if (range.empty()) continue;
+
+        auto dash = range.find('-');
+        uint32_t first{0}, last{0};
+        if (!ParseCpuIndex(range.substr(0, dash), first) ||
+            !ParseCpuIndex(dash == std::string_view::npos ? range : range.substr(dash + 1), last) || last < first) {
+            return utils::ExError("Malformed cpulist entry: " + std::string(range));
+        }
+        for (uint32_t cpu{first}; cpu <= last; cpu++) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+utils::ExResult<std::vector<uint32_t>> GetNumaNodeCpus(int32_t node) {
+#if defined(__linux__)
+    if (node < 0) return std::vector<uint32_t>{};
+    std::ifstream in("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!in.is_open() || !std::getline(in, list)) return std::vector<uint32_t>{};
+    return ParseCpuList(list);
+#else
+    (void)node;
+    return std::vector<uint32_t>{};
+#endif
+}
+
+utils::ExError ApplyThreadSpec(const ThreadSpec& spec) {
+    if (spec.IsDefault()) return utils::ExError::NoError();
+
+    utils::ExError firstErr = utils::ExError::NoError();
+    auto fail = [&firstErr](std::string msg) {
+        if (!firstErr.IsValid()) firstErr = utils::ExError(std::move(msg));
+    };
+
+    std::vector<uint32_t> cpus = spec.cpus;
+    if (spec.numaNode >= 0) {
+        auto nodeRes = GetNumaNodeCpus(spec.numaNode);
+        std::vector<uint32_t> nodeCpus = nodeRes.has_value() ? std::move(nodeRes.value()) : std::vector<uint32_t>{};
+        if (!nodeRes.has_value()) {
+            fail("ApplyThreadSpec: NUMA node " + std::to_string(spec.numaNode) + ": " + std::string(nodeRes.error().GetMessage()));
+        } else if (nodeCpus.empty()) {
+            fail("ApplyThreadSpec: NUMA node " + std::to_string(spec.numaNode) + " not found");
+        } else if (cpus.empty()) {
+            cpus = std::move(nodeCpus);
+        } else {
+            std::erase_if(cpus, [&nodeCpus](uint32_t cpu) {
+                return std::find(nodeCpus.begin(), nodeCpus.end(), cpu) == nodeCpus.end();
+            });
+            if (cpus.empty()) fail("ApplyThreadSpec: No requested CPU belongs to the NUMA node");
+        }
+    }
+
+    if (!spec.name.empty()) {
+        AX_PROFILE_THREAD(spec.name);
+    }
+    AllocTracker::SetCurrentTag(spec.allocTag);
+
+#if defined(__linux__)
+    auto self = pthread_self();
+
+    if (!spec.name.empty()) {
+        auto name = spec.name.substr(0, 15);
+        if (int err = pthread_setname_np(self, name.c_str()))
+            fail("ApplyThreadSpec: pthread_setname_np failed: " + std::string(std::strerror(err)));
+    }
+
+    if (!cpus.empty()) {
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        for (auto cpu : cpus) {
+            if (cpu < CPU_SETSIZE) CPU_SET(cpu, &set);
+        }
+        if (int err = pthread_setaffinity_np(self, sizeof(set), &set))
+            fail("ApplyThreadSpec: pthread_setaffinity_np failed: " + std::string(std::strerror(err)));
+    }
+
+    if (spec.numaNode >= 0) {
+        constexpr int MPOL_PREFERRED_MODE = 1; // <numaif.h> without linking libnuma
+        unsigned long nodeMask[16]{};
+        auto node = static_cast<uint32_t>(spec.numaNode);
+        if (node < sizeof(nodeMask) * 8) {
+            nodeMask[node / (sizeof(unsigned long) * 8)] |= 1ul << (node % (sizeof(unsigned long) * 8));
+            if (syscall(SYS_set_mempolicy, MPOL_PREFERRED_MODE, nodeMask, sizeof(nodeMask) * 8) != 0)
+                fail("ApplyThreadSpec: set_mempolicy failed: " + std::string(std::strerror(errno)));
+        }
+    }
+
+    if (spec.policy == ThreadSchedPolicy::Fifo) {
+        sched_param param{};
+        param.sched_priority = std::clamp(spec.priority,
+            sched_get_priority_min(SCHED_FIFO), sched_get_priority_max(SCHED_FIFO));
+        if (int err = pthread_setschedparam(self, SCHED_FIFO, &param))
+            fail("ApplyThreadSpec: SCHED_FIFO failed: " + std::string(std::strerror(err)));
+    } else if (spec.priority != 0) {
+        // Linux nice values are per-thread when addressed by tid
+        auto tid = static_cast<id_t>(syscall(SYS_gettid));
+        if (setpriority(PRIO_PROCESS, tid, std::clamp(spec.priority, -20, 19)) != 0)
+            fail("ApplyThreadSpec: setpriority failed: " + std::string(std::strerror(errno)));
+    }
+#elif defined(_WIN32)
+    auto self = GetCurrentThread();
+
+    if (!spec.name.empty()) {
+        std::wstring wname(spec.name.begin(), spec.name.end());
+        SetThreadDescription(self, wname.c_str());
+    }
+
+    if (!cpus.empty()) {
+        DWORD_PTR mask{0};
+        for (auto cpu : cpus) {
+            if (cpu < sizeof(DWORD_PTR) * 8) mask |= DWORD_PTR(1) << cpu;
+        }
+        if (!mask || !SetThreadAffinityMask(self, mask))
+            fail("ApplyThreadSpec: SetThreadAffinityMask failed");
+    }
+
+    if (spec.policy == ThreadSchedPolicy::Fifo || spec.priority != 0) {
+        int level = THREAD_PRIORITY_NORMAL;
+        if (spec.policy == ThreadSchedPolicy::Fifo) level = THREAD_PRIORITY_TIME_CRITICAL;
+        else if (spec.priority <= -10) level = THREAD_PRIORITY_HIGHEST;
+        else if (spec.priority < 0) level = THREAD_PRIORITY_ABOVE_NORMAL;
+        else if (spec.priority >= 10) level = THREAD_PRIORITY_LOWEST;
+        else level = THREAD_PRIORITY_BELOW_NORMAL;
+        if (!SetThreadPriority(self, level))
+            fail("ApplyThreadSpec: SetThreadPriority failed");
+    }
+#elif defined(__APPLE__)
+    if (!spec.name.empty()) {
+        pthread_setname_np(spec.name.c_str());
+    }
+    // No affinity / NUMA API on Darwin, priorities are left to QoS classes
+#endif
+    return firstErr;
+}
+
+}
@@ -0,0 +1,147 @@
+#include "axle/core/profile/AX_Profiler.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <fstream>
+#include <iomanip>
+#include <thread>
+
+namespace axle::core
+{
+
+static thread_local ProfileRing* t_ProfileRing{nullptr};
+
+ProfileRing::ProfileRing(uint32_t threadIdx, uint32_t capacity)
+    : m_ThreadIdx(threadIdx), m_ThreadName("Thread " + std::to_string(threadIdx)) {
+    auto cap = std::bit_ceil(std::max(capacity, 2u));
+    m_Zones = std::make_unique<ProfileZone[]>(cap);
+    m_Mask = cap - 1;
+}
+
+void ProfileRing::Snapshot(std::vector<ProfileZone>& out) const {
+    auto headBefore = m_Head.load(std::memory_order_acquire);
+    auto cap = m_Mask + 1;
+    auto first = headBefore > cap ? headBefore - cap : 0;
+    auto offset = out.size();
+    for (auto i = first; i < headBefore; i++) {
+        out.push_back(m_Zones[i & m_Mask]);
+    }
+    // Writer lapped part of the copy. Slot headAfter - cap is the one being written next, so it may be torn too;
+    // only slots strictly newer than it are kept.
+    auto headAfter = m_Head.load(std::memory_order_acquire);
+    if (headAfter + 1 > cap && headAfter + 1 - cap > first) {
+        auto lost = std::min(headAfter + 1 - cap - first, headBefore - first);
+        out.erase(out.begin() + offset, out.begin() + offset + lost);
+    }
+}
+
+Profiler::Profiler() {
+    m_EpochTicks = Now();
+    m_EpochTime = ChSteadyClock::now();
+}
+
+Profiler& Profiler::Get() {
+    static Profiler s_Profiler{};
+    return s_Profiler;
+}
+
+void Profiler::SetRingCapacity(uint32_t zones) {
+    std::lock_guard<std::mutex> lock(m_RingsMutex);
+    m_RingCapacity = zones;
+}
+
+ProfileRing* Profiler::RegisterThread() {
+    std::lock_guard<std::mutex> lock(m_RingsMutex);
+    auto idx = static_cast<uint32_t>(m_Rings.size());
+    m_Rings.push_back(std::make_unique<ProfileRing>(idx, m_RingCapacity));
+    return m_Rings.back().get();
+}
+
+ProfileRing& Profiler::GetThreadRing() {
+    if (!t_ProfileRing) {
+        t_ProfileRing = RegisterThread();
+    }
+    return *t_ProfileRing;
+}
+
+void Profiler::SetThreadName(std::string_view name) {
+    auto& ring = GetThreadRing();
+    std::lock_guard<std::mutex> lock(m_RingsMutex);
+    ring.m_ThreadName = name;
+}
+
+double Profiler::TicksPerNano() const {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    auto ticks = Now() - m_EpochTicks;
+    auto nanos = std::chrono::duration_cast<ChNanos>(ChSteadyClock::now() - m_EpochTime).count();
+    if (nanos < 1000000) { // Too short to calibrate against, stretch it
+        std::this_thread::sleep_for(ChMillis(10));
+        ticks = Now() - m_EpochTicks;
+        nanos = std::chrono::duration_cast<ChNanos>(ChSteadyClock::now() - m_EpochTime).count();
+    }
+    return double(ticks) / double(nanos);
+#else
+    return 1.0;
+#endif
+}
+
+static void WriteJsonString(std::ofstream& out, std::string_view str) {
+    out << '"';
+    for (char c : str) {
+        switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            default:
+                if (static_cast<unsigned char>(c) >= 0x20) out << c;
+        }
+    }
+    out << '"';
+}
+
+utils::ExError Profiler::WriteChromeTrace(const std::filesystem::path& path) {
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        return utils::ExError("Profiler::WriteChromeTrace Failed: Cannot open " + path.string());
+    }
+
+    double ticksPerUs = TicksPerNano() * 1000.0;
+    std::vector<ProfileZone> zones;
+    bool first = true;
+
+    out << std::fixed << std::setprecision(3);
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[";
+    std::lock_guard<std::mutex> lock(m_RingsMutex);
+    for (auto& ring : m_Rings) {
+        out << (first ? "" : ",") << "\n{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":1,\"tid\":" << ring->m_ThreadIdx << ",\"args\":{\"name\":";
+        WriteJsonString(out, ring->m_ThreadName);
+        out << "}}";
+        first = false;
+
+        zones.clear();
+        ring->Snapshot(zones);
+        for (auto& zone : zones) {
+            auto ts = double(zone.begin - m_EpochTicks) / ticksPerUs;
+            auto dur = double(zone.end - zone.begin) / ticksPerUs;
+            out << ",\n{\"ph\":\"X\",\"name\":";
+            WriteJsonString(out, zone.name);
+            out << ",\"pid\":1,\"tid\":" << ring->m_ThreadIdx << ",\"ts\":" << ts << ",\"dur\":" << dur << "}";
+        }
+    }
+    out << "\n]}\n";
+
+    if (!out.good()) {
+        return utils::ExError("Profiler::WriteChromeTrace Failed: Write error on " + path.string());
+    }
+    return utils::ExError::NoError();
+}
+
+void Profiler::Clear() {
+    std::lock_guard<std::mutex> lock(m_RingsMutex);
+    for (auto& ring : m_Rings) {
+        // Not synchronized with the writer, only meant between captures
+        ring->m_Head.store(0, std::memory_order_release);
+    }
+}
+
+}
@@ -0,0 +1,693 @@
+#include "axle/data/AX_AsyncIO.hpp"
+
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/core/concurrency/AX_ThreadSpec.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <new>
+#include <string>
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AX_AIO_POSIX
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#define AX_AIO_URING
+#endif
+#elif defined(_WIN32)
+#include <windows.h>
+#define AX_AIO_WIN32
+#endif
+
+namespace axle::data
+{
+
+void detail::IOState::Fail(const utils::ExError& err) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (error.IsNoError()) error = err;
+}
+
+void detail::IOState::Finish(uint64_t read, bool deferResume) {
+    bytes.fetch_add(read, std::memory_order_relaxed);
+    if (pending.fetch_sub(1, std::memory_order_acq_rel) != 1) return;
+
+    std::vector<std::coroutine_handle<>> handles{};
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        done = true;
+        handles.swap(waiters);
+    }
+    cv.notify_all();
+    for (auto handle : handles) {
+        if (deferResume) core::JobSystem::Global().Run([handle]() { handle.resume(); });
+        else handle.resume();
+    }
+}
+
+static utils::ExError SysError(const char* what, const std::filesystem::path& path, int err) {
+    return {err, std::string(what) + ": " + path.string() + " Error: " + std::strerror(err)};
+}
+
+utils::ExResult<SharedPtr<AsyncFile>> AsyncFile::Open(const std::filesystem::path& path, bool direct) {
+    SharedPtr<AsyncFile> file(new AsyncFile());
+#if defined(AX_AIO_POSIX)
+    int fd{-1};
+#if defined(O_DIRECT)
+    if (direct) {
+        fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC | O_DIRECT);
+        file->m_Direct = fd >= 0;
+    }
+#endif
+    if (fd < 0) fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC); // No direct support (tmpfs, macOS)
+    if (fd < 0) return SysError("Failed to open file", path, errno);
+    file->m_Fd = fd;
+
+    struct stat st{};
+    if (fstat(fd, &st) != 0) return SysError("Failed to get file status for", path, errno);
+    file->m_Size = uint64_t(st.st_size);
+#elif defined(AX_AIO_WIN32)
+    DWORD flags = FILE_ATTRIBUTE_NORMAL | (direct ? FILE_FLAG_NO_BUFFERING : 0);
+    HANDLE handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, flags, nullptr);
+    file->m_Direct = direct && handle != INVALID_HANDLE_VALUE;
+    if (handle == INVALID_HANDLE_VALUE && direct) {
+        handle = CreateFileW(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    }
+    if (handle == INVALID_HANDLE_VALUE) return utils::ExError{int32_t(GetLastError()), "Failed to open file: " + path.string()};
+    file->m_Handle = handle;
+
+    LARGE_INTEGER size{};
+    if (!GetFileSizeEx(handle, &size)) return utils::ExError{int32_t(GetLastError()), "Failed to get file size for: " + path.string()};
+    file->m_Size = uint64_t(size.QuadPart);
+#endif
+    return file;
+}
+
+AsyncFile::~AsyncFile() {
+#if defined(AX_AIO_POSIX)
+    if (m_Fd >= 0) ::close(m_Fd);
+#elif defined(AX_AIO_WIN32)
+    if (m_Handle) CloseHandle(m_Handle);
+#endif
+}
+
+// Where a short read stopping before the end of file resumes. Direct reads need their offset and length aligned
+// again, so the unaligned tail is read once more; false when one did not even get past the next boundary
+static bool ResumeShortRead(const AsyncFile& file, uint64_t before, uint64_t& done) {
+    if (!file.IsDirect()) return true;
+    uint64_t aligned = done & ~(AsyncFile::DIRECT_ALIGNMENT - 1);
+    if (aligned <= before) return false;
+    done = aligned;
+    return true;
+}
+
+// Blocking positional read, retried until `size` bytes or end of file
+static utils::ExResult<uint64_t> PRead(const AsyncFile& file, uint8_t* dst, uint64_t size, uint64_t offset) {
+    uint64_t done{0};
+    // Stops at the end of file, direct reads past it would be misaligned
+    while (done < size && offset + done < file.GetSize()) {
+#if defined(AX_AIO_POSIX)
+        ssize_t n = ::pread(file.GetHandle(), dst + done, size_t(size - done), off_t(offset + done));
+        if (n < 0) {
+            if (errno == EINTR) continue;
+            return utils::ExError{errno, std::string("pread failed: ") + std::strerror(errno)};
+        }
+#elif defined(AX_AIO_WIN32)
+        OVERLAPPED overlapped{};
+        overlapped.Offset = DWORD(offset + done);
+        overlapped.OffsetHigh = DWORD((offset + done) >> 32);
+        DWORD n{0};
+        DWORD chunk = DWORD(std::min<uint64_t>(size - done, 1u << 30));
+        if (!::ReadFile(file.GetHandle(), dst + done, chunk, &n, &overlapped) && GetLastError() != ERROR_HANDLE_EOF) {
+            return utils::ExError{int32_t(GetLastError()), "ReadFile failed"};
+        }
+#else
+        int64_t n = 0;
+#endif
+        if (n == 0) break;
+        uint64_t before = done;
+        done += uint64_t(n);
+        if (done < size && offset + done < file.GetSize() && !ResumeShortRead(file, before, done)) {
+            return utils::ExError{EIO, "Direct read stopped short of an aligned boundary"};
+        }
+    }
+    return done;
+}
+
+// One read of a submission; `file` is null for ReadFile() requests the worker still has to open
+struct IORequest {
+    SharedPtr<detail::IOState> state;
+    SharedPtr<AsyncFile> file;
+    std::filesystem::path path{};
+    uint8_t* dst{nullptr};
+    uint64_t size{0};
+    uint64_t offset{0};
+    uint64_t done{0};
+#if defined(AX_AIO_URING)
+    iovec iov{};
+#endif
+};
+
+// Zero-initialized bytes are not needed for I/O destinations, direct reads need aligned ones
+static utils::URaw AllocateFileBuffer(uint64_t size, bool direct, uint8_t*& dst, uint64_t& readSize) {
+    readSize = direct ? (size + AsyncFile::DIRECT_ALIGNMENT - 1) & ~(AsyncFile::DIRECT_ALIGNMENT - 1) : size;
+    SharedPtr<uint8_t> owner;
+    if (direct) {
+        auto* bytes = static_cast<uint8_t*>(::operator new(size_t(std::max<uint64_t>(readSize, 1)), std::align_val_t(AsyncFile::DIRECT_ALIGNMENT)));
+        owner = SharedPtr<uint8_t>(bytes, [](uint8_t* p) { ::operator delete(p, std::align_val_t(AsyncFile::DIRECT_ALIGNMENT)); });
+    } else {
+        owner = SharedPtr<uint8_t>(new uint8_t[size_t(std::max<uint64_t>(size, 1))], std::default_delete<uint8_t[]>());
+    }
+    dst = owner.get();
+    return utils::URaw(utils::SharedBuffer<uint8_t>::Adopt(dst, size_t(size), std::move(owner)));
+}
+
+// Prepares a ReadFile() request once its file is open
+static utils::ExError PrepareFileRead(IORequest& req, uint64_t directThreshold) {
+    if (!req.file) {
+        std::error_code sizeErr;
+        uint64_t size = std::filesystem::file_size(req.path, sizeErr);
+        bool direct = directThreshold > 0 && !sizeErr && size >= directThreshold;
+        AX_DECL_OR_PROPAGATE(file, AsyncFile::Open(req.path, direct));
+        req.file = std::move(file);
+    }
+    req.state->data = AllocateFileBuffer(req.file->GetSize(), req.file->IsDirect(), req.dst, req.size);
+    req.offset = 0;
+    return utils::ExError::NoError();
+}
+
+// Completes a request: a ReadFile() short of the file size is an error, a plain read just reports fewer bytes
+static void CompleteRequest(IORequest* req, bool deferResume = false) {
+    if (req->state->data.data() && req->done < req->state->data.size()) {
+        req->state->Fail(utils::ExError{-5, "Unexpected EOF: " + req->path.string()});
+    }
+    uint64_t read = req->state->data.data() ? std::min<uint64_t>(req->done, req->state->data.size()) : req->done;
+    auto state = std::move(req->state);
+    delete req;
+    state->Finish(read, deferResume);
+}
+
+struct detail::IOBackend {
+    virtual ~IOBackend() = default;
+    virtual AsyncIOBackend Kind() const = 0;
+    virtual void Submit(std::vector<IORequest*>& requests) = 0;
+};
+
+// pread workers fed from one queue
+struct ThreadPoolBackend final : detail::IOBackend {
+    std::deque<IORequest*> queue{};
+    std::mutex mutex{};
+    std::condition_variable cv{};
+    bool stopping{false};
+    uint64_t directThreshold;
+    std::vector<std::thread> workers{};
+
+    ThreadPoolBackend(uint32_t workerCount, uint64_t directThreshold) : directThreshold(directThreshold) {
+        for (uint32_t i{0}; i < std::max(workerCount, 1u); i++) {
+            workers.emplace_back([this, i]() {
+                core::ApplyThreadSpec({.name = "AX IO " + std::to_string(i), .allocTag = core::AllocTag::Assets});
+                WorkerLoop();
+            });
+        }
+    }
+
+    ~ThreadPoolBackend() override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            stopping = true;
+        }
+        cv.notify_all();
+        for (auto& worker : workers) worker.join();
+    }
+
+    AsyncIOBackend Kind() const override { return AsyncIOBackend::ThreadPool; }
+
+    void Submit(std::vector<IORequest*>& requests) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            queue.insert(queue.end(), requests.begin(), requests.end());
+        }
+        if (requests.size() == 1) cv.notify_one();
+        else cv.notify_all();
+    }
+
+    void WorkerLoop() {
+        while (true) {
+            IORequest* req{nullptr};
+            {
+                std::unique_lock<std::mutex> lock(mutex);
+                cv.wait(lock, [this]() { return stopping || !queue.empty(); });
+                if (queue.empty()) return; // Stopping with nothing left
+                req = queue.front();
+                queue.pop_front();
+            }
+            Process(req);
+        }
+    }
+
+    void Process(IORequest* req) {
+        if (!req->dst) {
+            if (auto err = PrepareFileRead(*req, directThreshold); err.IsValid()) {
+                req->state->Fail(err);
+                CompleteRequest(req);
+                return;
+            }
+        }
+        auto res = PRead(*req->file, req->dst, req->size, req->offset);
+        if (res.has_value()) req->done = res.value();
+        else req->state->Fail(res.error());
+        CompleteRequest(req);
+    }
+};
+
+#if defined(AX_AIO_URING)
+
+// io_uring through the raw syscalls (no liburing): callers fill SQEs under a lock and submit the whole batch
+// with one io_uring_enter, a completion thread reaps CQEs and resubmits the rest of short reads
+struct IOUringBackend final : detail::IOBackend {
+    int ringFd{-1};
+    void* sqRing{nullptr};
+    void* cqRing{nullptr};
+    size_t sqRingSize{0};
+    size_t cqRingSize{0};
+    io_uring_sqe* sqes{nullptr};
+    size_t sqesSize{0};
+
+    std::atomic<uint32_t>* sqHead{nullptr};
+    std::atomic<uint32_t>* sqTail{nullptr};
+    uint32_t sqMask{0};
+    uint32_t* sqArray{nullptr};
+    uint32_t sqEntries{0};
+
+    std::atomic<uint32_t>* cqHead{nullptr};
+    std::atomic<uint32_t>* cqTail{nullptr};
+    uint32_t cqMask{0};
+    io_uring_cqe* cqes{nullptr};
+    uint32_t cqEntries{0};
+
+    std::mutex submitMutex{};
+    std::condition_variable spaceCV{};
+    uint32_t inFlight{0}; // Guarded by submitMutex, bounded by cqEntries so completions never overflow
+
+    std::atomic_bool stopping{false};
+    std::thread reaper{};
+
+    static int Setup(uint32_t entries, io_uring_params* params) {
+        return int(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int Enter(uint32_t toSubmit, uint32_t minComplete, uint32_t flags) {
+        return int(syscall(__NR_io_uring_enter, ringFd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    template <typename T>
+    static T* At(void* base, uint32_t offset) {
+        return reinterpret_cast<T*>(static_cast<uint8_t*>(base) + offset);
+    }
+
+    // Fails (and leaves the object for destruction) when io_uring is missing or blocked, e.g. by seccomp
+    bool Init(uint32_t depth) {
+        io_uring_params params{};
+        ringFd = Setup(depth, &params);
+        if (ringFd < 0) return false;
+
+        sqRingSize = params.sq_off.array + params.sq_entries * sizeof(uint32_t);
+        cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        bool singleMmap = params.features & IORING_FEAT_SINGLE_MMAP;
+        if (singleMmap) sqRingSize = cqRingSize = std::max(sqRingSize, cqRingSize);
+
+        sqRing = mmap(nullptr, sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQ_RING);
+        if (sqRing == MAP_FAILED) { sqRing = nullptr; return false; }
+        if (singleMmap) {
+            cqRing = sqRing;
+        } else {
+            cqRing = mmap(nullptr, cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_CQ_RING);
+            if (cqRing == MAP_FAILED) { cqRing = nullptr; return false; }
+        }
+        sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+        void* sqeMem = mmap(nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFd, IORING_OFF_SQES);
+        if (sqeMem == MAP_FAILED) return false;
+        sqes = static_cast<io_uring_sqe*>(sqeMem);
+
+        sqHead = At<std::atomic<uint32_t>>(sqRing, params.sq_off.head);
+        sqTail = At<std::atomic<uint32_t>>(sqRing, params.sq_off.tail);
+        sqMask = *At<uint32_t>(sqRing, params.sq_off.ring_mask);
+        sqArray = At<uint32_t>(sqRing, params.sq_off.array);
+        sqEntries = params.sq_entries;
+
+        cqHead = At<std::atomic<uint32_t>>(cqRing, params.cq_off.head);
+        cqTail = At<std::atomic<uint32_t>>(cqRing, params.cq_off.tail);
+        cqMask = *At<uint32_t>(cqRing, params.cq_off.ring_mask);
+        cqes = At<io_uring_cqe>(cqRing, params.cq_off.cqes);
+        cqEntries = params.cq_entries;
+
+        // Probe with a NOP so a ring that accepts setup but refuses work (some sandboxes) falls back too
+        {
+            std::unique_lock<std::mutex> lock(submitMutex);
+            PushSqe(nullptr);
+            if (Enter(1, 1, IORING_ENTER_GETEVENTS) < 0) return false;
+            uint32_t head = cqHead->load(std::memory_order_relaxed);
+            if (head == cqTail->load(std::memory_order_acquire)) return false;
+            cqHead->store(head + 1, std::memory_order_release);
+        }
+
+        reaper = std::thread([this]() {
+            core::ApplyThreadSpec({.name = "AX IO uring", .allocTag = core::AllocTag::Assets});
+            ReapLoop();
+        });
+        return true;
+    }
+
+    ~IOUringBackend() override {
+        if (reaper.joinable()) {
+            stopping.store(true, std::memory_order_release);
+            {
+                std::lock_guard<std::mutex> lock(submitMutex);
+                PushSqe(nullptr); // Wakes the reaper
+                Enter(1, 0, 0);
+            }
+            reaper.join();
+        }
+        if (sqes) munmap(sqes, sqesSize);
+        if (cqRing && cqRing != sqRing) munmap(cqRing, cqRingSize);
+        if (sqRing) munmap(sqRing, sqRingSize);
+        if (ringFd >= 0) ::close(ringFd);
+    }
+
+    AsyncIOBackend Kind() const override { return AsyncIOBackend::IOUring; }
+
+    // Caller holds submitMutex; a null request is a NOP
+    void PushSqe(IORequest* req) {
+        uint32_t tail = sqTail->load(std::memory_order_relaxed);
+        uint32_t idx = tail & sqMask;
+        io_uring_sqe& sqe = sqes[idx];
+        std::memset(&sqe, 0, sizeof(sqe));
+        if (req) {
+            req->iov.iov_base = req->dst + req->done;
+            req->iov.iov_len = size_t(req->size - req->done);
+            sqe.opcode = IORING_OP_READV;
+            sqe.fd = req->file->GetHandle();
+            sqe.off = req->offset + req->done;
+            sqe.addr = reinterpret_cast<uint64_t>(&req->iov);
+            sqe.len = 1;
+        } else {
+            sqe.opcode = IORING_OP_NOP;
+        }
+        sqe.user_data = reinterpret_cast<uint64_t>(req);
+        sqArray[idx] = idx;
+        sqTail->store(tail + 1, std::memory_order_release);
+    }
+
+    // Caller holds submitMutex. On a hard io_uring_enter error the SQEs the kernel did not take are pulled back out
+    // of the ring and failed with the errno; they land in `rejected`, completed by the caller once the lock is gone
+    void Flush(uint32_t count, std::vector<IORequest*>& rejected) {
+        while (count > 0) {
+            int submitted = Enter(count, 0, 0);
+            if (submitted < 0) {
+                int err = errno;
+                if (err == EINTR || err == EAGAIN || err == EBUSY) continue;
+
+                uint32_t head = sqHead->load(std::memory_order_acquire);
+                uint32_t tail = sqTail->load(std::memory_order_relaxed);
+                for (uint32_t i{head}; i != tail; i++) {
+                    auto* req = reinterpret_cast<IORequest*>(sqes[sqArray[i & sqMask]].user_data);
+                    if (!req) continue; // NOPs are not counted in flight
+                    req->state->Fail(utils::ExError{err, std::string("io_uring submit failed: ") + std::strerror(err)});
+                    rejected.push_back(req);
+                    inFlight--;
+                }
+                sqTail->store(head, std::memory_order_release);
+                return;
+            }
+            count -= uint32_t(submitted);
+        }
+    }
+
+    void Submit(std::vector<IORequest*>& requests) override {
+        std::vector<IORequest*> rejected;
+        {
+            std::unique_lock<std::mutex> lock(submitMutex);
+            uint32_t batch{0};
+            for (IORequest* req : requests) {
+                if (inFlight >= cqEntries - 1 || batch == sqEntries) {
+                    Flush(batch, rejected);
+                    batch = 0;
+                    spaceCV.wait(lock, [this]() { return inFlight < cqEntries - 1; });
+                }
+                PushSqe(req);
+                inFlight++;
+                batch++;
+            }
+            Flush(batch, rejected);
+        }
+        if (rejected.empty()) return;
+        spaceCV.notify_all();
+        for (IORequest* req : rejected) CompleteRequest(req);
+    }
+
+    void ReapLoop() {
+        bool stopSeen{false};
+        while (true) {
+            {
+                std::lock_guard<std::mutex> lock(submitMutex);
+                if (stopSeen && inFlight == 0) return;
+            }
+            if (Enter(0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                std::this_thread::yield();
+            }
+
+            uint32_t head = cqHead->load(std::memory_order_relaxed);
+            uint32_t tail = cqTail->load(std::memory_order_acquire);
+            std::vector<IORequest*> retry;
+            std::vector<IORequest*> finished;
+            uint32_t completed{0};
+            for (; head != tail; head++) {
+                const io_uring_cqe& cqe = cqes[head & cqMask];
+                auto* req = reinterpret_cast<IORequest*>(cqe.user_data);
+                if (!req) {
+                    stopSeen = stopSeen || stopping.load(std::memory_order_acquire);
+                    continue;
+                }
+                completed++;
+                uint64_t before = req->done;
+                if (cqe.res < 0) {
+                    req->state->Fail(utils::ExError{-cqe.res, std::string("io_uring read failed: ") + std::strerror(-cqe.res)});
+                    finished.push_back(req);
+                } else if (cqe.res == 0 || (req->done += uint64_t(cqe.res)) >= req->size ||
+                           req->offset + req->done >= req->file->GetSize()) {
+                    finished.push_back(req);
+                } else if (!ResumeShortRead(*req->file, before, req->done)) {
+                    req->state->Fail(utils::ExError{EIO, "Direct read stopped short of an aligned boundary: " + req->path.string()});
+                    finished.push_back(req);
+                } else {
+                    retry.push_back(req); // Short read before end of file
+                }
+            }
+            cqHead->store(head, std::memory_order_release);
+
+            {
+                std::lock_guard<std::mutex> lock(submitMutex);
+                inFlight -= completed;
+                for (IORequest* req : retry) {
+                    PushSqe(req);
+                    inFlight++;
+                }
+                Flush(uint32_t(retry.size()), finished);
+            }
+            spaceCV.notify_all();
+
+            // Only once the ring has room again, and resumed on the jobs: a waiter that submits from here
+            // could otherwise block in Submit() on the very thread that frees the space
+            for (IORequest* req : finished) CompleteRequest(req, true);
+        }
+    }
+};
+
+#endif
+
+AsyncIO::AsyncIO(const AsyncIODesc& desc) : m_Desc(desc) {
+#if defined(AX_AIO_URING)
+    if (desc.backend != AsyncIOBackend::ThreadPool) {
+        auto uring = std::make_unique<IOUringBackend>();
+        if (uring->Init(std::max(desc.queueDepth, 8u))) {
+            m_Backend = std::move(uring);
+            return;
+        }
+    }
+#endif
+    m_Backend = std::make_unique<ThreadPoolBackend>(desc.workerCount, desc.directThreshold);
+}
+
+AsyncIO::~AsyncIO() = default;
+
+AsyncIO& AsyncIO::Global() {
+    static AsyncIO s_IO{};
+    return s_IO;
+}
+
+AsyncIOBackend AsyncIO::GetBackend() const {
+    return m_Backend->Kind();
+}
+
+IOFuture<uint64_t> AsyncIO::Read(const SharedPtr<AsyncFile>& file, uint64_t offset, utils::URawView dst) {
+    IOSlice slice{offset, dst};
+    return ReadScatter(file, {&slice, 1});
+}
+
+IOFuture<uint64_t> AsyncIO::ReadScatter(const SharedPtr<AsyncFile>& file, utils::Span<const IOSlice> slices) {
+    auto state = std::make_shared<detail::IOState>();
+    if (slices.size() == 0) {
+        state->pending.store(1, std::memory_order_relaxed);
+        state->Finish(0);
+        return IOFuture<uint64_t>(state);
+    }
+
+    state->pending.store(uint32_t(slices.size()), std::memory_order_relaxed);
+    std::vector<IORequest*> requests;
+    requests.reserve(slices.size());
+    for (const auto& slice : slices) {
+        auto* req = new IORequest{state, file};
+        req->dst = slice.dst.handle();
+        req->size = slice.dst.size();
+        req->offset = slice.offset;
+        requests.push_back(req);
+    }
+    m_Backend->Submit(requests);
+    return IOFuture<uint64_t>(state);
+}
+
+IOFuture<utils::URaw> AsyncIO::ReadFile(const std::filesystem::path& path) {
+    return std::move(ReadFiles({&path, 1})[0]);
+}
+
+std::vector<IOFuture<utils::URaw>> AsyncIO::ReadFiles(utils::Span<const std::filesystem::path> paths) {
+    std::vector<IOFuture<utils::URaw>> futures;
+    std::vector<IORequest*> requests;
+    futures.reserve(paths.size());
+    requests.reserve(paths.size());
+
+    bool openHere = m_Backend->Kind() == AsyncIOBackend::IOUring; // The ring only reads
+    for (const auto& path : paths) {
+        auto state = std::make_shared<detail::IOState>();
+        state->pending.store(1, std::memory_order_relaxed);
+        futures.emplace_back(state);
+
+        auto* req = new IORequest{state, nullptr, path};
+        if (openHere) {
+            if (auto err = PrepareFileRead(*req, m_Desc.directThreshold); err.IsValid()) {
+                state->Fail(err);
+                CompleteRequest(req);
+                continue;
+            }
+            if (req->size == 0) { // Nothing to read, the ring would report it as end of file anyway
+                CompleteRequest(req);
+                continue;
+            }
+        }
+        requests.push_back(req);
+    }
+    if (!requests.empty()) m_Backend->Submit(requests);
+    return futures;
+}
+
+FilePrefetcher::FilePrefetcher(const FilePrefetchDesc& desc) : m_Desc(desc) {
+    if (!m_Desc.io) m_Desc.io = &AsyncIO::Global();
+    m_Desc.chunkSize = std::max<uint32_t>(m_Desc.chunkSize, uint32_t(AsyncFile::DIRECT_ALIGNMENT));
+    m_Desc.depth = std::max<uint32_t>(m_Desc.depth, 1);
+}
+
+FilePrefetcher::~FilePrefetcher() {
+    for (auto& chunk : m_Chunks) Drop(chunk);
+}
+
+utils::ExError FilePrefetcher::Open(const std::filesystem::path& path) {
+    AX_DECL_OR_PROPAGATE(file, AsyncFile::Open(path));
+    m_File = std::move(file);
+    Restart(0);
+    return utils::ExError::NoError();
+}
+
+// In-flight reads still write into the chunk's buffer, so it is only recycled once they are done
+void FilePrefetcher::Drop(Chunk& chunk) {
+    if (chunk.future.IsValid()) (void) chunk.future.Get();
+    m_FreeBuffers.push_back(std::move(chunk.bytes));
+}
+
+void FilePrefetcher::Restart(uint64_t pos) {
+    for (auto& chunk : m_Chunks) Drop(chunk);
+    m_Chunks.clear();
+    m_Pos = pos;
+    m_NextOffset = pos - pos % m_Desc.chunkSize;
+    TopUp();
+}
+
+void FilePrefetcher::TopUp() {
+    while (m_Chunks.size() < m_Desc.depth && m_NextOffset < m_File->GetSize()) {
+        Chunk chunk;
+        chunk.offset = m_NextOffset;
+        if (!m_FreeBuffers.empty()) {
+            chunk.bytes = std::move(m_FreeBuffers.back());
+            m_FreeBuffers.pop_back();
+        }
+        chunk.bytes.resize(size_t(std::min<uint64_t>(m_Desc.chunkSize, m_File->GetSize() - m_NextOffset)));
+        chunk.future = m_Desc.io->Read(m_File, chunk.offset, {chunk.bytes.data(), chunk.bytes.size()});
+        m_NextOffset += chunk.bytes.size();
+        m_Chunks.push_back(std::move(chunk));
+    }
+}
+
+utils::ExError FilePrefetcher::Seek(uint64_t pos) {
+    if (!m_File) return {"Stream is not opened"};
+    if (pos > m_File->GetSize()) return {"SeekRead past end of file"};
+
+    // Positions inside the prefetched range keep their chunks
+    while (!m_Chunks.empty() && m_Chunks.front().offset + m_Chunks.front().bytes.size() <= pos) {
+        Drop(m_Chunks.front());
+        m_Chunks.pop_front();
+    }
+    if (m_Chunks.empty() || m_Chunks.front().offset > pos) {
+        Restart(pos);
+    } else {
+        m_Pos = pos;
+        TopUp();
+    }
+    return utils::ExError::NoError();
+}
+
+utils::ExResult<std::size_t> FilePrefetcher::Read(void* out, std::size_t size) {
+    if (!m_File) return utils::ExError{"Stream is not opened"};
+
+    auto* dst = static_cast<uint8_t*>(out);
+    std::size_t copied{0};
+    while (copied < size && !m_Chunks.empty()) {
+        Chunk& chunk = m_Chunks.front();
+        if (chunk.size == UINT64_MAX) {
+            AX_DECL_OR_PROPAGATE(read, chunk.future.Get());
+            chunk.size = read;
+            chunk.future = {};
+        }
+        uint64_t inChunk = m_Pos - chunk.offset;
+        if (inChunk < chunk.size) {
+            std::size_t n = std::size_t(std::min<uint64_t>(size - copied, chunk.size - inChunk));
+            std::memcpy(dst + copied, chunk.bytes.data() + inChunk, n);
+            copied += n;
+            m_Pos += n;
+        }
+        if (m_Pos >= chunk.offset + chunk.size) {
+            if (chunk.size < chunk.bytes.size()) m_NextOffset = m_File->GetSize(); // File shrank, stop here
+            Drop(chunk);
+            m_Chunks.pop_front();
+            TopUp();
+        }
+    }
+    return copied;
+}
+
+}
@@ -0,0 +1,369 @@
+#include "axle/data/AX_CompressedStream.hpp"
+#include "axle/data/AX_DataEndianness.hpp"
+
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace axle::data
+{
+
+static utils::ExError WriteAll(IDataStream& stream, const void* in, std::size_t size) {
+    auto* src = static_cast<const uint8_t*>(in);
+    while (size > 0) {
+        AX_DECL_OR_PROPAGATE(written, stream.Write(src, size));
+        if (written == 0) return {"Stream accepted no bytes"};
+        src += written;
+        size -= written;
+    }
+    return utils::ExError::NoError();
+}
+
+static utils::ExError ReadAll(IDataStream& stream, void* out, std::size_t size) {
+    auto* dst = static_cast<uint8_t*>(out);
+    while (size > 0) {
+        AX_DECL_OR_PROPAGATE(read, stream.Read(dst, size));
+        if (read == 0) return {-5, "Unexpected EOF"};
+        dst += read;
+        size -= read;
+    }
+    return utils::ExError::NoError();
+}
+
+static void SwapBlockInfos(CompressedBlockInfo* infos, std::size_t count) {
+    if constexpr (std::endian::native == std::endian::big) {
+        for (std::size_t i{0}; i < count; i++) {
+            infos[i].offset = ByteSwap(infos[i].offset);
+            infos[i].size = ByteSwap(infos[i].size);
+            infos[i].flags = ByteSwap(infos[i].flags);
+        }
+    }
+}
+
+static void SwapFooter(CompressedStreamFooter& footer) {
+    if constexpr (std::endian::native == std::endian::big) {
+        footer.indexOffset = ByteSwap(footer.indexOffset);
+        footer.rawSize = ByteSwap(footer.rawSize);
+        footer.blockSize = ByteSwap(footer.blockSize);
+        footer.codec = ByteSwap(footer.codec);
+        footer.version = ByteSwap(footer.version);
+        footer.blockCount = ByteSwap(footer.blockCount);
+        footer.magic = ByteSwap(footer.magic);
+    }
+}
+
+CompressedWriteStream::CompressedWriteStream(IDataStream& inner, const CompressedWriteDesc& desc)
+    : m_Inner(&inner), m_Desc(desc) {}
+
+CompressedWriteStream::~CompressedWriteStream() {
+    if (m_Opened) Finish();
+}
+
+utils::ExError CompressedWriteStream::Open() {
+    if (m_Opened) return utils::ExError::NoError();
+    if (!IsCodecAvailable(m_Desc.codec)) return {"Compression codec is not available"};
+    if (m_Desc.blockSize == 0) return {"Block size must not be 0"};
+    if (m_Desc.blockSize > COMPRESSED_STREAM_MAX_BLOCK_SIZE) return {"Block size is too large"};
+
+    m_Block.reserve(m_Desc.blockSize);
+    m_Compressed.resize(CompressBound(m_Desc.codec, m_Desc.blockSize));
+    m_Opened = true;
+    return utils::ExError::NoError();
+}
+
+utils::ExError CompressedWriteStream::FlushBlock() {
+    if (m_Block.empty()) return utils::ExError::NoError();
+
+    AX_DECL_OR_PROPAGATE(compressed, Compress(m_Desc.codec, m_Block.data(), m_Block.size(),
+                                              m_Compressed.data(), m_Compressed.size(), m_Desc.level));
+    CompressedBlockInfo info{m_StoredSize, uint32_t(compressed), 0};
+    const uint8_t* stored = m_Compressed.data();
+    if (compressed >= m_Block.size()) {
+        info.size = uint32_t(m_Block.size());
+        info.flags = BLOCK_FLAG_STORED;
+        stored = m_Block.data();
+    }
+    AX_PROPAGATE_ERROR(WriteAll(*m_Inner, stored, info.size));
+
+    m_Index.push_back(info);
+    m_StoredSize += info.size;
+    m_Block.clear();
+    return utils::ExError::NoError();
+}
+
+utils::ExError CompressedWriteStream::Finish() {
+    if (!m_Opened) return {"Stream is not open"};
+    if (m_Finished) return utils::ExError::NoError();
+    AX_PROPAGATE_ERROR(FlushBlock());
+
+    CompressedStreamFooter footer{
+        m_StoredSize, m_RawSize, m_Desc.blockSize, uint16_t(m_Desc.codec),
+        COMPRESSED_STREAM_VERSION, uint32_t(m_Index.size()), COMPRESSED_STREAM_MAGIC
+    };
+    SwapBlockInfos(m_Index.data(), m_Index.size());
+    auto err = WriteAll(*m_Inner, m_Index.data(), m_Index.size() * sizeof(CompressedBlockInfo));
+    SwapBlockInfos(m_Index.data(), m_Index.size());
+    AX_PROPAGATE_ERROR(err);
+    SwapFooter(footer);
+    AX_PROPAGATE_ERROR(WriteAll(*m_Inner, &footer, sizeof(footer)));
+
+    m_StoredSize += m_Index.size() * sizeof(CompressedBlockInfo) + sizeof(footer);
+    m_Finished = true;
+    return utils::ExError::NoError();
+}
+
+bool CompressedWriteStream::EndOfStream() const {
+    return m_Finished;
+}
+
+uint64_t CompressedWriteStream::GetReadIndex() {
+    return 0;
+}
+
+uint64_t CompressedWriteStream::GetWriteIndex() {
+    return m_RawSize;
+}
+
+utils::ExError CompressedWriteStream::SeekRead(uint64_t) {
+    return {"Compressed write stream cannot be read"};
+}
+
+utils::ExError CompressedWriteStream::SkipRead(int64_t) {
+    return {"Compressed write stream cannot be read"};
+}
+
+utils::ExError CompressedWriteStream::SeekWrite(uint64_t pos) {
+    if (pos == m_RawSize) return utils::ExError::NoError();
+    return {"Compressed write stream is append-only"};
+}
+
+utils::ExError CompressedWriteStream::SkipWrite(int64_t offset) {
+    if (offset == 0) return utils::ExError::NoError();
+    return {"Compressed write stream is append-only"};
+}
+
+utils::ExResult<std::size_t> CompressedWriteStream::Read(void*, std::size_t) {
+    return utils::ExError{"Compressed write stream cannot be read"};
+}
+
+utils::ExResult<std::size_t> CompressedWriteStream::Write(const void* in, std::size_t size) {
+    if (!m_Opened) return utils::ExError{"Stream is not open"};
+    if (m_Finished) return utils::ExError{"Stream is finished"};
+
+    auto* src = static_cast<const uint8_t*>(in);
+    std::size_t left{size};
+    while (left > 0) {
+        std::size_t take = std::min<std::size_t>(left, m_Desc.blockSize - m_Block.size());
+        m_Block.insert(m_Block.end(), src, src + take);
+        src += take;
+        left -= take;
+        m_RawSize += take;
+        if (m_Block.size() == m_Desc.blockSize) {
+            auto err = FlushBlock();
+            if (err.IsValid()) return err;
+        }
+    }
+    return size;
+}
+
+utils::ExResult<std::size_t> CompressedWriteStream::Write(uint8_t byte, std::size_t repeat) {
+    if (!m_Opened) return utils::ExError{"Stream is not open"};
+    if (m_Finished) return utils::ExError{"Stream is finished"};
+
+    std::size_t left{repeat};
+    while (left > 0) {
+        std::size_t take = std::min<std::size_t>(left, m_Desc.blockSize - m_Block.size());
+        m_Block.insert(m_Block.end(), take, byte);
+        left -= take;
+        m_RawSize += take;
+        if (m_Block.size() == m_Desc.blockSize) {
+            auto err = FlushBlock();
+            if (err.IsValid()) return err;
+        }
+    }
+    return repeat;
+}
+
+CompressedReadStream::CompressedReadStream(IDataStream& inner, const CompressedReadDesc& desc)
+    : m_Inner(&inner), m_Desc(desc) {}
+
+utils::ExError CompressedReadStream::Open() {
+    if (m_Opened) return utils::ExError::NoError();
+
+    // The compressed stream starts at the inner read index and runs to the inner stream's end
+    m_Base = m_Inner->GetReadIndex();
+    uint64_t length = m_Inner->GetLength();
+    if (m_Base > length || length - m_Base < sizeof(CompressedStreamFooter)) return {"Compressed stream is truncated"};
+    uint64_t storedSize = length - m_Base;
+
+    utils::URawView contiguous = m_Inner->PeekContiguous();
+    if (contiguous.size() == storedSize) m_Contiguous = contiguous.handle();
+
+    CompressedStreamFooter footer;
+    if (m_Contiguous) {
+        std::memcpy(&footer, m_Contiguous + storedSize - sizeof(footer), sizeof(footer));
+    } else {
+        AX_PROPAGATE_ERROR(m_Inner->SeekRead(length - sizeof(footer)));
+        AX_PROPAGATE_ERROR(ReadAll(*m_Inner, &footer, sizeof(footer)));
+    }
+    SwapFooter(footer);
+    if (footer.magic != COMPRESSED_STREAM_MAGIC) return {"Not a compressed stream"};
+    if (footer.version != COMPRESSED_STREAM_VERSION) return {"Unsupported compressed stream version"};
+    if (footer.blockSize == 0 || footer.blockSize > COMPRESSED_STREAM_MAX_BLOCK_SIZE) return {"Corrupt compressed stream footer"};
+
+    // Range checks by subtraction only, footer fields are untrusted and any sum of them may wrap
+    uint64_t indexSize = uint64_t(footer.blockCount) * sizeof(CompressedBlockInfo);
+    if (footer.indexOffset > storedSize - sizeof(footer)) return {"Corrupt compressed stream footer"};
+    if (indexSize != storedSize - sizeof(footer) - footer.indexOffset) return {"Corrupt compressed stream footer"};
+    uint64_t blockCount = footer.rawSize / footer.blockSize + (footer.rawSize % footer.blockSize != 0);
+    if (blockCount != footer.blockCount) return {"Corrupt compressed stream footer"};
+
+    m_Codec = static_cast<CompressionCodec>(footer.codec);
+    if (!IsCodecAvailable(m_Codec)) return {"Compression codec is not available"};
+    m_BlockSize = footer.blockSize;
+    m_RawSize = footer.rawSize;
+
+    m_Index.resize(footer.blockCount);
+    if (m_Contiguous) {
+        std::memcpy(m_Index.data(), m_Contiguous + footer.indexOffset, indexSize);
+    } else {
+        AX_PROPAGATE_ERROR(m_Inner->SeekRead(m_Base + footer.indexOffset));
+        AX_PROPAGATE_ERROR(ReadAll(*m_Inner, m_Index.data(), indexSize));
+    }
+    SwapBlockInfos(m_Index.data(), m_Index.size());
+
+    for (uint64_t i{0}; i < m_Index.size(); i++) {
+        const CompressedBlockInfo& info = m_Index[i];
+        if (info.offset > footer.indexOffset || info.size > footer.indexOffset - info.offset) return {"Corrupt compressed stream index"};
+        if (i > 0 && info.offset != m_Index[i - 1].offset + m_Index[i - 1].size) return {"Corrupt compressed stream index"};
+        if ((info.flags & BLOCK_FLAG_STORED) && info.size != RawBlockSize(i)) return {"Corrupt compressed stream index"};
+        if (!(info.flags & BLOCK_FLAG_STORED) && info.size > CompressBound(m_Codec, RawBlockSize(i))) return {"Corrupt compressed stream index"};
+    }
+
+    m_Pos = 0;
+    m_Opened = true;
+    return utils::ExError::NoError();
+}
+
+uint64_t CompressedReadStream::RawBlockSize(uint64_t block) const {
+    return std::min<uint64_t>(m_BlockSize, m_RawSize - block * m_BlockSize);
+}
+
+// Decodes `count` consecutive blocks into `out`, which holds their raw bytes back to back
+utils::ExError CompressedReadStream::LoadBlocks(uint64_t first, uint64_t count, uint8_t* out) {
+    const CompressedBlockInfo& head = m_Index[first];
+    const CompressedBlockInfo& tail = m_Index[first + count - 1];
+
+    const uint8_t* stored = m_Contiguous ? m_Contiguous + head.offset : nullptr;
+    if (!stored) {
+        // Blocks are stored back to back, so a run of them is one inner read
+        m_Staging.resize(tail.offset + tail.size - head.offset);
+        AX_PROPAGATE_ERROR(m_Inner->SeekRead(m_Base + head.offset));
+        AX_PROPAGATE_ERROR(ReadAll(*m_Inner, m_Staging.data(), m_Staging.size()));
+        stored = m_Staging.data();
+    }
+
+    auto decode = [&](uint64_t i) {
+        const CompressedBlockInfo& info = m_Index[first + i];
+        CompressionCodec codec = (info.flags & BLOCK_FLAG_STORED) ? CompressionCodec::None : m_Codec;
+        return Decompress(codec, stored + (info.offset - head.offset), info.size,
+                          out + i * m_BlockSize, RawBlockSize(first + i));
+    };
+
+    if (m_Desc.parallelBlocks == 0 || count < m_Desc.parallelBlocks) {
+        for (uint64_t i{0}; i < count; i++) AX_PROPAGATE_ERROR(decode(i));
+        return utils::ExError::NoError();
+    }
+
+    core::JobSystem& jobs = m_Desc.jobs ? *m_Desc.jobs : core::JobSystem::Global();
+    std::vector<utils::ExError> errors(count, utils::ExError::NoError());
+    jobs.ParallelFor(uint32_t(count), [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i{begin}; i < end; i++) errors[i] = decode(i);
+    }, 1);
+    for (const utils::ExError& err : errors) AX_PROPAGATE_ERROR(err);
+    return utils::ExError::NoError();
+}
+
+bool CompressedReadStream::EndOfStream() const {
+    return !m_Opened || m_Pos >= m_RawSize;
+}
+
+uint64_t CompressedReadStream::GetReadIndex() {
+    return m_Pos;
+}
+
+uint64_t CompressedReadStream::GetWriteIndex() {
+    return 0;
+}
+
+utils::ExError CompressedReadStream::SeekRead(uint64_t pos) {
+    if (!m_Opened) return {"Stream is not open"};
+    if (pos > m_RawSize) return {"Seek past the end of the stream"};
+    m_Pos = pos;
+    return utils::ExError::NoError();
+}
+
+utils::ExError CompressedReadStream::SkipRead(int64_t offset) {
+    if (offset < 0 && uint64_t(-offset) > m_Pos) return {"Seek before the start of the stream"};
+    return SeekRead(m_Pos + offset);
+}
+
+utils::ExError CompressedReadStream::SeekWrite(uint64_t) {
+    return {"Compressed read stream cannot be written"};
+}
+
+utils::ExError CompressedReadStream::SkipWrite(int64_t) {
+    return {"Compressed read stream cannot be written"};
+}
+
+utils::ExResult<std::size_t> CompressedReadStream::Read(void* out, std::size_t size) {
+    if (!m_Opened) return utils::ExError{"Stream is not open"};
+
+    auto* dst = static_cast<uint8_t*>(out);
+    std::size_t left = std::size_t(std::min<uint64_t>(size, m_RawSize - m_Pos));
+    std::size_t done{0};
+    while (left > 0) {
+        uint64_t block = m_Pos / m_BlockSize;
+        uint64_t within = m_Pos % m_BlockSize;
+
+        // Whole blocks go straight into the caller's buffer, skipping the cache
+        if (within == 0 && block != m_CachedBlock) {
+            uint64_t count{0};
+            while (block + count < m_Index.size() && RawBlockSize(block + count) <= left - count * m_BlockSize) count++;
+            if (count > 0) {
+                auto err = LoadBlocks(block, count, dst + done);
+                if (err.IsValid()) return err;
+                std::size_t bytes = std::size_t((count - 1) * m_BlockSize + RawBlockSize(block + count - 1));
+                done += bytes;
+                left -= bytes;
+                m_Pos += bytes;
+                continue;
+            }
+        }
+
+        if (block != m_CachedBlock) {
+            m_Cache.resize(m_BlockSize);
+            m_CachedBlock = UINT64_MAX;
+            auto err = LoadBlocks(block, 1, m_Cache.data());
+            if (err.IsValid()) return err;
+            m_CachedBlock = block;
+        }
+        std::size_t take = std::size_t(std::min<uint64_t>(left, RawBlockSize(block) - within));
+        std::memcpy(dst + done, m_Cache.data() + within, take);
+        done += take;
+        left -= take;
+        m_Pos += take;
+    }
+    return done;
+}
+
+utils::ExResult<std::size_t> CompressedReadStream::Write(const void*, std::size_t) {
+    return utils::ExError{"Compressed read stream cannot be written"};
+}
+
+utils::ExResult<std::size_t> CompressedReadStream::Write(uint8_t, std::size_t) {
+    return utils::ExError{"Compressed read stream cannot be written"};
+}
+
+}
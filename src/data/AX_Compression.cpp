@@ -0,0 +1,274 @@
+#include "axle/data/AX_Compression.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__AX_ZSTD__)
+#include <zstd.h>
+#endif
+
+namespace axle::data
+{
+
+// LZ4 block format (https://github.com/lz4/lz4/blob/dev/doc/lz4_Block_format.md): sequences of
+// [token][literal length+][literals][offset:2][match length+]; output is readable by any LZ4 decoder.
+static constexpr std::size_t LZ4_MIN_MATCH = 4;
+static constexpr std::size_t LZ4_LAST_LITERALS = 5; // The last 5 bytes are always literals
+static constexpr std::size_t LZ4_MF_LIMIT = 12;     // The last match starts at least 12 bytes before the end
+static constexpr std::size_t LZ4_MAX_OFFSET = 65535;
+static constexpr std::size_t LZ4_MAX_INPUT = 0x7E000000;
+static constexpr uint32_t LZ4_HASH_LOG = 14;
+
+static uint32_t Read32(const uint8_t* p) {
+    uint32_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static uint64_t Read64(const uint8_t* p) {
+    uint64_t value;
+    std::memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+// Hashes 5 bytes (reference LZ4 does the same on 64-bit hosts), so 4-byte hits that end right away are rarer and
+// the output has fewer, longer sequences, which decode faster. Reads 8 bytes; callers stay 12 bytes from the end.
+static uint32_t LZ4Hash(const uint8_t* p) {
+    uint64_t sequence = Read64(p);
+    if constexpr (std::endian::native == std::endian::little) sequence <<= 24;
+    else sequence >>= 24;
+    return uint32_t((sequence * 889523592379ull) >> (64 - LZ4_HASH_LOG));
+}
+
+static uint8_t* LZ4WriteLength(uint8_t* op, std::size_t length) {
+    for (; length >= 255; length -= 255) *op++ = 255;
+    *op++ = uint8_t(length);
+    return op;
+}
+
+// Length of the common run at `a` and `b`, not reading at or past `limit` from `a`
+static std::size_t LZ4MatchLength(const uint8_t* a, const uint8_t* b, const uint8_t* limit) {
+    const uint8_t* start = a;
+    while (a + 8 <= limit) {
+        uint64_t diff = Read64(a) ^ Read64(b);
+        if (diff) {
+            if constexpr (std::endian::native == std::endian::little) return std::size_t(a - start) + (std::countr_zero(diff) >> 3);
+            else return std::size_t(a - start) + (std::countl_zero(diff) >> 3);
+        }
+        a += 8;
+        b += 8;
+    }
+    while (a < limit && *a == *b) {
+        a++;
+        b++;
+    }
+    return std::size_t(a - start);
+}
+
+static std::size_t LZ4Compress(const uint8_t* src, std::size_t size, uint8_t* dst) {
+    uint8_t* op = dst;
+    std::size_t anchor{0};
+
+    auto emit = [&](std::size_t literalEnd, std::size_t offset, std::size_t matchLength) {
+        std::size_t literals = literalEnd - anchor;
+        uint8_t* token = op++;
+        *token = uint8_t(std::min<std::size_t>(literals, 15) << 4);
+        if (literals >= 15) op = LZ4WriteLength(op, literals - 15);
+        if (literals > 0) std::memcpy(op, src + anchor, literals);
+        op += literals;
+        if (matchLength == 0) return; // Last sequence
+        *op++ = uint8_t(offset);
+        *op++ = uint8_t(offset >> 8);
+        std::size_t extra = matchLength - LZ4_MIN_MATCH;
+        *token |= uint8_t(std::min<std::size_t>(extra, 15));
+        if (extra >= 15) op = LZ4WriteLength(op, extra - 15);
+    };
+
+    if (size > LZ4_MF_LIMIT) {
+        std::vector<uint32_t> table(std::size_t(1) << LZ4_HASH_LOG, 0);
+        const std::size_t mfLimit = size - LZ4_MF_LIMIT;
+        const uint8_t* matchLimit = src + size - LZ4_LAST_LITERALS;
+
+        std::size_t ip{1};
+        table[LZ4Hash(src)] = 0;
+        while (ip <= mfLimit) {
+            uint32_t sequence = Read32(src + ip);
+            uint32_t& slot = table[LZ4Hash(src + ip)];
+            std::size_t ref = slot;
+            slot = uint32_t(ip);
+            if (ref >= ip || ip - ref > LZ4_MAX_OFFSET || Read32(src + ref) != sequence) {
+                ip += 1 + ((ip - anchor) >> 6); // Skip faster through incompressible runs
+                continue;
+            }
+
+            while (ip > anchor && ref > 0 && src[ip - 1] == src[ref - 1]) {
+                ip--;
+                ref--;
+            }
+            std::size_t length = LZ4_MIN_MATCH + LZ4MatchLength(src + ip + LZ4_MIN_MATCH, src + ref + LZ4_MIN_MATCH, matchLimit);
+            emit(ip, ip - ref, length);
+            ip += length;
+            anchor = ip;
+            if (ip <= mfLimit) table[LZ4Hash(src + ip - 2)] = uint32_t(ip - 2);
+        }
+    }
+    emit(size, 0, 0);
+    return std::size_t(op - dst);
+}
+
+static utils::ExError LZ4Decompress(const uint8_t* ip, std::size_t srcSize, uint8_t* dst, std::size_t rawSize) {
+    const uint8_t* iend = ip + srcSize;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + rawSize;
+    const utils::ExError corrupt{"Corrupt LZ4 block"};
+
+    auto readLength = [&](std::size_t& length) {
+        uint8_t byte;
+        do {
+            if (ip >= iend) return false;
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    };
+
+    while (true) {
+        if (ip >= iend) return corrupt;
+        uint8_t token = *ip++;
+
+        std::size_t literals = token >> 4;
+        if (literals != 15 && ip + 16 <= iend && op + 16 <= oend) {
+            std::memcpy(op, ip, 16); // Short literal run, one fixed-size copy
+        } else {
+            if (literals == 15 && !readLength(literals)) return corrupt;
+            if (literals > std::size_t(iend - ip) || literals > std::size_t(oend - op)) return corrupt;
+            if (literals > 0) std::memmove(op, ip, literals);
+        }
+        ip += literals;
+        op += literals;
+        if (ip == iend) break; // The last sequence has no match
+
+        if (iend - ip < 2) return corrupt;
+        std::size_t offset = std::size_t(ip[0]) | (std::size_t(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > std::size_t(op - dst)) return corrupt;
+
+        std::size_t length = token & 15;
+        const uint8_t* match = op - offset;
+        if (length != 15 && offset >= 8 && op + 18 <= oend) {
+            // Up to 18 bytes in word steps, each source word is fully written before it is read
+            std::memcpy(op, match, 8);
+            std::memcpy(op + 8, match + 8, 8);
+            std::memcpy(op + 16, match + 16, 2);
+            op += length + LZ4_MIN_MATCH;
+            continue;
+        }
+        if (length == 15 && !readLength(length)) return corrupt;
+        length += LZ4_MIN_MATCH;
+        if (length > std::size_t(oend - op)) return corrupt;
+
+        std::size_t i{0};
+        if (offset < 8) {
+            // Repeating pattern shorter than a word: seed one word, then copy from a whole number of periods back
+            for (; i < length && i < 8; i++) op[i] = match[i];
+            offset *= (8 + offset - 1) / offset;
+        }
+        if (offset >= 16 && op + length + 16 <= oend) {
+            for (; i < length; i += 16) std::memcpy(op + i, op + i - offset, 16); // May write past the match, never past oend
+        } else if (op + length + 8 <= oend) {
+            for (; i < length; i += 8) std::memcpy(op + i, op + i - offset, 8);
+        } else {
+            for (; i < length; i += 8) std::memcpy(op + i, op + i - offset, std::min<std::size_t>(8, length - i));
+        }
+        op += length;
+    }
+    if (op != oend) return {"LZ4 block decoded to the wrong size"};
+    return utils::ExError::NoError();
+}
+
+#if defined(__AX_ZSTD__)
+// Contexts are reused per thread, creating one per block costs more than small blocks take to code
+static ZSTD_CCtx* ZstdCompressContext() {
+    thread_local std::unique_ptr<ZSTD_CCtx, decltype(&ZSTD_freeCCtx)> ctx{ZSTD_createCCtx(), &ZSTD_freeCCtx};
+    return ctx.get();
+}
+
+static ZSTD_DCtx* ZstdDecompressContext() {
+    thread_local std::unique_ptr<ZSTD_DCtx, decltype(&ZSTD_freeDCtx)> ctx{ZSTD_createDCtx(), &ZSTD_freeDCtx};
+    return ctx.get();
+}
+#endif
+
+bool IsCodecAvailable(CompressionCodec codec) {
+    switch (codec) {
+        case CompressionCodec::None:
+        case CompressionCodec::LZ4: return true;
+#if defined(__AX_ZSTD__)
+        case CompressionCodec::Zstd: return true;
+#endif
+        default: return false;
+    }
+}
+
+std::size_t CompressBound(CompressionCodec codec, std::size_t size) {
+    switch (codec) {
+        case CompressionCodec::LZ4: return size + size / 255 + 16;
+#if defined(__AX_ZSTD__)
+        case CompressionCodec::Zstd: return ZSTD_compressBound(size);
+#endif
+        default: return size;
+    }
+}
+
+utils::ExResult<std::size_t> Compress(CompressionCodec codec, const void* src, std::size_t srcSize,
+                                      void* dst, std::size_t dstCapacity, int level) {
+    if (dstCapacity < CompressBound(codec, srcSize)) return utils::ExError{"Compression output smaller than CompressBound()"};
+    switch (codec) {
+        case CompressionCodec::None:
+            std::memcpy(dst, src, srcSize);
+            return srcSize;
+        case CompressionCodec::LZ4:
+            if (srcSize > LZ4_MAX_INPUT) return utils::ExError{"LZ4 block too large"};
+            return LZ4Compress(static_cast<const uint8_t*>(src), srcSize, static_cast<uint8_t*>(dst));
+        case CompressionCodec::Zstd: {
+#if defined(__AX_ZSTD__)
+            std::size_t written = ZSTD_compressCCtx(ZstdCompressContext(), dst, dstCapacity, src, srcSize,
+                                                    level == 0 ? ZSTD_CLEVEL_DEFAULT : level);
+            if (ZSTD_isError(written)) return utils::ExError{std::string("Zstd compression failed: ") + ZSTD_getErrorName(written)};
+            return written;
+#else
+            (void)level;
+            return utils::ExError{"Zstd support is not compiled in (AX_IMPL_ZSTD)"};
+#endif
+        }
+    }
+    return utils::ExError{"Unknown compression codec"};
+}
+
+utils::ExError Decompress(CompressionCodec codec, const void* src, std::size_t srcSize, void* dst, std::size_t rawSize) {
+    switch (codec) {
+        case CompressionCodec::None:
+            if (srcSize != rawSize) return {"Stored block has the wrong size"};
+            std::memcpy(dst, src, srcSize);
+            return utils::ExError::NoError();
+        case CompressionCodec::LZ4:
+            return LZ4Decompress(static_cast<const uint8_t*>(src), srcSize, static_cast<uint8_t*>(dst), rawSize);
+        case CompressionCodec::Zstd: {
+#if defined(__AX_ZSTD__)
+            std::size_t read = ZSTD_decompressDCtx(ZstdDecompressContext(), dst, rawSize, src, srcSize);
+            if (ZSTD_isError(read)) return {std::string("Zstd decompression failed: ") + ZSTD_getErrorName(read)};
+            if (read != rawSize) return {"Zstd block decoded to the wrong size"};
+            return utils::ExError::NoError();
+#else
+            return {"Zstd support is not compiled in (AX_IMPL_ZSTD)"};
+#endif
+        }
+    }
+    return {"Unknown compression codec"};
+}
+
+}
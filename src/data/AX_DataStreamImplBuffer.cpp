@@ -16,10 +16,6 @@ BufferDataStream::BufferDataStream(uint64_t length)
     : m_BufferView(nullptr, length) {
 }
 
-BufferDataStream::~BufferDataStream() {
-    m_ReadIndex = m_WriteIndex = 0;
-}
-
 utils::ExError BufferDataStream::Open() {
     if (m_BufferView.handle() == nullptr) {
         m_BufferHeld = std::vector<uint8_t>((std::size_t) m_BufferView.size(), 0);
@@ -44,6 +40,11 @@ uint64_t BufferDataStream::GetLength() {
     return m_BufferView.size();
 }
 
+utils::URawView BufferDataStream::PeekContiguous() {
+    if (EndOfStream()) return {};
+    return {m_BufferView.handle() + m_ReadIndex, size_t(m_BufferView.size() - m_ReadIndex)};
+}
+
 utils::ExError BufferDataStream::SeekRead(uint64_t pos) {
     if (!m_Opened) return {"Stream is not open"};
     m_ReadIndex = pos;
@@ -9,17 +9,29 @@ namespace axle::data
 FileDataStream::FileDataStream(const std::filesystem::path& path, bool read, bool write)
     : m_Writable(write), m_Readable(read), m_Path(path) {}
 
+FileDataStream::FileDataStream(const std::filesystem::path& path, const FilePrefetchDesc& prefetch)
+    : m_Path(path), m_Readable(true), m_PrefetchDesc(prefetch) {}
+
 FileDataStream::~FileDataStream() {
     m_File.close();
 }
 
 utils::ExError FileDataStream::Open() {
+    if (m_PrefetchDesc) {
+        auto prefetch = std::make_unique<FilePrefetcher>(*m_PrefetchDesc);
+        AX_PROPAGATE_ERROR(prefetch->Open(m_Path));
+        m_Prefetch = std::move(prefetch);
+        m_Opened = true;
+        return utils::ExError::NoError();
+    }
+
     std::ios::openmode mode = std::ios::binary;
 
     std::error_code sysErr;
     auto status = std::filesystem::status(m_Path, sysErr);
 
-    if (sysErr) {
+    bool missing = sysErr == std::errc::no_such_file_or_directory;
+    if (sysErr && !(missing && !m_Readable)) { // Write-only streams create the file
         return {sysErr.value(), "Failed to get file status for: \"" + m_Path.string() + "\" Error: " + sysErr.message()};
     }
     if (m_Readable && !std::filesystem::exists(status)) {
@@ -63,6 +75,7 @@ utils::ExError FileDataStream::Open() {
 
 uint64_t FileDataStream::GetReadIndex() {
     if (!m_Opened || !m_Readable) return UINT64_MAX;
+    if (m_Prefetch) return m_Prefetch->GetPosition();
     m_File.clear();
     auto pos = m_File.tellg();
     if (pos == std::streampos(-1)) return UINT64_MAX;
@@ -77,6 +90,7 @@ uint64_t FileDataStream::GetWriteIndex() {
 utils::ExError FileDataStream::SeekRead(uint64_t pos) {
     if (!m_Opened) return {"Stream is not opened"};
     if (!m_Readable) return {"Stream not open for reading"};
+    if (m_Prefetch) return m_Prefetch->Seek(pos);
 
     m_File.clear();
     m_File.seekg(static_cast<std::streamoff>(pos));
@@ -96,6 +110,7 @@ utils::ExError FileDataStream::SeekWrite(uint64_t pos) {
 utils::ExError FileDataStream::SkipRead(int64_t offset) {
     if (!m_Opened) return {"Stream is not opened"};
     if (!m_Readable) return {"Stream not open for reading"};
+    if (m_Prefetch) return m_Prefetch->Seek(m_Prefetch->GetPosition() + offset);
     m_File.seekg(offset, std::ios::cur);
     return utils::ExError::NoError();
 }
@@ -108,12 +123,14 @@ utils::ExError FileDataStream::SkipWrite(int64_t offset) {
 }
 
 bool FileDataStream::EndOfStream() const {
+    if (m_Prefetch) return m_Prefetch->EndOfStream();
     return !m_Opened || !m_Readable || m_File.eof();
 }
 
 utils::ExResult<std::size_t> FileDataStream::Read(void* out, std::size_t size) {
     if (!m_Opened) return utils::ExError{"Stream is not opened"};
     if (!m_Readable) return utils::ExError{"Stream not open for reading"};
+    if (m_Prefetch) return m_Prefetch->Read(out, size);
     m_File.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(size));
     return static_cast<std::size_t>(m_File.gcount());
 }
@@ -135,6 +152,7 @@ utils::ExResult<std::size_t> FileDataStream::Write(uint8_t byte, std::size_t rep
 
 uint64_t FileDataStream::GetLength() {
     if (!m_Opened) return 0;
+    if (m_Prefetch) return m_Prefetch->GetLength();
     m_File.clear();
     std::streampos current = m_File.tellg();
     m_File.seekg(0, std::ios::end);
@@ -0,0 +1,251 @@
+#include "axle/data/AX_DataStreamImplMMap.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define AX_MMAP_POSIX
+#elif defined(_WIN32)
+#include <windows.h>
+#define AX_MMAP_WIN32
+#endif
+
+namespace axle::data
+{
+
+// Owns the mapped view; without virtual memory support the file is read into memory instead
+struct MMapDataStream::Mapping {
+    const uint8_t* base{nullptr};
+    uint64_t size{0};
+#if !defined(AX_MMAP_POSIX) && !defined(AX_MMAP_WIN32)
+    std::vector<uint8_t> bytes;
+#endif
+
+    Mapping() = default;
+    Mapping(const Mapping&) = delete;
+    Mapping& operator=(const Mapping&) = delete;
+
+    ~Mapping() {
+        if (!base) return;
+#if defined(AX_MMAP_POSIX)
+        munmap(const_cast<uint8_t*>(base), size);
+#elif defined(AX_MMAP_WIN32)
+        UnmapViewOfFile(base);
+#endif
+    }
+};
+
+static uint64_t GetPageSize() {
+#if defined(AX_MMAP_POSIX)
+    return uint64_t(sysconf(_SC_PAGESIZE));
+#elif defined(AX_MMAP_WIN32)
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    return uint64_t(info.dwAllocationGranularity);
+#else
+    return 4096;
+#endif
+}
+
+MMapDataStream::MMapDataStream(const std::filesystem::path& path, MMapAdvice advice)
+    : m_Path(path), m_Advice(advice) {}
+
+utils::ExError MMapDataStream::Open() {
+    auto mapping = std::make_shared<Mapping>();
+
+#if defined(AX_MMAP_POSIX)
+    int fd = ::open(m_Path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return {errno, "Failed to open file for mapping: " + m_Path.string() + " Error: " + std::strerror(errno)};
+    }
+    struct stat st{};
+    if (fstat(fd, &st) != 0) {
+        int err = errno;
+        ::close(fd);
+        return {err, "Failed to get file status for: \"" + m_Path.string() + "\" Error: " + std::strerror(err)};
+    }
+    if (st.st_size > 0) {
+        void* base = mmap(nullptr, size_t(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+        if (base == MAP_FAILED) {
+            int err = errno;
+            ::close(fd);
+            return {err, "Failed to map file: " + m_Path.string() + " Error: " + std::strerror(err)};
+        }
+        mapping->base = static_cast<const uint8_t*>(base);
+        mapping->size = uint64_t(st.st_size);
+    }
+    ::close(fd); // The mapping holds its own reference to the file
+#elif defined(AX_MMAP_WIN32)
+    HANDLE file = CreateFileW(m_Path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        return {int32_t(GetLastError()), "Failed to open file for mapping: " + m_Path.string()};
+    }
+    LARGE_INTEGER fileSize{};
+    if (!GetFileSizeEx(file, &fileSize)) {
+        CloseHandle(file);
+        return {int32_t(GetLastError()), "Failed to get file size for: " + m_Path.string()};
+    }
+    if (fileSize.QuadPart > 0) {
+        HANDLE section = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!section) {
+            CloseHandle(file);
+            return {int32_t(GetLastError()), "Failed to create file mapping: " + m_Path.string()};
+        }
+        void* base = MapViewOfFile(section, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(section); // The view keeps the section alive
+        if (!base) {
+            CloseHandle(file);
+            return {int32_t(GetLastError()), "Failed to map file: " + m_Path.string()};
+        }
+        mapping->base = static_cast<const uint8_t*>(base);
+        mapping->size = uint64_t(fileSize.QuadPart);
+    }
+    CloseHandle(file);
+#else
+    std::ifstream file(m_Path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        return {"Failed to open file: " + m_Path.string()};
+    }
+    mapping->bytes.resize(size_t(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(mapping->bytes.data()), std::streamsize(mapping->bytes.size()));
+    mapping->base = mapping->bytes.data();
+    mapping->size = mapping->bytes.size();
+#endif
+
+    m_View = {const_cast<uint8_t*>(mapping->base), size_t(mapping->size)};
+    m_Mapping = std::move(mapping);
+    m_ReadIndex = 0;
+    m_Opened = true;
+
+    if (m_Advice != MMapAdvice::Normal) {
+        AX_PROPAGATE_ERROR(Advise(m_Advice));
+    }
+    return utils::ExError::NoError();
+}
+
+utils::ExError MMapDataStream::Advise(MMapAdvice advice, uint64_t offset, uint64_t size) {
+    if (!m_Opened) return {"Stream is not opened"};
+    if (offset >= m_View.size()) return utils::ExError::NoError();
+    size = std::min<uint64_t>(size, m_View.size() - offset);
+
+    // Advice ranges must start on a page boundary
+    uint64_t start = offset & ~(GetPageSize() - 1);
+    size += offset - start;
+
+#if defined(AX_MMAP_POSIX)
+    int flag = MADV_NORMAL;
+    switch (advice) {
+        case MMapAdvice::Normal: flag = MADV_NORMAL; break;
+        case MMapAdvice::Sequential: flag = MADV_SEQUENTIAL; break;
+        case MMapAdvice::Random: flag = MADV_RANDOM; break;
+        case MMapAdvice::WillNeed: flag = MADV_WILLNEED; break;
+    }
+    if (madvise(const_cast<uint8_t*>(m_View.handle()) + start, size_t(size), flag) != 0) {
+        return {errno, "madvise failed on: " + m_Path.string() + " Error: " + std::strerror(errno)};
+    }
+#elif defined(AX_MMAP_WIN32)
+    // Windows only takes explicit prefetches; the other hints have no equivalent on a view
+    if (advice == MMapAdvice::WillNeed) {
+        WIN32_MEMORY_RANGE_ENTRY range{m_View.handle() + start, SIZE_T(size)};
+        PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+    }
+#endif
+    return utils::ExError::NoError();
+}
+
+uint64_t MMapDataStream::GetReadIndex() {
+    if (!m_Opened) return UINT64_MAX;
+    return m_ReadIndex;
+}
+
+uint64_t MMapDataStream::GetWriteIndex() {
+    return UINT64_MAX;
+}
+
+uint64_t MMapDataStream::GetLength() {
+    if (!m_Opened) return 0;
+    return m_View.size();
+}
+
+utils::ExError MMapDataStream::SeekRead(uint64_t pos) {
+    if (!m_Opened) return {"Stream is not opened"};
+    if (pos > m_View.size()) return {"SeekRead past end of file"};
+    m_ReadIndex = pos;
+    return utils::ExError::NoError();
+}
+
+utils::ExError MMapDataStream::SkipRead(int64_t offset) {
+    if (!m_Opened) return {"Stream is not opened"};
+    if (offset < 0 && uint64_t(-offset) > m_ReadIndex) return {"SkipRead before start of file"};
+    return SeekRead(m_ReadIndex + offset);
+}
+
+utils::ExError MMapDataStream::SeekWrite(uint64_t) {
+    return {"Stream is read-only"};
+}
+
+utils::ExError MMapDataStream::SkipWrite(int64_t) {
+    return {"Stream is read-only"};
+}
+
+bool MMapDataStream::EndOfStream() const {
+    return !m_Opened || m_ReadIndex >= m_View.size();
+}
+
+utils::ExResult<std::size_t> MMapDataStream::Read(void* out, std::size_t size) {
+    if (!m_Opened) return utils::ExError{"Stream is not opened"};
+
+    size = std::min<std::size_t>(size, m_View.size() - m_ReadIndex);
+    if (size > 0) {
+        std::memcpy(out, m_View.handle() + m_ReadIndex, size);
+        m_ReadIndex += size;
+    }
+    return size;
+}
+
+utils::ExResult<std::size_t> MMapDataStream::Write(const void*, std::size_t) {
+    return utils::ExError{"Stream is read-only"};
+}
+
+utils::ExResult<std::size_t> MMapDataStream::Write(uint8_t, std::size_t) {
+    return utils::ExError{"Stream is read-only"};
+}
+
+utils::URawView MMapDataStream::PeekContiguous() {
+    if (!m_Opened) return {};
+    return {m_View.handle() + m_ReadIndex, size_t(m_View.size() - m_ReadIndex)};
+}
+
+utils::ExResult<utils::URawView> MMapDataStream::Borrow(std::size_t size) {
+    if (!m_Opened) return utils::ExError{"Stream is not opened"};
+    if (size > m_View.size() - m_ReadIndex) return utils::ExError{-5, "Unexpected EOF"};
+
+    utils::URawView view{m_View.handle() + m_ReadIndex, size};
+    m_ReadIndex += size;
+    return view;
+}
+
+utils::URaw MMapDataStream::Share(uint64_t offset, std::size_t size) const {
+    if (!m_Opened || offset >= m_View.size()) return {};
+    size = std::min<std::size_t>(size, m_View.size() - offset);
+    return utils::URaw(utils::SharedBuffer<uint8_t>::Adopt(m_View.handle() + offset, size, m_Mapping));
+}
+
+utils::ExResult<utils::URaw> MMapDataStream::ReadShared(std::size_t size) {
+    if (!m_Opened) return utils::ExError{"Stream is not opened"};
+
+    size = std::min<std::size_t>(size, m_View.size() - m_ReadIndex);
+    auto shared = Share(m_ReadIndex, size);
+    m_ReadIndex += size;
+    return shared;
+}
+
+}
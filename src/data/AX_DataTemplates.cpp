@@ -8,11 +8,33 @@ using namespace axle::utils;
 namespace axle::data
 {
 
+// One Read() for all components instead of one virtual call each
+template<typename T>
+static utils::ExError LE_ReadComponents(IDataStream& buffer, T* out, std::size_t count) {
+    AX_DECL_OR_PROPAGATE(read, buffer.Read(out, count * sizeof(T)));
+    if (read != count * sizeof(T))
+        return ExError{-5, "Unexpected EOF"};
+    LE_SwapInPlace(out, count);
+    return utils::ExError::NoError();
+}
+
+template<typename T>
+static utils::ExError LE_WriteComponents(IDataStream& buffer, const T* values, std::size_t count) {
+    T swapped[16];
+    std::memcpy(swapped, values, count * sizeof(T));
+    LE_SwapInPlace(swapped, count);
+    AX_DECL_OR_PROPAGATE(written, buffer.Write(swapped, count * sizeof(T)));
+    if (written != count * sizeof(T))
+        return ExError{-5, "Unexpected EOF"};
+    return utils::ExError::NoError();
+}
+
 utils::ExResult<bool> ReadBool(IDataStream& buffer) {
-    bool b0;
+    uint8_t b0{0};
     auto res = buffer.Read(&b0, 1);
     if (res.has_value()) {
-        return b0;
+        if (res.value() != 1) return ExError{-5, "Unexpected EOF"};
+        return b0 != 0;
     } else {
         auto err = res.error();
         if (err.IsMessageOwned()) {
@@ -23,7 +45,21 @@ utils::ExResult<bool> ReadBool(IDataStream& buffer) {
     }
 }
 
+utils::ExResult<uint8_t> ReadChar(IDataStream& buffer) {
+    uint8_t c{0};
+    auto res = buffer.Read(&c, 1);
+    if (!res.has_value()) return res.error();
+    if (res.value() != 1) return ExError{-5, "Unexpected EOF"};
+    return c;
+}
+
 utils::ExResult<uint64_t> ReadVarUInt(IDataStream& buffer) {
+    // Memory-backed streams decode in place; others can't be read past the varint, so byte by byte
+    if (buffer.PeekContiguous().size() > 0) {
+        StreamReader reader(buffer, 0);
+        return reader.ReadVarUInt();
+    }
+
     uint64_t result = 0;
     int shift = 0;
 
@@ -67,42 +103,40 @@ utils::ExResult<std::string> ReadString(IDataStream& buffer, uint32_t maxLength)
     if (length > static_cast<uint64_t>(maxLength))
         return ExError{"String length exceeds maximum"};
 
-    if (buffer.GetReadIndex() + length > buffer.GetLength())
+    std::string result(length, '\0');
+    auto res = buffer.Read(result.data(), length);
+    if (!res.has_value()) return res.error();
+    if (res.value() != length)
         return ExError{"Unexpected EOF"};
-
-    std::string result;
-    result.reserve(length);
-
-    for (uint64_t i = 0; i < length; ++i) {
-        uint8_t byte{0};
-        auto res = buffer.Read(&byte, 1);
-        if (!res.has_value()) return res.error();
-        result[i] = static_cast<char>(byte);
-    }
     return result;
 }
 
 utils::ExError WriteBool(IDataStream& buffer, bool value) {
-    uint8_t *bytes = {0};
-    bytes[0] = (char) (value ? 1 : 0);
-    auto res = buffer.Write(bytes, 1);
+    auto res = buffer.Write(uint8_t(value ? 1 : 0), 1);
+    if (!res.has_value()) return res.error();
+    return utils::ExError::NoError();
+}
+
+utils::ExError WriteChar(IDataStream& buffer, uint8_t value) {
+    auto res = buffer.Write(&value, 1);
     if (!res.has_value()) return res.error();
     return utils::ExError::NoError();
 }
 
 utils::ExError WriteVarUInt(IDataStream& buffer, uint64_t value) {
+    uint8_t bytes[10];
+    std::size_t count{0};
     do {
         uint8_t byte = static_cast<uint8_t>(value & 0x7F);
         value >>= 7;
         if (value != 0) {
             byte |= 0x80;
         }
-        uint8_t *b1 = {0};
-        b1[0] = (char) (b1 ? 1 : 0);
-        auto res = buffer.Write(b1, 1);
-        if (!res.has_value()) return res.error();
+        bytes[count++] = byte;
     } while (value != 0);
 
+    auto res = buffer.Write(bytes, count);
+    if (!res.has_value()) return res.error();
     return utils::ExError::NoError();
 }
 
@@ -111,111 +145,149 @@ utils::ExError WriteVarInt(IDataStream& buffer, int64_t value) {
     return WriteVarUInt(buffer, zigzag);
 }
 
-utils::ExError WriteString(IDataStream& buffer, const std::string& value) {
+utils::ExError WriteString(IDataStream& buffer, const std::string& value, uint32_t maxLength) {
+    if (value.size() > maxLength)
+        return ExError{"String length exceeds maximum"};
+
     auto lenErr = WriteVarUInt(buffer, value.size());
     if (!lenErr.IsNoError()) return lenErr;
 
-    buffer.Write(
+    auto res = buffer.Write(
         reinterpret_cast<const unsigned char*>(value.data()),
         value.size()
     );
+    if (!res.has_value()) return res.error();
     return utils::ExError::NoError();
 }
 
 utils::ExResult<glm::mat4> LE_ReadMat4(IDataStream& buffer) {
     glm::mat4 mat;
-    for (int i{0}; i < 16; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &mat[i / 4][i % 4]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &mat[0][0], 16));
     return mat;
 }
 
 utils::ExResult<glm::mat3> LE_ReadMat3(IDataStream& buffer) {
     glm::mat3 mat;
-    for (int i{0}; i < 9; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &mat[i / 3][i % 3]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &mat[0][0], 9));
     return mat;
 }
 
 utils::ExResult<glm::vec4> LE_ReadVec4(IDataStream& buffer) {
     glm::vec4 vec;
-    for (int i{0}; i < 4; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 4));
     return vec;
 }
 
 utils::ExResult<glm::vec3> LE_ReadVec3(IDataStream& buffer) {
     glm::vec3 vec;
-    for (int i{0}; i < 3; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 3));
     return vec;
 }
 
 utils::ExResult<glm::vec2> LE_ReadVec2(IDataStream& buffer) {
     glm::vec2 vec;
-    for (int i{0}; i < 2; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<float>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 2));
     return vec;
 }
 
 utils::ExResult<glm::ivec4> LE_ReadIVec4(IDataStream& buffer) {
     glm::ivec4 vec;
-    for (int i{0}; i < 4; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<int32_t>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 4));
     return vec;
 }
 
 utils::ExResult<glm::ivec3> LE_ReadIVec3(IDataStream& buffer) {
     glm::ivec3 vec;
-    for (int i{0}; i < 3; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<int32_t>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 3));
     return vec;
 }
 
 utils::ExResult<glm::ivec2> LE_ReadIVec2(IDataStream& buffer) {
     glm::ivec2 vec;
-    for (int i{0}; i < 2; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Read<int32_t>(buffer, &vec[i]));
+    AX_PROPAGATE_ERROR(LE_ReadComponents(buffer, &vec[0], 2));
     return vec;
 }
 
 utils::ExError LE_WriteMat4(IDataStream& buffer, const glm::mat4& value) {
-    for (int i{0}; i < 16; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i / 4][i % 4]));
+    return LE_WriteComponents(buffer, &value[0][0], 16);
 }
 
 utils::ExError LE_WriteMat3(IDataStream& buffer, const glm::mat3& value) {
-    for (int i{0}; i < 9; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i / 3][i % 3]));
+    return LE_WriteComponents(buffer, &value[0][0], 9);
 }
 
 utils::ExError LE_WriteVec4(IDataStream& buffer, const glm::vec4& value) {
-    for (int i{0}; i < 4; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 4);
 }
 
 utils::ExError LE_WriteVec3(IDataStream& buffer, const glm::vec3& value) {
-    for (int i{0}; i < 3; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 3);
 }
 
 utils::ExError LE_WriteVec2(IDataStream& buffer, const glm::vec2& value) {
-    for (int i{0}; i < 2; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 2);
 }
 
 utils::ExError LE_WriteIVec4(IDataStream& buffer, const glm::ivec4& value) {
-    for (int i{0}; i < 4; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 4);
 }
 
 utils::ExError LE_WriteIVec3(IDataStream& buffer, const glm::ivec3& value) {
-    for (int i{0}; i < 3; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 3);
 }
 
 utils::ExError LE_WriteIVec2(IDataStream& buffer, const glm::ivec2& value) {
-    for (int i{0}; i < 2; i++)
-        AX_PROPAGATE_RESULT_ERROR(data::LE_Write(buffer, &value[i]));
+    return LE_WriteComponents(buffer, &value[0], 2);
+}
+
+utils::ExResult<glm::mat4> LE_ReadMat4(StreamReader& reader) {
+    glm::mat4 mat;
+    AX_PROPAGATE_ERROR(reader.ReadSpan(&mat[0][0], 16));
+    return mat;
+}
+
+utils::ExResult<glm::mat3> LE_ReadMat3(StreamReader& reader) {
+    glm::mat3 mat;
+    AX_PROPAGATE_ERROR(reader.ReadSpan(&mat[0][0], 9));
+    return mat;
+}
+
+utils::ExResult<glm::vec4> LE_ReadVec4(StreamReader& reader) {
+    glm::vec4 vec;
+    AX_PROPAGATE_ERROR(reader.ReadSpan(&vec[0], 4));
+    return vec;
+}
+
+utils::ExResult<glm::vec3> LE_ReadVec3(StreamReader& reader) {
+    glm::vec3 vec;
+    AX_PROPAGATE_ERROR(reader.ReadSpan(&vec[0], 3));
+    return vec;
+}
+
+utils::ExResult<glm::vec2> LE_ReadVec2(StreamReader& reader) {
+    glm::vec2 vec;
+    AX_PROPAGATE_ERROR(reader.ReadSpan(&vec[0], 2));
+    return vec;
+}
+
+utils::ExError LE_WriteMat4(StreamWriter& writer, const glm::mat4& value) {
+    return writer.WriteSpan(&value[0][0], 16);
+}
+
+utils::ExError LE_WriteMat3(StreamWriter& writer, const glm::mat3& value) {
+    return writer.WriteSpan(&value[0][0], 9);
+}
+
+utils::ExError LE_WriteVec4(StreamWriter& writer, const glm::vec4& value) {
+    return writer.WriteSpan(&value[0], 4);
+}
+
+utils::ExError LE_WriteVec3(StreamWriter& writer, const glm::vec3& value) {
+    return writer.WriteSpan(&value[0], 3);
+}
+
+utils::ExError LE_WriteVec2(StreamWriter& writer, const glm::vec2& value) {
+    return writer.WriteSpan(&value[0], 2);
 }
 
 }
\ No newline at end of file
@@ -0,0 +1,123 @@
+#include "axle/data/AX_StreamReader.hpp"
+
+#include <algorithm>
+
+namespace axle::data
+{
+
+StreamReader::StreamReader(IDataStream& stream, std::size_t bufferSize) : m_Stream(&stream) {
+    m_WindowPos = stream.GetReadIndex();
+    if (m_WindowPos == UINT64_MAX) m_WindowPos = 0;
+
+    utils::URawView memory = stream.PeekContiguous();
+    if (memory.size() > 0) {
+        m_Borrowed = true;
+        m_Begin = m_Cur = memory.handle();
+        m_End = m_Begin + memory.size();
+    } else {
+        m_Buffer.resize(std::max<std::size_t>(bufferSize, MAX_VARINT_BYTES));
+        m_Begin = m_Cur = m_End = m_Buffer.data();
+    }
+}
+
+StreamReader::~StreamReader() {
+    Sync();
+}
+
+utils::ExError StreamReader::Sync() {
+    return m_Stream->SeekRead(GetPosition());
+}
+
+utils::ExError StreamReader::Seek(uint64_t pos) {
+    if (pos >= m_WindowPos && pos <= m_WindowPos + uint64_t(m_End - m_Begin)) {
+        m_Cur = m_Begin + (pos - m_WindowPos);
+        return utils::ExError::NoError();
+    }
+    if (m_Borrowed) return {-5, "Unexpected EOF"};
+
+    AX_PROPAGATE_ERROR(m_Stream->SeekRead(pos));
+    m_WindowPos = pos;
+    m_Begin = m_Cur = m_End = m_Buffer.data();
+    return utils::ExError::NoError();
+}
+
+utils::ExError StreamReader::Skip(uint64_t size) {
+    return Seek(GetPosition() + size);
+}
+
+utils::ExError StreamReader::Fill(std::size_t need) {
+    if (m_Borrowed) return {-5, "Unexpected EOF"};
+
+    // Keep the unread tail, then top the buffer up from the stream
+    std::size_t tail = GetAvailable();
+    m_WindowPos = GetPosition();
+    if (tail > 0 && m_Cur != m_Buffer.data()) std::memmove(m_Buffer.data(), m_Cur, tail);
+    if (need > m_Buffer.size()) m_Buffer.resize(need);
+    m_Begin = m_Cur = m_Buffer.data();
+    m_End = m_Begin + tail;
+
+    while (GetAvailable() < need) {
+        if (m_Stream->EndOfStream()) break;
+        auto res = m_Stream->Read(m_Buffer.data() + GetAvailable(), m_Buffer.size() - GetAvailable());
+        if (!res.has_value() || res.value() == 0) break;
+        m_End += res.value();
+    }
+    if (GetAvailable() < need) return {-5, "Unexpected EOF"};
+    return utils::ExError::NoError();
+}
+
+utils::ExError StreamReader::ReadBytes(void* out, std::size_t size) {
+    auto* dst = static_cast<uint8_t*>(out);
+    std::size_t fromWindow = std::min(size, GetAvailable());
+    std::memcpy(dst, m_Cur, fromWindow);
+    m_Cur += fromWindow;
+    if (fromWindow == size) return utils::ExError::NoError();
+
+    dst += fromWindow;
+    size -= fromWindow;
+    if (m_Borrowed) return {-5, "Unexpected EOF"};
+
+    // Small remainders go through the buffer, big ones straight into `out`
+    if (size < m_Buffer.size() / 2) {
+        AX_PROPAGATE_ERROR(Fill(size));
+        std::memcpy(dst, m_Cur, size);
+        m_Cur += size;
+        return utils::ExError::NoError();
+    }
+
+    m_WindowPos = GetPosition();
+    m_Begin = m_Cur = m_End = m_Buffer.data();
+    while (size > 0) {
+        if (m_Stream->EndOfStream()) return {-5, "Unexpected EOF"};
+        AX_DECL_OR_PROPAGATE(read, m_Stream->Read(dst, size));
+        if (read == 0) return {-5, "Unexpected EOF"};
+        dst += read;
+        size -= read;
+        m_WindowPos += read;
+    }
+    return utils::ExError::NoError();
+}
+
+utils::ExResult<uint64_t> StreamReader::ReadVarUIntSlow() {
+    uint64_t result{0};
+    for (uint32_t shift{0}; shift < 70; shift += 7) {
+        if (GetAvailable() == 0) {
+            AX_PROPAGATE_ERROR(Fill(1));
+        }
+        uint8_t byte = *m_Cur++;
+        result |= uint64_t(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) return result;
+    }
+    return utils::ExError{"VarUInt overflow"};
+}
+
+utils::ExResult<std::string> StreamReader::ReadString(uint32_t maxLength) {
+    AX_DECL_OR_PROPAGATE(length, ReadVarUInt());
+    if (length > maxLength) return utils::ExError{"String length exceeds maximum"};
+
+    std::string result(std::size_t(length), '\0');
+    AX_PROPAGATE_ERROR(ReadBytes(result.data(), result.size()));
+    return result;
+}
+
+}
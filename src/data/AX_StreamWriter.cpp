@@ -0,0 +1,50 @@
+#include "axle/data/AX_StreamWriter.hpp"
+
+#include <algorithm>
+
+namespace axle::data
+{
+
+StreamWriter::StreamWriter(IDataStream& stream, std::size_t bufferSize)
+    : m_Stream(&stream), m_Buffer(std::max<std::size_t>(bufferSize, MAX_VARINT_BYTES)) {}
+
+StreamWriter::~StreamWriter() {
+    Flush();
+}
+
+utils::ExError StreamWriter::Flush() {
+    std::size_t done{0};
+    while (done < m_Used) {
+        auto res = m_Stream->Write(m_Buffer.data() + done, m_Used - done);
+        if (!res.has_value() || res.value() == 0) {
+            // Keep what did not make it, a later Flush() may retry
+            std::memmove(m_Buffer.data(), m_Buffer.data() + done, m_Used - done);
+            m_Used -= done;
+            return res.has_value() ? utils::ExError{"Stream accepted no bytes"} : res.error();
+        }
+        done += res.value();
+    }
+    m_Used = 0;
+    return utils::ExError::NoError();
+}
+
+utils::ExError StreamWriter::WriteBytesSlow(const void* in, std::size_t size) {
+    AX_PROPAGATE_ERROR(Flush());
+    if (size <= m_Buffer.size() / 2) {
+        std::memcpy(m_Buffer.data(), in, size);
+        m_Used = size;
+        return utils::ExError::NoError();
+    }
+
+    // Large writes skip the buffer
+    auto* src = static_cast<const uint8_t*>(in);
+    while (size > 0) {
+        AX_DECL_OR_PROPAGATE(written, m_Stream->Write(src, size));
+        if (written == 0) return {"Stream accepted no bytes"};
+        src += written;
+        size -= written;
+    }
+    return utils::ExError::NoError();
+}
+
+}
@@ -11,6 +11,9 @@
 
 #include "axle/graphics/AX_GraphicsParams.hpp"
 
+#include "axle/core/concurrency/AX_ThreadCycler.hpp"
+#include "axle/core/profile/AX_Profiler.hpp"
+
 #include "axle/utils/AX_Expected.hpp"
 
 #include <glad/gl.h>
@@ -19,6 +22,7 @@
 #include <slang-com-ptr.h>
 #include <slang-com-helper.h>
 
+#include <memory_resource>
 #include <unordered_set>
 #include <cstddef>
 #include <string>
@@ -239,31 +243,79 @@ utils::ExResult<SwapchainDesc> GLGraphicsBackend::DescribeSwapchain(const Swapch
     return desc;
 }
 
+// Undoes a half-built resource when GL_CALL throws (GL error checks enabled)
+template <typename F>
+class UndoOnThrow {
+private:
+    F m_Undo;
+    bool m_Armed{true};
+public:
+    explicit UndoOnThrow(F undo) : m_Undo(std::move(undo)) {}
+    ~UndoOnThrow() { if (m_Armed) m_Undo(); }
+
+    void Dismiss() { m_Armed = false; }
+};
+
 ExResult<BufferHandle> GLGraphicsBackend::CreateBuffer(const BufferDesc& desc) {
     if (!m_Thread->ValidateThread()) return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
-    if (desc.usage == BufferUsage::Storage && !m_Capabilities.Has(GraphicsCapEnum::ShaderStorageBuffers))
-        return ExError{"Storage buffers not supported on this OpenGL backend (requires 4.3+)"};
+    BufferHandle handle = m_Buffers.ReserveHandle();
+    if (handle.index == UINT32_MAX)
+        return ExError{"Buffer handle pool exhausted"};
+
+    AX_PROPAGATE_ERROR(CreateReservedBuffer(handle, desc));
+    return handle;
+}
+
+BufferHandle GLGraphicsBackend::ReserveBuffer() {
+    return m_Buffers.ReserveHandle();
+}
+
+ExError GLGraphicsBackend::CreateReservedBuffer(const BufferHandle& reserved, const BufferDesc& desc) {
+    if (!m_Thread->ValidateThread()) return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
 
-    if (desc.usage == BufferUsage::Indirect && !m_Capabilities.Has(GraphicsCapEnum::IndirectDraw))
+    // Any failure past this point releases the reservation
+    if (desc.usage == BufferUsage::Storage && !m_Capabilities.Has(GraphicsCapEnum::ShaderStorageBuffers)) {
+        m_Buffers.ReleaseReservation(reserved);
+        return ExError{"Storage buffers not supported on this OpenGL backend (requires 4.3+)"};
+    }
+    if (desc.usage == BufferUsage::Indirect && !m_Capabilities.Has(GraphicsCapEnum::IndirectDraw)) {
+        m_Buffers.ReleaseReservation(reserved);
         return ExError{"Indirect buffers not supported on this backend"};
+    }
+
+    // Acquire() fails when the handle was never reserved or another thread released it meanwhile
+    auto* acquired = m_Buffers.Acquire(reserved);
+    if (!acquired)
+        return {"Handle is not reserved"};
 
     // Staging buffer is fine in GL 3.3 (just normal array buffer with CPU updates)
-    auto& buff = *m_Buffers.Reserve();
+    auto& buff = *acquired;
     buff.userDesc = desc;
 
     GLuint id = 0;
     GLenum target = ToGLBufferTarget(desc.usage);
 
+    UndoOnThrow undo([&]() {
+        if (id) m_GL->DeleteBuffers(1, &id);
+        m_Buffers.Delete(reserved);
+    });
     GL_CALL(m_GL->GenBuffers(1, &id));
     GL_CALL(m_GL->BindBuffer(target, id));
     GL_CALL(m_GL->BufferData(target, desc.size, nullptr, ToGLBufferAccess(desc.access)));
+    undo.Dismiss();
 
     buff.id = id;
     buff.usage = desc.usage;
     buff.size = desc.size;
     buff.Sign();
 
-    return buff.External();
+    return ExError::NoError();
+}
+
+ExError GLGraphicsBackend::ReleaseReservedBuffer(const BufferHandle& reserved) {
+    if (!m_Buffers.ReleaseReservation(reserved))
+        return {"Handle is not reserved"};
+    return ExError::NoError();
 }
 
 ExError GLGraphicsBackend::UpdateBuffer(const BufferHandle& handle, size_t offset, size_t size, const void* data) {
@@ -285,6 +337,8 @@ ExError GLGraphicsBackend::UpdateBuffer(const BufferHandle& handle, size_t offse
 
 ExError GLGraphicsBackend::DestroyBuffer(const BufferHandle& handle) {
     if (!m_Thread->ValidateThread()) return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
+    if (m_Buffers.ReleaseReservation(handle))
+        return ExError::NoError();
     if (!m_Buffers.IsValid(handle))
         return {"Invalid Handle"};
 
@@ -318,10 +372,37 @@ static uint32_t CalcFullMipCount(uint32_t w, uint32_t h, uint32_t d = 1) {
 
 ExResult<TextureHandle> GLGraphicsBackend::CreateTexture(const TextureDesc& desc) {
     if (!m_Thread->ValidateThread()) return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
-    if (desc.width == 0 || desc.height == 0)
+    TextureHandle handle = m_Textures.ReserveHandle();
+    if (handle.index == UINT32_MAX)
+        return ExError{"Texture handle pool exhausted"};
+
+    AX_PROPAGATE_ERROR(CreateReservedTexture(handle, desc));
+    return handle;
+}
+
+TextureHandle GLGraphicsBackend::ReserveTexture() {
+    return m_Textures.ReserveHandle();
+}
+
+ExError GLGraphicsBackend::CreateReservedTexture(const TextureHandle& reserved, const TextureDesc& desc) {
+    if (!m_Thread->ValidateThread()) return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
+
+    // Any failure past this point releases the reservation
+    if (desc.width == 0 || desc.height == 0) {
+        m_Textures.ReleaseReservation(reserved);
         return ExError{"Invalid dimensions"};
+    }
+    if (desc.type == TextureType::Cubemap && desc.initialData.size() != 6) {
+        m_Textures.ReleaseReservation(reserved);
+        return ExError{"Invalid pixelsByLayers, should be size of 6, each representing a side of cubemap"};
+    }
+
+    // Acquire() fails when the handle was never reserved or another thread released it meanwhile
+    auto* acquired = m_Textures.Acquire(reserved);
+    if (!acquired)
+        return {"Handle is not reserved"};
 
-    auto& tex = *m_Textures.Reserve();
+    auto& tex = *acquired;
     tex.userDesc = desc;
 
     GLenum target = ToGLTextureTarget(desc.type);
@@ -336,6 +417,12 @@ ExResult<TextureHandle> GLGraphicsBackend::CreateTexture(const TextureDesc& desc
         mip = CalcFullMipCount(desc.width, desc.height, depth);
     }
 
+    UndoOnThrow undo([&]() {
+        if (tex.id) m_GL->DeleteTextures(1, &tex.id);
+        tex.id = 0;
+        m_Textures.Delete(reserved);
+    });
+
     // Allocate and bind
     GL_CALL(m_GL->GenTextures(1, &tex.id));
     GL_CALL(m_GL->BindTexture(target, tex.id));
@@ -401,10 +488,6 @@ ExResult<TextureHandle> GLGraphicsBackend::CreateTexture(const TextureDesc& desc
         } break;
 
         case TextureType::Cubemap: {
-            if (desc.initialData.size() != 6) {
-                GL_CALL(m_GL->DeleteTextures(1, &tex.id));
-                return ExError{"Invalid pixelsByLayers, should be size of 6, each representing a side of cubemap"};
-            }
             for (uint32_t i = 0; i < 6; ++i) {
                 const void* data = desc.initialData[i].size() == 0
                     ? nullptr
@@ -430,9 +513,10 @@ ExResult<TextureHandle> GLGraphicsBackend::CreateTexture(const TextureDesc& desc
         } break;
     }
     GL_CALL(m_GL->BindTexture(target, 0));
+    undo.Dismiss();
 
     tex.Sign();
-    return tex.External();
+    return ExError::NoError();
 }
 
 utils::ExError GLGraphicsBackend::GenerateMipMaps(const TextureHandle& handle) {
@@ -478,6 +562,12 @@ static GLenum GetCubemapFaceFromDesc(const TextureDesc& desc) {
     return GL_NONE;
 }
 
+ExError GLGraphicsBackend::ReleaseReservedTexture(const TextureHandle& reserved) {
+    if (!m_Textures.ReleaseReservation(reserved))
+        return {"Handle is not reserved"};
+    return ExError::NoError();
+}
+
 ExError GLGraphicsBackend::UpdateTexture(const TextureHandle& handle, const void* data) {
     if (!m_Thread->ValidateThread())
         return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
@@ -610,7 +700,9 @@ ExError GLGraphicsBackend::UpdateTexture(const TextureHandle& handle, const void
 ExError GLGraphicsBackend::DestroyTexture(const TextureHandle& handle) {
     if (!m_Thread->ValidateThread())
         return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
-    if (m_Textures.IsValid(handle))
+    if (m_Textures.ReleaseReservation(handle))
+        return ExError::NoError();
+    if (!m_Textures.IsValid(handle))
         return {"Invalid Handle"};
 
     auto& tex = *m_Textures.Get(handle);
@@ -1611,9 +1703,10 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
 
             GL_CALL(m_GL->BindFramebuffer(GL_FRAMEBUFFER, fb.fbo));
 
-            std::vector<GLenum> drawBuffers(fb.fbo != 0 ?
+            std::pmr::vector<GLenum> drawBuffers(fb.fbo != 0 ?
                 pass.userDesc.colorAttachments.size() :
-                std::max(pass.userDesc.colorAttachments.size(), (std::size_t)1)
+                std::max(pass.userDesc.colorAttachments.size(), (std::size_t)1),
+                core::ThreadCycler::CurrentFrameResource()
             );
 
             if (fb.fbo !=  0) {
@@ -1688,7 +1781,7 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
             }
 
             if (fb.fbo !=  0) {
-                std::vector<GLenum> invalidateAttachments;
+                std::pmr::vector<GLenum> invalidateAttachments(core::ThreadCycler::CurrentFrameResource());
 
                 for (size_t i = 0; i < pass.userDesc.colorAttachments.size(); ++i) {
                     if (pass.userDesc.colorAttachments[i].passOps.store == StoreOp::Discard) {
@@ -1992,7 +2085,7 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
                 for (auto& bindingUser : bindingsUser) {
                     auto bindingShaderItr = bindingsShader.resIdByName.find(bindingUser.bindPoint);
                     if (bindingShaderItr == bindingsShader.resIdByName.end()) {
-                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) doesn't have any bindpoint with name: " + bindingUser.bindPoint};
+                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) doesn't have any bindpoint with name: " + bindingUser.bindPoint.Str()};
                     }
                     auto bindingShaderId = bindingShaderItr->second;
                     auto& bindingShader = bindingsShader.resources[bindingShaderId];
@@ -2013,26 +2106,26 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
                     };
 
                     if (IsTexResource != (bindingUser.resourceHandle.kind == ResourceKind::Texture)) {
-                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint type mismatch (Buffer != Texture or vice versa): " + bindingUser.bindPoint};
+                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint type mismatch (Buffer != Texture or vice versa): " + bindingUser.bindPoint.Str()};
                     }
                     if (bindingUser.isArray != bindingShader.isArray) {
-                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint is misleading as array type: " + bindingUser.bindPoint};
+                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint is misleading as array type: " + bindingUser.bindPoint.Str()};
                     }
                     if (bindingUser.isArray && (bindingUser.arrayIndex >= bindingShader.arraySize)) {
-                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint arrayIndex out of bounds: " + bindingUser.bindPoint};
+                        return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: Target GPU program (Shader) bindpoint arrayIndex out of bounds: " + bindingUser.bindPoint.Str()};
                     }
 
-                    std::string glBindPoint = bindingUser.isArray
-                        ? std::string(bindingUser.bindPoint + "[" + std::to_string(bindingUser.arrayIndex) + "]")
+                    utils::NameId glBindPoint = bindingUser.isArray
+                        ? bindingUser.bindPoint.Indexed(bindingUser.arrayIndex)
                         : bindingUser.bindPoint;
 
                     auto bindIdx = bindingUser.isArray ? bindingUser.arrayIndex : 0;
                     auto bindSize = bindingShader.isArray ? bindingShader.arraySize : 1;
 
                     if (implicitBinds && IsTexResource) {
-                        int32_t uniformLoc = m_GL->GetUniformLocation(programId, glBindPoint.c_str());
+                        int32_t uniformLoc = m_GL->GetUniformLocation(programId, glBindPoint.CStr());
                         if (uniformLoc < 0) 
-                            return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: GL: Target Uniform Location of bindpoint not found: " + glBindPoint};
+                            return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: GL: Target Uniform Location of bindpoint not found: " + glBindPoint.Str()};
 
                         if (cache.textureUnits.find(bindingShaderId) == cache.textureUnits.end()) {
                             cache.textureUnits[bindingShaderId] = {};
@@ -2047,9 +2140,9 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
                         cache.textureLocations[bindingShaderId][bindIdx] = (uint32_t)uniformLoc;
                         cache.textureUnits[bindingShaderId][bindIdx] = texUnit++;
                     } else if (!IsTexResource) { // ETC. Uniforms, SSBOs... (Blocks)
-                        uint32_t uniformLoc = m_GL->GetUniformBlockIndex(programId, glBindPoint.c_str());
+                        uint32_t uniformLoc = m_GL->GetUniformBlockIndex(programId, glBindPoint.CStr());
                         if (uniformLoc == GL_INVALID_INDEX) 
-                            return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: GL: Target Uniform Location of bindpoint not found: " + glBindPoint};
+                            return utils::ExError{"GLCommand::Execute \"GLCommandType::BindResourceSet\" Failed: GL: Target Uniform Location of bindpoint not found: " + glBindPoint.Str()};
 
                         if (cache.blockUnits.find(bindingShaderId) == cache.blockUnits.end()) {
                             cache.blockUnits[bindingShaderId] = {};
@@ -2315,6 +2408,8 @@ ExError GLGraphicsBackend::InternalExecute(CommandType type, data::BufferDataStr
 ExError GLGraphicsBackend::Execute(ICommandList& cmd) {
     if (!m_Thread->ValidateThread())
         return utils::ExError("Invalid Thread caller, must be Graphics Thread Owner");
+
+    AX_PROFILE_SCOPE("GLGraphicsBackend::Execute");
     auto& glCmd = static_cast<GLCommandList&>(cmd);
 
     if (!glCmd.ValidateThread()) {
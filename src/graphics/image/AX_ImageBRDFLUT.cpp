@@ -1,6 +1,8 @@
 #include "axle/graphics/image/AX_ImageBRDFLUT.hpp"
 #include "axle/graphics/image/AX_ImageLoader.hpp"
 
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+
 #include <glm/ext/scalar_constants.hpp>
 
 #include <stb_image.h>
@@ -120,19 +122,22 @@ void BRDFLUT_Generate(Image& img, int samples, int size) {
     float* data = reinterpret_cast<float*>(buff.data());
 	img.bytes = {std::move(buff)};
 
-    for (int y = 0; y < img.height; ++y) {
-        for (int x = 0; x < img.width; ++x) {
-            float NoV = (x + 0.5f) / float(img.width);
-            float roughness = (y + 0.5f) / float(img.height);
+    // Rows are independent, fan them out over the job system
+    core::JobSystem::Global().ParallelFor(img.height, [&](uint32_t yBegin, uint32_t yEnd) {
+        for (int y = yBegin; y < int(yEnd); ++y) {
+            for (int x = 0; x < img.width; ++x) {
+                float NoV = (x + 0.5f) / float(img.width);
+                float roughness = (y + 0.5f) / float(img.height);
 
-            glm::vec2 brdf = BRDF_IntegrateBRDF_RG(NoV, roughness, samples);
+                glm::vec2 brdf = BRDF_IntegrateBRDF_RG(NoV, roughness, samples);
 
-            int idx = ((img.width - y - 1) * img.width + x) * 3; // 3 floats per pixel
-            data[idx + 0] = brdf.x;
-            data[idx + 1] = brdf.y;
-            data[idx + 2] = 0;
+                int idx = ((img.width - y - 1) * img.width + x) * 3; // 3 floats per pixel
+                data[idx + 0] = brdf.x;
+                data[idx + 1] = brdf.y;
+                data[idx + 2] = 0;
+            }
         }
-    }
+    });
 	stbi_write_hdr("BRDFLUT.hdr", size, size, 3, (const float*) data);
 }
 
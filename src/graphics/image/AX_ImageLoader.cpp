@@ -1,12 +1,13 @@
 #include "axle/graphics/image/AX_ImageLoader.hpp"
 
 #include "axle/data/AX_DataStreamImplBuffer.hpp"
-#include "axle/data/AX_DataStreamImplFile.hpp"
+#include "axle/data/AX_DataStreamImplMMap.hpp"
 
 #include "axle/utils/AX_Universal.hpp"
 
 #include "stb_image.h"
 
+#include <cstring>
 #include <memory>
 #include <vector>
 #include <iostream>
@@ -66,7 +67,7 @@ bool Img_ASTC_IsValidFileBytes(URawView bufferView) {
 }
 
 bool Img_ASTC_IsValidFile(const std::filesystem::path& path) {
-    auto buffer = FileDataStream(path, true, false);
+    auto buffer = MMapDataStream(path, MMapAdvice::Random);
     if (buffer.Open().IsValid()) return false;
     return Img_ASTC_IsValidFileBytes(buffer);
 }
@@ -111,8 +112,11 @@ ExResult<ASTCImage> Img_ASTC_LoadFileBytes(IDataStream& buffer) {
     img.depth  = header.zsize[0] + (header.zsize[1] << 8) + (header.zsize[2] << 16);
 
     size_t dataSize = buffer.GetLength() - sizeof(ASTCHeader);
-    img.data = utils::URaw(std::vector<uint8_t>(dataSize));
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(img.data.data(), dataSize));
+    AX_DECL_OR_PROPAGATE(data, buffer.ReadShared(dataSize)); // Blocks stay in the file mapping when loaded from disk
+    if (data.size() != dataSize) {
+        return ExError(-5, "Unexpected EOF");
+    }
+    img.data = std::move(data);
 
     return img;
 }
@@ -130,7 +134,7 @@ ExResult<ASTCImage> Img_ASTC_LoadFile(const std::filesystem::path& path) {
     if (!Img_ASTC_IsValidFile(path)) {
         return ExError("Invalid ASTC File");
     }
-    auto buffer = FileDataStream(path, true, false);
+    auto buffer = MMapDataStream(path, MMapAdvice::Sequential);
     AX_PROPAGATE_ERROR(buffer.Open());
     return Img_ASTC_LoadFileBytes(buffer);
 }
@@ -153,7 +157,7 @@ bool Img_BCn_IsValidFileBytes(URawView bufferView) {
 }
 
 bool Img_BCn_IsValidFile(const std::filesystem::path& path) {
-    auto buffer = FileDataStream(path, true, false);
+    auto buffer = MMapDataStream(path, MMapAdvice::Random);
     if (buffer.Open().IsValid()) return false;
     return Img_BCn_IsValidFileBytes(buffer);
 }
@@ -188,8 +192,10 @@ utils::ExResult<BCnImage> Img_BCn_LoadFileBytes(data::IDataStream& buffer) {
     img.alpha = header.alpha;
 
     size_t dataSize = buffer.GetLength() - sizeof(BCnHeader);
-    std::vector<uint8_t> data(dataSize);
-    AX_PROPAGATE_RESULT_ERROR(buffer.Read(data.data(), dataSize));
+    AX_DECL_OR_PROPAGATE(data, buffer.ReadShared(dataSize));
+    if (data.size() != dataSize) {
+        return ExError(-5, "Unexpected EOF");
+    }
     img.data = std::move(data);
 
     return img;
@@ -208,7 +214,7 @@ utils::ExResult<BCnImage> Img_BCn_LoadFile(const std::filesystem::path& path) {
     if (!Img_BCn_IsValidFile(path)) {
         return ExError("Invalid BCn/DXT File");
     }
-    auto buffer = FileDataStream(path, true, false);
+    auto buffer = MMapDataStream(path, MMapAdvice::Sequential);
     AX_PROPAGATE_ERROR(buffer.Open());
     return Img_BCn_LoadFileBytes(buffer);
 }
@@ -246,6 +252,11 @@ utils::ExResult<Image> Img_Auto_LoadFileBytes(IDataStream& buffer) {
         .errors = {}
     };
 
+    // Memory-backed streams (file mappings, byte views) are decoded in place instead of through the callbacks
+    URawView memory = buffer.PeekContiguous();
+    bool inMemory = memory.size() > 0 && memory.size() <= size_t(INT32_MAX);
+    int memoryLen = static_cast<int>(memory.size());
+
     auto prevIdx = buffer.GetReadIndex();
     ScopeCall reset_stbi([&stbi_user, prevIdx](){
         stbi_user.buffer->SeekRead(prevIdx);
@@ -253,11 +264,13 @@ utils::ExResult<Image> Img_Auto_LoadFileBytes(IDataStream& buffer) {
     });
 
     reset_stbi.Call();
-    if (stbi_is_hdr_from_callbacks(&clbks, &stbi_user)) {
+    if ((inMemory ? stbi_is_hdr_from_memory(memory.handle(), memoryLen) : stbi_is_hdr_from_callbacks(&clbks, &stbi_user))) {
         stbi_set_flip_vertically_on_load_thread(true);
         reset_stbi.Call();
         int channels;
-        void* data = stbi_loadf_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
+        void* data = inMemory
+            ? stbi_loadf_from_memory(memory.handle(), memoryLen, &img.width, &img.height, &channels, 0)
+            : stbi_loadf_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
         if (!data) {
             if (!stbi_user.errors.empty()) return stbi_user.errors.front();
             return ExError(stbi_failure_reason() ? stbi_failure_reason() : "Failed to load HDR image");
@@ -280,11 +293,13 @@ utils::ExResult<Image> Img_Auto_LoadFileBytes(IDataStream& buffer) {
     } 
 
     reset_stbi.Call();
-    if (stbi_is_16_bit_from_callbacks(&clbks, &stbi_user)) {
+    if ((inMemory ? stbi_is_16_bit_from_memory(memory.handle(), memoryLen) : stbi_is_16_bit_from_callbacks(&clbks, &stbi_user))) {
         stbi_set_flip_vertically_on_load_thread(true);
         reset_stbi.Call();
         int channels;
-        void* data = stbi_load_16_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
+        void* data = inMemory
+            ? stbi_load_16_from_memory(memory.handle(), memoryLen, &img.width, &img.height, &channels, 0)
+            : stbi_load_16_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
         if (!data) {
             if (!stbi_user.errors.empty()) return stbi_user.errors.front();
             return ExError(stbi_failure_reason() ? stbi_failure_reason() : "Failed to load 16-bit image");
@@ -309,7 +324,9 @@ utils::ExResult<Image> Img_Auto_LoadFileBytes(IDataStream& buffer) {
     int channels;
     reset_stbi.Call();
     stbi_set_flip_vertically_on_load_thread(true);
-    void* data = stbi_load_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
+    void* data = inMemory
+        ? stbi_load_from_memory(memory.handle(), memoryLen, &img.width, &img.height, &channels, 0)
+        : stbi_load_from_callbacks(&clbks, &stbi_user, &img.width, &img.height, &channels, 0);
     if (!data) {
         if (!stbi_user.errors.empty()) return stbi_user.errors.front();
         return ExError(stbi_failure_reason() ? stbi_failure_reason() : "Failed to load 8-bit image");
@@ -338,7 +355,7 @@ utils::ExResult<Image> Img_Auto_LoadFileBytes(URawView bufferView) {
 }
 
 utils::ExResult<Image> Img_Auto_LoadFile(const std::filesystem::path& path) {
-    auto buffer = FileDataStream(path, true, false);
+    auto buffer = MMapDataStream(path, MMapAdvice::Sequential);
     AX_PROPAGATE_ERROR(buffer.Open());
     return Img_Auto_LoadFileBytes(buffer);
 }
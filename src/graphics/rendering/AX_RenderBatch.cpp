@@ -4,14 +4,16 @@
 #include "axle/graphics/scene/AX_ModelInstance.hpp"
 
 #include "axle/core/concurrency/AX_ThreadCycler.hpp"
+#include "axle/core/concurrency/AX_JobSystem.hpp"
+#include "axle/core/profile/AX_Profiler.hpp"
 
 #include <exception>
 
 namespace axle::gfx
 {
 
-RenderBatch::RenderBatch(ThreadGfxScope gfxThread, const RenderBatchDesc& desc)
-    : ThreadOwned(gfxThread), m_Desc(desc) {
+RenderBatch::RenderBatch(ThreadGfxScope gfxThread, RenderBatchDesc desc)
+    : ThreadOwned(gfxThread), m_Desc(std::move(desc)) {
 }
 
 /*
@@ -119,31 +121,53 @@ void RenderBatch::TraverseNode(const NodeTraversalParams& params) {
     }
 }
 
-void RenderBatch::GenerateDrawCalls(SharedPtr<scene::ModelInstance> modelInstance, std::deque<DrawCallContext>& out_all) {
-    std::deque<DrawCallContext> part{};
-    TraverseNode({*modelInstance, *modelInstance->GetRootNode().SyncCall(), part});
-    out_all.insert(
-        out_all.end(),
-        std::make_move_iterator(part.begin()),
-        std::make_move_iterator(part.end())
-    );
+void RenderBatch::GenerateDrawCalls(scene::ModelInstance& modelInstance, scene::NodeInstance& rootNode, std::pmr::vector<DrawCallContext>& out) {
+    AX_PROFILE_SCOPE("RenderBatch::GenerateDrawCalls");
+    TraverseNode({modelInstance, rootNode, out});
 }
 
 void RenderBatch::Record(const RenderProcedure& renderProc) {
     if (!m_Thread->ValidateThread() || !renderProc.OnOwnerThread())
         return;
 
+    AX_PROFILE_SCOPE("RenderBatch::Record");
+
     auto commandList = renderProc.m_Desc.commandList;
     auto pipelineResolver = renderProc.m_Desc.pipelineResolver;
     auto currentPass = renderProc.m_CurrentPass;
 
     auto gbgfx = m_Thread->GetContext();
 
-    std::deque<DrawCallContext> allDrawCalls;
+    // Per-frame containers live in the gfx cycler's frame arena, workers allocate from it too
+    auto* frameRes = core::ThreadCycler::CurrentFrameResource();
+
+    std::pmr::vector<SharedPtr<scene::ModelInstance>> instances(m_TrackingInstances.begin(), m_TrackingInstances.end(), frameRes);
+
+    // Root lookups stay on the owner thread, a SyncCall() from a job worker would block on us
+    std::pmr::vector<SharedPtr<scene::NodeInstance>> rootNodes(frameRes);
+    rootNodes.reserve(instances.size());
+    for (auto& modelInstance : instances) {
+        rootNodes.push_back(modelInstance->GetRootNode().Immediate());
+    }
+
+    std::pmr::vector<std::pmr::vector<DrawCallContext>> mdDrawCallsPerModel(instances.size(), frameRes);
+    core::JobSystem::Global().ParallelFor(static_cast<uint32_t>(instances.size()), [&](uint32_t begin, uint32_t end) {
+        for (uint32_t i{begin}; i < end; i++) {
+            GenerateDrawCalls(*instances[i], *rootNodes[i], mdDrawCallsPerModel[i]);
+        }
+    }, 1);
+
+    size_t drawCallCount{0};
+    for (auto& mdDrawCalls : mdDrawCallsPerModel) {
+        drawCallCount += mdDrawCalls.size();
+    }
 
-    for (auto& modelInstance : m_TrackingInstances) {
-        std::deque<DrawCallContext> mdDrawCalls;
-        GenerateDrawCalls(modelInstance, mdDrawCalls);
+    std::pmr::vector<DrawCallContext> allDrawCalls(frameRes);
+    allDrawCalls.reserve(drawCallCount);
+
+    for (size_t i{0}; i < instances.size(); i++) {
+        auto& modelInstance = instances[i];
+        auto& mdDrawCalls = mdDrawCallsPerModel[i];
 
         for (auto& mdDrawCall : mdDrawCalls) {
             RPPipelineResolveContext resolveContext{
@@ -161,11 +185,12 @@ void RenderBatch::Record(const RenderProcedure& renderProc) {
         );
     }
 
-    std::sort(
-        allDrawCalls.begin(),
-        allDrawCalls.end(),
-        m_Desc.drawCallsSort
-    );
+    // The default comparator gets inlined, a custom one costs one indirect call per compare
+    if (auto* defaultSort = m_Desc.drawCallsSort.Target<std::remove_cvref_t<decltype(RBATCH_SORT_BY_MINIMAL_STATE)>>()) {
+        std::sort(allDrawCalls.begin(), allDrawCalls.end(), *defaultSort);
+    } else {
+        std::sort(allDrawCalls.begin(), allDrawCalls.end(), std::cref(m_Desc.drawCallsSort));
+    }
 
     RenderPipelineHandle currentPipeline{utils::INVALID_HANDLE};
     ResourceSetHandle currentResources{utils::INVALID_HANDLE};
@@ -240,16 +265,16 @@ ThreadInvocationVoid RenderBatch::RemoveInstances(utils::Span<SharedPtr<scene::M
     });
 }
 
-ThreadInvocationVoid RenderBatch::SetItemSort(const Predicate<DrawCallContext>& pred) {
-    return ThreadInvocationVoid(m_Thread, [&, predCpy = pred](){
-        m_Desc.drawCallsSort = predCpy;
+ThreadInvocationVoid RenderBatch::SetItemSort(Predicate<DrawCallContext> pred) {
+    return ThreadInvocationVoid(m_Thread, [this, pred = std::move(pred)]() mutable {
+        m_Desc.drawCallsSort = std::move(pred);
         return VoidInvoke{};
     });
 }
 
-ThreadInvocationVoid RenderBatch::SetUserSortKeyAssigner(const UserSortKeyAssigner& assigner) {
-    return ThreadInvocationVoid(m_Thread, [&, assignerCpy = assigner](){
-        m_Desc.userSortKeyAssigner = assignerCpy;
+ThreadInvocationVoid RenderBatch::SetUserSortKeyAssigner(UserSortKeyAssigner assigner) {
+    return ThreadInvocationVoid(m_Thread, [this, assigner = std::move(assigner)]() mutable {
+        m_Desc.userSortKeyAssigner = std::move(assigner);
         return VoidInvoke{};
     });
 }
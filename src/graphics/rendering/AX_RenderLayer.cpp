@@ -37,11 +37,11 @@ void RenderLayer::Draw(float dT) {
     }
 }
 
-ThreadInvocation<RLHandle> RenderLayer::CreateLayer(const RLDesc& desc) {
-    return ThreadInvocation<RLHandle>(m_Thread, [&](){
+ThreadInvocation<RLHandle> RenderLayer::CreateLayer(RLDesc desc) {
+    return ThreadInvocation<RLHandle>(m_Thread, [this, desc = std::move(desc)]() mutable {
         auto& layer = *m_RLPool.Reserve();
-        layer.updateFunc = desc.updateFunc;
-        layer.drawFunc = desc.drawFunc;
+        layer.updateFunc = std::move(desc.updateFunc);
+        layer.drawFunc = std::move(desc.drawFunc);
         layer.sortKey = desc.sortKey;
         layer.stage = desc.stage;
         layer.Sign();
@@ -57,8 +57,8 @@ ThreadInvocation<utils::ExError> RenderLayer::RemoveLayer(const RLHandle& handle
     });
 }
 
-ThreadInvocationVoid RenderLayer::SortLayers(const Predicate<RLIntern>& pred) {
-    return ThreadInvocationVoid(m_Thread, [&](){
+ThreadInvocationVoid RenderLayer::SortLayers(Predicate<RLIntern> pred) {
+    return ThreadInvocationVoid(m_Thread, [this, pred = std::move(pred)](){
         m_RLPool.SortOrder(pred);
         return VoidInvoke{};
     });
@@ -1,5 +1,7 @@
 #include "axle/graphics/scene/AX_ModelInstance.hpp"
 
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
 namespace axle::scene
 {
 
@@ -21,6 +23,7 @@ ThreadInvocation<SharedPtr<NodeInstance>> ModelInstance::GetNode(assets::NodeId
 }
 
 ModelInstance::ModelInstance(const ModelDesc& desc) : ThreadOwned(desc.gfxThread), m_Desc(desc) {
+    AX_ALLOC_TAG(Scene);
     TraverseNode(desc.rootNode);
     m_RootNodeInstance = m_NodeInstancesById[desc.rootNode.nodeId];
 }
@@ -97,7 +97,7 @@ utils::Span<uint32_t> NodeInstance::GetMeshIds() {
 }
 
 std::string_view NodeInstance::GetName() const {
-    return m_Name;
+    return m_Name.View();
 }
 
 }
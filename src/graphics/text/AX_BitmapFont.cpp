@@ -1,5 +1,7 @@
 #include "axle/graphics/text/AX_BitmapFont.hpp"
 
+#include "axle/core/alloc/AX_AllocTracker.hpp"
+
 #include <iostream>
 
 using namespace axle::utils;
@@ -29,6 +31,7 @@ BitmapFont::~BitmapFont() {
 
 ExError BitmapFont::LoadFont(const std::filesystem::path& filename) {
     if (m_FTFaceInit) return {"an FT_Face already loaded"};
+    AX_ALLOC_TAG(Text);
     auto cppstr = filename.string();
     auto cstr = cppstr.c_str();
 
@@ -62,6 +65,7 @@ CharacterAtlas* BitmapFont::GetPage(wchar_t _char) {
 }
 
 ExError BitmapFont::GenerateGlyph(wchar_t _char) {
+    AX_ALLOC_TAG(Text);
     if (!m_FTFaceInit) return {"No FT_Face (Font) loaded yet"};
     if (m_Glyphs.find(_char) != m_Glyphs.end()) return {"This glyph already exists"};
 
@@ -175,6 +179,7 @@ bool BitmapFont::PackIntoBestFitAtlas(
 }
 
 ExError BitmapFont::TransformToPages(uint32_t pageSize) {
+    AX_ALLOC_TAG(Text);
     if (m_Transformed) return {"Already transformed, use another instance of BitmapFont"};
 
     std::vector<std::vector<std::pair<wchar_t, CharGlyph>>> blocks;
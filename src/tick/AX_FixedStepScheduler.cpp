@@ -0,0 +1,93 @@
+#include "axle/tick/AX_FixedStepScheduler.hpp"
+
+#include <algorithm>
+
+namespace axle::tick
+{
+
+FixedStepScheduler::FixedStepScheduler(ChNanos step, uint32_t maxCatchUpSteps) {
+    Configure(step, maxCatchUpSteps);
+}
+
+void FixedStepScheduler::Configure(ChNanos step, uint32_t maxCatchUpSteps) {
+    m_Step = std::max(step, ChNanos(0));
+    m_MaxCatchUpSteps = std::max(maxCatchUpSteps, 1u);
+}
+
+void FixedStepScheduler::Subscribe(ITickAdapter* adapter) {
+    std::lock_guard<std::mutex> lock(m_SubscriberMutex);
+    if (std::find(m_Subscribers.begin(), m_Subscribers.end(), adapter) == m_Subscribers.end()) {
+        m_Subscribers.push_back(adapter);
+        m_SubscribersDirty = true;
+    }
+}
+
+void FixedStepScheduler::Unsubscribe(ITickAdapter* adapter) {
+    std::lock_guard<std::mutex> lock(m_SubscriberMutex);
+    auto it = std::find(m_Subscribers.begin(), m_Subscribers.end(), adapter);
+    if (it != m_Subscribers.end()) {
+        m_Subscribers.erase(it);
+        m_SubscribersDirty = true;
+    }
+}
+
+void FixedStepScheduler::Reset(ChSteadyTimepoint now) {
+    m_LastTime = now;
+    m_Accumulator = ChNanos(0);
+    m_Alpha.store(0.0f, std::memory_order_release);
+}
+
+void FixedStepScheduler::RunStep(float dT) {
+    {
+        std::lock_guard<std::mutex> lock(m_SubscriberMutex);
+        if (m_SubscribersDirty) {
+            m_TickList.assign(m_Subscribers.begin(), m_Subscribers.end());
+            m_SubscribersDirty = false;
+        }
+    }
+    if (m_StepCallback) m_StepCallback(dT);
+    for (auto* adapter : m_TickList) {
+        adapter->Tick(dT);
+    }
+    m_StepIndex.fetch_add(1, std::memory_order_release);
+}
+
+uint32_t FixedStepScheduler::Advance(ChSteadyTimepoint now) {
+    auto elapsed = std::max(now - m_LastTime, ChSteadyClock::duration(0));
+    m_LastTime = now;
+
+    if (m_Step.count() == 0) {
+        RunStep(std::chrono::duration<float>(elapsed).count());
+        m_Alpha.store(1.0f, std::memory_order_release);
+        return 1;
+    }
+
+    m_Accumulator += elapsed;
+
+    uint32_t steps{0};
+    float dT = GetStepSeconds();
+    while (m_Accumulator >= m_Step && steps < m_MaxCatchUpSteps) {
+        RunStep(dT);
+        m_Accumulator -= m_Step;
+        steps++;
+    }
+    if (m_Accumulator >= m_Step) { // Fell too far behind, drop the backlog instead of spiralling
+        m_DroppedSteps.fetch_add(m_Accumulator / m_Step, std::memory_order_relaxed);
+        m_Accumulator %= m_Step;
+    }
+
+    m_Alpha.store(float(double(m_Accumulator.count()) / double(m_Step.count())), std::memory_order_release);
+    return steps;
+}
+
+ChSteadyTimepoint FixedStepScheduler::GetNextStepTime() const {
+    return m_LastTime + (m_Step - m_Accumulator);
+}
+
+void FixedStepScheduler::SleepUntilNextStep() const {
+    if (m_Step.count() > 0) {
+        utils::Uni_SleepUntil(GetNextStepTime(), m_SpinTail);
+    }
+}
+
+}
@@ -0,0 +1,157 @@
+#include "axle/utils/AX_NameId.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <charconv>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+namespace axle::utils
+{
+
+namespace
+{
+
+struct NameEntry {
+    const char* text{nullptr};
+    uint32_t length{0};
+    uint32_t hash{0};
+};
+
+// Open addressing over packed (hash >> 32) << 32 | index slots, entries in chunks that never move.
+// Inserts claim an entry, then CAS it into an empty slot; a thread losing the race to the same name
+// leaves its entry orphaned (a few bytes, rare) instead of ever taking a lock.
+class NameTable {
+private:
+    static constexpr uint32_t MASK = NameId::TABLE_SLOTS - 1;
+    static constexpr uint32_t CHUNK_SIZE = 4096;
+    static constexpr uint32_t MAX_CHUNKS = (NameId::MAX_NAMES + CHUNK_SIZE) / CHUNK_SIZE;
+
+    std::unique_ptr<std::atomic<uint64_t>[]> m_Slots{new std::atomic<uint64_t>[NameId::TABLE_SLOTS]{}};
+    std::unique_ptr<std::atomic<NameEntry*>[]> m_Chunks{new std::atomic<NameEntry*>[MAX_CHUNKS]{}};
+    std::atomic<uint32_t> m_Next{1}; // 0 is the empty name
+
+    NameEntry& EnsureEntry(uint32_t index) {
+        auto& slot = m_Chunks[index / CHUNK_SIZE];
+        NameEntry* chunk = slot.load(std::memory_order_acquire);
+        if (!chunk) {
+            NameEntry* fresh = new NameEntry[CHUNK_SIZE];
+            if (slot.compare_exchange_strong(chunk, fresh, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                chunk = fresh;
+            } else {
+                delete[] fresh;
+            }
+        }
+        return chunk[index % CHUNK_SIZE];
+    }
+
+    uint32_t CreateEntry(std::string_view text, uint64_t hash) {
+        uint32_t index = m_Next.fetch_add(1, std::memory_order_relaxed);
+        if (index > NameId::MAX_NAMES) {
+            throw std::runtime_error("AX FATAL: NameId table is full");
+        }
+        char* copy = new char[text.size() + 1];
+        std::memcpy(copy, text.data(), text.size());
+        copy[text.size()] = '\0';
+
+        auto& entry = EnsureEntry(index);
+        entry.text = copy;
+        entry.length = static_cast<uint32_t>(text.size());
+        entry.hash = static_cast<uint32_t>(hash);
+        return index;
+    }
+
+    bool Matches(uint64_t slot, uint64_t hash, std::string_view text) const {
+        if ((slot >> 32) != (hash >> 32))
+            return false;
+        const auto& entry = Entry(static_cast<uint32_t>(slot));
+        return entry.length == text.size() && std::memcmp(entry.text, text.data(), text.size()) == 0;
+    }
+public:
+    const NameEntry& Entry(uint32_t index) const {
+        return m_Chunks[index / CHUNK_SIZE].load(std::memory_order_acquire)[index % CHUNK_SIZE];
+    }
+
+    uint32_t Find(std::string_view text, uint64_t hash) const {
+        for (uint32_t pos = static_cast<uint32_t>(hash) & MASK;; pos = (pos + 1) & MASK) {
+            uint64_t slot = m_Slots[pos].load(std::memory_order_acquire);
+            if (slot == 0) return 0;
+            if (Matches(slot, hash, text)) return static_cast<uint32_t>(slot);
+        }
+    }
+
+    uint32_t Intern(std::string_view text, uint64_t hash) {
+        uint32_t created{0};
+        for (uint32_t pos = static_cast<uint32_t>(hash) & MASK;; pos = (pos + 1) & MASK) {
+            uint64_t slot = m_Slots[pos].load(std::memory_order_acquire);
+            if (slot == 0) {
+                if (!created) created = CreateEntry(text, hash);
+                uint64_t desired = ((hash >> 32) << 32) | created;
+                if (m_Slots[pos].compare_exchange_strong(slot, desired, std::memory_order_acq_rel, std::memory_order_acquire)) {
+                    return created;
+                }
+            }
+            if (Matches(slot, hash, text)) return static_cast<uint32_t>(slot);
+        }
+    }
+
+    uint32_t Count() const {
+        return std::min(m_Next.load(std::memory_order_relaxed), NameId::MAX_NAMES + 1);
+    }
+};
+
+// Never destroyed, so names stay valid in static destructors
+NameTable& Table() {
+    static NameTable* s_Table = new NameTable();
+    return *s_Table;
+}
+
+}
+
+NameId NameId::Intern(std::string_view text, uint64_t hash) {
+    if (text.empty())
+        return {};
+    return NameId(Table().Intern(text, hash), static_cast<uint32_t>(hash));
+}
+
+std::optional<NameId> NameId::Find(std::string_view text) {
+    if (text.empty())
+        return NameId{};
+    uint64_t hash = NameHash(text);
+    uint32_t index = Table().Find(text, hash);
+    if (index == 0)
+        return std::nullopt;
+    return NameId(index, static_cast<uint32_t>(hash));
+}
+
+NameId NameId::Indexed(uint32_t index) const {
+    auto base = View();
+    char buffer[256];
+    if (base.size() + 12 > sizeof(buffer)) {
+        return NameId(Str() + "[" + std::to_string(index) + "]");
+    }
+    std::memcpy(buffer, base.data(), base.size());
+    char* out = buffer + base.size();
+    *out++ = '[';
+    out = std::to_chars(out, buffer + sizeof(buffer) - 1, index).ptr; // uint32 fits, the last byte is kept for ']'
+    *out++ = ']';
+    return NameId(std::string_view(buffer, static_cast<size_t>(out - buffer)));
+}
+
+std::string_view NameId::View() const {
+    if (m_Index == 0)
+        return {};
+    const auto& entry = Table().Entry(m_Index);
+    return std::string_view(entry.text, entry.length);
+}
+
+const char* NameId::CStr() const {
+    return m_Index == 0 ? "" : Table().Entry(m_Index).text;
+}
+
+uint32_t NameId::Count() {
+    return Table().Count();
+}
+
+}
@@ -0,0 +1,157 @@
+#include "axle/utils/AX_UUID.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <random>
+#include <thread>
+
+namespace axle::utils
+{
+
+namespace
+{
+
+constexpr uint64_t SplitMix64(uint64_t& state) {
+    uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+constexpr uint64_t Rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+// xoshiro256**, one per thread; random_device is only touched for the seed
+class Xoshiro256 {
+private:
+    uint64_t m_S[4];
+public:
+    Xoshiro256() {
+        std::random_device rd;
+        uint64_t seed = (uint64_t(rd()) << 32) ^ rd();
+        seed ^= std::hash<std::thread::id>{}(std::this_thread::get_id());
+        seed ^= static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+        for (auto& s : m_S) s = SplitMix64(seed);
+    }
+
+    uint64_t Next() {
+        uint64_t result = Rotl(m_S[1] * 5, 7) * 9;
+        uint64_t t = m_S[1] << 17;
+        m_S[2] ^= m_S[0];
+        m_S[3] ^= m_S[1];
+        m_S[1] ^= m_S[2];
+        m_S[0] ^= m_S[3];
+        m_S[2] ^= t;
+        m_S[3] = Rotl(m_S[3], 45);
+        return result;
+    }
+};
+
+Xoshiro256& ThreadEngine() {
+    thread_local Xoshiro256 engine;
+    return engine;
+}
+
+constexpr uint64_t VARIANT_MASK = 0x3FFFFFFFFFFFFFFFull;
+constexpr uint64_t VARIANT_RFC = 0x8000000000000000ull;
+
+// Offset of each of the 16 bytes in the 8-4-4-4-12 form
+constexpr std::array<uint8_t, 16> BYTE_POS{0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+// Two lowercase hex digits per byte value
+constexpr std::array<std::array<char, 2>, 256> HEX_PAIRS = [] {
+    constexpr char digits[] = "0123456789abcdef";
+    std::array<std::array<char, 2>, 256> pairs{};
+    for (uint32_t b{0}; b < 256; b++) pairs[b] = {digits[b >> 4], digits[b & 0xF]};
+    return pairs;
+}();
+
+// 0xFF for anything that is not a hex digit
+constexpr std::array<uint8_t, 256> HEX_VALUES = [] {
+    std::array<uint8_t, 256> values{};
+    values.fill(0xFF);
+    for (uint8_t c{0}; c < 10; c++) values['0' + c] = c;
+    for (uint8_t c{0}; c < 6; c++) {
+        values['a' + c] = 10 + c;
+        values['A' + c] = 10 + c;
+    }
+    return values;
+}();
+
+// Last issued (unix ms << 12 | counter) across all threads
+std::atomic<uint64_t> g_V7Last{0};
+
+}
+
+UUID UUID::Generate() {
+    auto& engine = ThreadEngine();
+    uint64_t high = engine.Next();
+    uint64_t low = engine.Next();
+    high = (high & ~0xF000ull) | 0x4000ull;
+    low = (low & VARIANT_MASK) | VARIANT_RFC;
+    return UUID(high, low);
+}
+
+UUID UUID::GenerateV7() {
+    uint64_t nowMs = static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
+
+    // Counter overflow within a millisecond borrows from the next one, keeping the order strict
+    uint64_t last = g_V7Last.load(std::memory_order_relaxed);
+    uint64_t next;
+    do {
+        next = std::max(nowMs << 12, last + 1);
+    } while (!g_V7Last.compare_exchange_weak(last, next, std::memory_order_relaxed));
+
+    uint64_t high = ((next >> 12) << 16) | 0x7000ull | (next & 0xFFFull);
+    uint64_t low = (ThreadEngine().Next() & VARIANT_MASK) | VARIANT_RFC;
+    return UUID(high, low);
+}
+
+std::optional<UUID> UUID::Parse(std::string_view text) {
+    if (text.size() != STRING_LENGTH)
+        return std::nullopt;
+
+    uint32_t bad = (text[8] ^ '-') | (text[13] ^ '-') | (text[18] ^ '-') | (text[23] ^ '-');
+    uint64_t high{0}, low{0};
+    for (uint32_t i{0}; i < 8; i++) {
+        uint32_t hh = HEX_VALUES[static_cast<uint8_t>(text[BYTE_POS[i]])];
+        uint32_t hl = HEX_VALUES[static_cast<uint8_t>(text[BYTE_POS[i] + 1])];
+        uint32_t lh = HEX_VALUES[static_cast<uint8_t>(text[BYTE_POS[8 + i]])];
+        uint32_t ll = HEX_VALUES[static_cast<uint8_t>(text[BYTE_POS[8 + i] + 1])];
+        bad |= (hh | hl | lh | ll) & 0xF0;
+        high = (high << 8) | (hh << 4) | (hl & 0x0F);
+        low = (low << 8) | (lh << 4) | (ll & 0x0F);
+    }
+    if (bad)
+        return std::nullopt;
+    return UUID(high, low);
+}
+
+void UUID::ToChars(char* out) const {
+    out[8] = out[13] = out[18] = out[23] = '-';
+    for (uint32_t i{0}; i < 8; i++) {
+        std::memcpy(out + BYTE_POS[i], HEX_PAIRS[(m_High >> (56 - i * 8)) & 0xFF].data(), 2);
+        std::memcpy(out + BYTE_POS[8 + i], HEX_PAIRS[(m_Low >> (56 - i * 8)) & 0xFF].data(), 2);
+    }
+}
+
+std::string UUID::ToString() const {
+    std::string res(STRING_LENGTH, '\0');
+    ToChars(res.data());
+    return res;
+}
+
+std::array<uint8_t, 16> UUID::Data() const {
+    std::array<uint8_t, 16> bytes;
+    for (uint32_t i{0}; i < 8; i++) {
+        bytes[i] = static_cast<uint8_t>(m_High >> (56 - i * 8));
+        bytes[8 + i] = static_cast<uint8_t>(m_Low >> (56 - i * 8));
+    }
+    return bytes;
+}
+
+}
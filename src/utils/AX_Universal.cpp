@@ -5,6 +5,15 @@
 #include <chrono>
 #include <iostream>
 
+#if defined(__linux__)
+#include <time.h>
+#include <cerrno>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 namespace axle::utils
 {
 
@@ -19,28 +28,40 @@ bool EqualsIgnoreCase(const char* a, const char* b) {
     return *a == *b;
 }
 
-void Uni_NanoSleep(ChNanos nanos) {
-    using namespace std::chrono;
-    if (nanos <= ChNanos(0)) return;
+void Uni_CpuRelax() {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+    _mm_pause();
+#elif defined(__aarch64__)
+    asm volatile("yield");
+#else
+    std::this_thread::yield();
+#endif
+}
 
-    auto targetTime = steady_clock::now() + nanos;
+void Uni_SleepUntil(ChSteadyTimepoint target, ChNanos spinTail) {
+    using namespace std::chrono;
 
-    while (true) {
-        auto remaining = targetTime - steady_clock::now();
+    auto sleepTarget = target - spinTail;
+    if (steady_clock::now() < sleepTarget) {
+#if defined(__linux__)
+        // steady_clock is CLOCK_MONOTONIC on linux, TIMER_ABSTIME avoids drift across EINTR restarts
+        auto ns = duration_cast<nanoseconds>(sleepTarget.time_since_epoch()).count();
+        timespec ts{};
+        ts.tv_sec = static_cast<time_t>(ns / 1000000000);
+        ts.tv_nsec = static_cast<long>(ns % 1000000000);
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &ts, nullptr) == EINTR) {}
+#else
+        std::this_thread::sleep_until(sleepTarget);
+#endif
+    }
 
-        if (remaining <= nanoseconds(0))
-            break;
+    while (steady_clock::now() < target)
+        Uni_CpuRelax();
+}
 
-        if (remaining > milliseconds(15)) {
-            std::this_thread::sleep_for(milliseconds(2));
-        } else if (remaining > microseconds(100)) {
-            std::this_thread::yield();
-        } else {
-            while (steady_clock::now() < targetTime)
-                _mm_pause();
-            break;
-        }
-    }
+void Uni_NanoSleep(ChNanos nanos, ChNanos spinTail) {
+    if (nanos <= ChNanos(0)) return;
+    Uni_SleepUntil(ChSteadyClock::now() + nanos, spinTail);
 }
 
 #ifdef __AX_ASSETS_ASSIMP__
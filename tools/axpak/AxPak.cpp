@@ -0,0 +1,75 @@
+// AxPak
+//   AxPak pack [--lz4|--zstd] <directory> <output.axpak> [prefix]
+//                                                    every file below <directory>, stored under its relative path
+//   AxPak list <pack.axpak>
+//   AxPak verify <pack.axpak>                        checks every entry's checksum
+#include "axle/assets/AX_AssetPacker.hpp"
+#include "axle/data/AX_DataStreamImplFile.hpp"
+
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+
+using namespace axle;
+
+static int Usage() {
+    std::cerr << "Usage:\n"
+              << "  AxPak pack [--lz4|--zstd] <directory> <output.axpak> [prefix]\n"
+              << "  AxPak list <pack.axpak>\n"
+              << "  AxPak verify <pack.axpak>\n";
+    return 2;
+}
+
+static int Report(const utils::ExError& err) {
+    std::cerr << "error: " << err.GetMessage() << std::endl;
+    return 1;
+}
+
+static int Pack(const std::filesystem::path& dir, const std::filesystem::path& output, const char* prefix,
+                assets::PackCompression compression) {
+    assets::AssetPacker packer;
+    if (auto err = packer.AddDirectory(dir, prefix ? prefix : "", compression); err.IsValid()) return Report(err);
+
+    data::FileDataStream out(output, false, true);
+    if (auto err = out.Open(); err.IsValid()) return Report(err);
+    if (auto err = packer.Write(out); err.IsValid()) return Report(err);
+
+    std::cout << "packed " << packer.GetEntryCount() << " files, " << packer.GetPackSize() << " bytes -> " << output.string() << std::endl;
+    return 0;
+}
+
+static int List(const std::filesystem::path& path, bool verify) {
+    assets::AssetPack pack(path, data::MMapAdvice::Sequential);
+    if (auto err = pack.Open(); err.IsValid()) return Report(err);
+
+    uint32_t failed{0};
+    for (const auto& entry : pack.GetEntries()) {
+        if (verify) {
+            if (auto err = pack.Verify(entry); err.IsValid()) {
+                std::cerr << err.GetMessage() << std::endl;
+                failed++;
+            }
+        } else {
+            std::cout << entry.size << "\t" << entry.rawSize << "\t" << pack.GetPath(entry) << std::endl;
+        }
+    }
+    if (verify) std::cout << pack.GetEntries().size() - failed << "/" << pack.GetEntries().size() << " entries OK" << std::endl;
+    return failed == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv) {
+    if (argc < 3) return Usage();
+    if (std::strcmp(argv[1], "pack") == 0) {
+        auto compression = assets::PackCompression::None;
+        int arg{2};
+        if (std::strcmp(argv[arg], "--lz4") == 0) compression = assets::PackCompression::LZ4;
+        else if (std::strcmp(argv[arg], "--zstd") == 0) compression = assets::PackCompression::Zstd;
+        if (compression != assets::PackCompression::None) arg++;
+        if (argc < arg + 2) return Usage();
+        return Pack(argv[arg], argv[arg + 1], argc > arg + 2 ? argv[arg + 2] : nullptr, compression);
+    }
+    if (std::strcmp(argv[1], "list") == 0) return List(argv[2], false);
+    if (std::strcmp(argv[1], "verify") == 0) return List(argv[2], true);
+    return Usage();
+}